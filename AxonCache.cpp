@@ -12,10 +12,20 @@
 #include "src/axoncache/cache/base/MapCacheBase.cpp"
 #include "src/axoncache/cache/factory/CacheFactory.cpp"
 #include "src/axoncache/cache/hasher/Xxh3Hasher.cpp"
+#include "src/axoncache/cache/key/KeyFingerprint.cpp"
+#include "src/axoncache/cache/key/NamespaceTable.cpp"
+#include "src/axoncache/cache/EmbeddingCache.cpp"
 #include "src/axoncache/cache/LinearProbeDedupCache.cpp"
+#include "src/axoncache/cache/NumericCache.cpp"
+#include "src/axoncache/cache/PerfectHashCache.cpp"
+#include "src/axoncache/cache/probe/CuckooProbe.cpp"
+#include "src/axoncache/cache/probe/PerfectHashProbe.cpp"
+#include "src/axoncache/cache/probe/SimdProbe.cpp"
 #include "src/axoncache/cache/probe/SimpleProbe.cpp"
 #include "src/axoncache/cache/value/ChainedValue.cpp"
+#include "src/axoncache/cache/value/FrequentValueSketch.cpp"
 #include "src/axoncache/cache/value/LinearProbeValue.cpp"
+#include "src/axoncache/cache/value/ValueDictionary.cpp"
 #include "src/axoncache/capi/CacheReaderCApi.cpp"
 #include "src/axoncache/capi/CacheWriterCApi.cpp"
 #include "src/axoncache/common/xxhash.c"
@@ -32,6 +42,10 @@
 #include "src/axoncache/parser/CacheValueParser.cpp"
 #include "src/axoncache/reader/DataFileReader.cpp"
 #include "src/axoncache/reader/DataReader.cpp"
+#include "src/axoncache/transformer/FloatListMath.cpp"
+#include "src/axoncache/transformer/FloatListQuantizer.cpp"
+#include "src/axoncache/transformer/Int64ListCodec.cpp"
+#include "src/axoncache/transformer/RoaringBitmap.cpp"
 #include "src/axoncache/transformer/StringListToString.cpp"
 #include "src/axoncache/transformer/StringViewToNullTerminatedString.cpp"
 #include "src/axoncache/transformer/TypeToString.cpp"
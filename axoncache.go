@@ -65,6 +65,8 @@ type CacheReaderOptions struct {
 	UpdateCallback         UpdateCallback
 	Timestamp              string
 	IsPreloadMemoryEnabled bool
+	IsHugePagesEnabled     bool
+	IsHotKeyCacheEnabled   bool
 }
 
 func ensureDestinationFolderExists(folderPath string) error {
@@ -86,9 +88,15 @@ func NewCacheReader(options *CacheReaderOptions) (*CacheReader, error) {
 	// Create a channel to signal the goroutine to stop
 	stop := make(chan struct{})
 
-	isPreloadMemoryEnabled := 0
+	loadOptions := 0
 	if options.IsPreloadMemoryEnabled {
-		isPreloadMemoryEnabled = 1
+		loadOptions = C.CACHE_READER_PRELOAD_MEMORY
+	}
+	if options.IsHugePagesEnabled {
+		loadOptions |= C.CACHE_READER_HUGE_PAGES
+	}
+	if options.IsHotKeyCacheEnabled {
+		loadOptions |= C.CACHE_READER_HOT_KEY_CACHE
 	}
 
 	alcacheReader := &CacheReader{
@@ -100,7 +108,7 @@ func NewCacheReader(options *CacheReaderOptions) (*CacheReader, error) {
 		Stop:                   stop,
 		UpdateCallback:         options.UpdateCallback,
 		Timestamp:              options.Timestamp,
-		IsPreloadMemoryEnabled: isPreloadMemoryEnabled,
+		IsPreloadMemoryEnabled: loadOptions,
 	}
 
 	if err := ensureDestinationFolderExists(options.DestinationFolder); err != nil {
@@ -563,6 +571,228 @@ func (c *CacheReader) GetVectorFloat(key string) ([]float32, error) {
 	return goFloats, nil
 }
 
+// GetInt64List returns the Int64List value of key, ErrNotFound for an empty one
+func (c *CacheReader) GetInt64List(key string) ([]int64, error) {
+	if !c.isInitialized() {
+		return []int64{}, ErrUnInitialized
+	}
+	if len(key) == 0 {
+		return []int64{}, ErrNotFound
+	}
+
+	k := []byte(key)
+
+	var cSize C.int
+
+	cInts := C.CacheReader_GetInt64List(c.Handle,
+		(*C.char)(unsafe.Pointer(&k[0])), C.size_t(len(k)),
+		&cSize)
+
+	if cInts == nil {
+		return []int64{}, ErrNotFound
+	}
+
+	goInts := make([]int64, cSize)
+	copy(goInts, unsafe.Slice((*int64)(unsafe.Pointer(cInts)), int(cSize)))
+	C.free(unsafe.Pointer(cInts)) // Free the array
+
+	return goInts, nil
+}
+
+// ContainsInt64 reports whether the Int64List value of key holds id, without copying the list
+// out of the cache
+func (c *CacheReader) ContainsInt64(key string, id int64) (bool, error) {
+	if !c.isInitialized() {
+		return false, ErrUnInitialized
+	}
+	if len(key) == 0 {
+		return false, ErrNotFound
+	}
+
+	k := []byte(key)
+
+	hasId := C.CacheReader_ContainsInt64(c.Handle,
+		(*C.char)(unsafe.Pointer(&k[0])), C.size_t(len(k)), C.int64_t(id))
+
+	return hasId != 0, nil
+}
+
+// BitmapContains reports whether the Bitmap value of key holds value, tested on the cache memory
+func (c *CacheReader) BitmapContains(key string, value uint32) (bool, error) {
+	if !c.isInitialized() {
+		return false, ErrUnInitialized
+	}
+	if len(key) == 0 {
+		return false, ErrNotFound
+	}
+
+	k := []byte(key)
+
+	hasValue := C.CacheReader_BitmapContains(c.Handle,
+		(*C.char)(unsafe.Pointer(&k[0])), C.size_t(len(k)), C.uint32_t(value))
+
+	return hasValue != 0, nil
+}
+
+// BitmapIntersectCount counts the values in both Bitmaps, a missing key being an empty set
+func (c *CacheReader) BitmapIntersectCount(leftKey string, rightKey string) (int64, error) {
+	if !c.isInitialized() {
+		return 0, ErrUnInitialized
+	}
+	if len(leftKey) == 0 || len(rightKey) == 0 {
+		return 0, nil
+	}
+
+	l := []byte(leftKey)
+	r := []byte(rightKey)
+
+	count := C.CacheReader_BitmapIntersectCount(c.Handle,
+		(*C.char)(unsafe.Pointer(&l[0])), C.size_t(len(l)),
+		(*C.char)(unsafe.Pointer(&r[0])), C.size_t(len(r)))
+
+	return int64(count), nil
+}
+
+// BitmapContainsMany reports for every key whether its Bitmap value holds value
+func (c *CacheReader) BitmapContainsMany(keys []string, value uint32) ([]bool, error) {
+	found := make([]bool, len(keys))
+	if !c.isInitialized() {
+		return found, ErrUnInitialized
+	}
+	if len(keys) == 0 {
+		return found, nil
+	}
+
+	k, sizes := concatKeys(keys)
+	cFound := make([]C.int, len(keys))
+	C.CacheReader_BitmapContainsMany(c.Handle,
+		(*C.char)(unsafe.Pointer(unsafe.SliceData(k))), unsafe.SliceData(sizes), C.size_t(len(keys)),
+		C.uint32_t(value), &cFound[0])
+	for i := range found {
+		found[i] = cFound[i] != 0
+	}
+
+	return found, nil
+}
+
+// Metrics of ScoreMany and TopK
+const (
+	ScoreDotProduct = int(C.CACHE_READER_SCORE_DOT_PRODUCT)
+	ScoreCosine     = int(C.CACHE_READER_SCORE_COSINE)
+)
+
+// DotProduct scores the FloatList value of key against query on the cache memory,
+// ErrNotFound unless it has len(query) floats
+func (c *CacheReader) DotProduct(key string, query []float32) (float32, error) {
+	return c.score(key, query, ScoreDotProduct)
+}
+
+func (c *CacheReader) CosineSimilarity(key string, query []float32) (float32, error) {
+	return c.score(key, query, ScoreCosine)
+}
+
+func (c *CacheReader) score(key string, query []float32, metric int) (float32, error) {
+	if !c.isInitialized() {
+		return 0, ErrUnInitialized
+	}
+	if len(key) == 0 {
+		return 0, ErrNotFound
+	}
+
+	k := []byte(key)
+	isExists := C.int(0)
+
+	var val C.float
+	if metric == ScoreCosine {
+		val = C.CacheReader_CosineSimilarity(c.Handle,
+			(*C.char)(unsafe.Pointer(&k[0])), C.size_t(len(k)),
+			floatsPointer(query), C.size_t(len(query)), &isExists)
+	} else {
+		val = C.CacheReader_DotProduct(c.Handle,
+			(*C.char)(unsafe.Pointer(&k[0])), C.size_t(len(k)),
+			floatsPointer(query), C.size_t(len(query)), &isExists)
+	}
+
+	if isExists == 0 {
+		return 0, ErrNotFound
+	}
+
+	return float32(val), nil
+}
+
+// ScoreMany scores every key, defaultScore for the keys DotProduct would not find
+func (c *CacheReader) ScoreMany(keys []string, query []float32, metric int, defaultScore float32) ([]float32, error) {
+	scores := make([]float32, len(keys))
+	if !c.isInitialized() {
+		return scores, ErrUnInitialized
+	}
+	if len(keys) == 0 {
+		return scores, nil
+	}
+
+	k, sizes := concatKeys(keys)
+	ret := C.CacheReader_ScoreMany(c.Handle,
+		(*C.char)(unsafe.Pointer(unsafe.SliceData(k))), unsafe.SliceData(sizes), C.size_t(len(keys)),
+		floatsPointer(query), C.size_t(len(query)), C.int(metric), C.float(defaultScore),
+		(*C.float)(unsafe.Pointer(&scores[0])))
+	if ret < 0 {
+		return scores, fmt.Errorf("unknown score metric %d", metric)
+	}
+
+	return scores, nil
+}
+
+// TopK returns the indexes in keys and the scores of the k best scoring keys, best first
+func (c *CacheReader) TopK(keys []string, query []float32, metric int, k int) ([]int, []float32, error) {
+	if !c.isInitialized() {
+		return []int{}, []float32{}, ErrUnInitialized
+	}
+	k = min(k, len(keys))
+	if k <= 0 {
+		return []int{}, []float32{}, nil
+	}
+
+	concatenated, sizes := concatKeys(keys)
+	indexes := make([]C.int32_t, k)
+	scores := make([]float32, k)
+	count := C.CacheReader_TopK(c.Handle,
+		(*C.char)(unsafe.Pointer(unsafe.SliceData(concatenated))), unsafe.SliceData(sizes), C.size_t(len(keys)),
+		floatsPointer(query), C.size_t(len(query)), C.int(metric), C.size_t(k),
+		&indexes[0], (*C.float)(unsafe.Pointer(&scores[0])))
+	if count < 0 {
+		return []int{}, []float32{}, fmt.Errorf("unknown score metric %d", metric)
+	}
+
+	goIndexes := make([]int, count)
+	for i := range int(count) {
+		goIndexes[i] = int(indexes[i])
+	}
+
+	return goIndexes, scores[:count], nil
+}
+
+// Keys back to back with their sizes, the layout of the batched C calls
+func concatKeys(keys []string) ([]byte, []C.size_t) {
+	total := 0
+	for _, key := range keys {
+		total += len(key)
+	}
+	concatenated := make([]byte, 0, max(total, 1))
+	sizes := make([]C.size_t, len(keys))
+	for i, key := range keys {
+		concatenated = append(concatenated, key...)
+		sizes[i] = C.size_t(len(key))
+	}
+	return concatenated[:max(total, 1)], sizes
+}
+
+func floatsPointer(values []float32) *C.float {
+	if len(values) == 0 {
+		return nil
+	}
+	return (*C.float)(unsafe.Pointer(&values[0]))
+}
+
 // CacheWriter
 type CacheWriter struct {
 	Handle                *C.CacheWriterHandle
@@ -233,6 +233,68 @@ class Reader
         return std::vector<float>( arr, arr + count );
     }
 
+    float dot_product( py::bytes key, const std::vector<float> & query ) const
+    {
+        ensure_init();
+        std::string k = key;
+        int exists = 0;
+        float v = CacheReader_DotProduct( handle_, k.data(), k.size(), query.data(), query.size(), &exists );
+        if ( exists == 0 )
+        {
+            throw NotFoundError( "key not found" );
+        }
+        return v;
+    }
+
+    float cosine_similarity( py::bytes key, const std::vector<float> & query ) const
+    {
+        ensure_init();
+        std::string k = key;
+        int exists = 0;
+        float v = CacheReader_CosineSimilarity( handle_, k.data(), k.size(), query.data(), query.size(), &exists );
+        if ( exists == 0 )
+        {
+            throw NotFoundError( "key not found" );
+        }
+        return v;
+    }
+
+    std::vector<float> score_many( const std::vector<py::bytes> & keys, const std::vector<float> & query, int metric, float default_score ) const
+    {
+        ensure_init();
+        std::string concatenated;
+        std::vector<size_t> sizes;
+        concat_keys( keys, concatenated, sizes );
+        std::vector<float> scores( keys.size() );
+        if ( CacheReader_ScoreMany( handle_, concatenated.data(), sizes.data(), sizes.size(), query.data(), query.size(), metric, default_score, scores.data() ) < 0 )
+        {
+            throw std::invalid_argument( "unknown score metric" );
+        }
+        return scores;
+    }
+
+    std::vector<std::pair<int, float>> top_k( const std::vector<py::bytes> & keys, const std::vector<float> & query, std::size_t k, int metric ) const
+    {
+        ensure_init();
+        std::string concatenated;
+        std::vector<size_t> sizes;
+        concat_keys( keys, concatenated, sizes );
+        std::vector<int32_t> indexes( k );
+        std::vector<float> scores( k );
+        int count = CacheReader_TopK( handle_, concatenated.data(), sizes.data(), sizes.size(), query.data(), query.size(), metric, k, indexes.data(), scores.data() );
+        if ( count < 0 )
+        {
+            throw std::invalid_argument( "unknown score metric" );
+        }
+        std::vector<std::pair<int, float>> out;
+        out.reserve( count );
+        for ( int i = 0; i < count; ++i )
+        {
+            out.emplace_back( indexes[i], scores[i] );
+        }
+        return out;
+    }
+
     void close()
     {
         if ( handle_ )
@@ -249,6 +311,17 @@ class Reader
     }
 
   private:
+    static void concat_keys( const std::vector<py::bytes> & keys, std::string & concatenated, std::vector<size_t> & sizes )
+    {
+        sizes.reserve( keys.size() );
+        for ( const auto & key : keys )
+        {
+            std::string k = key;
+            concatenated += k;
+            sizes.push_back( k.size() );
+        }
+    }
+
     void ensure_init() const
     {
         if ( !initialized_ )
@@ -411,6 +484,10 @@ PYBIND11_MODULE( axoncache, m )
         .def( "get_double", &Reader::get_double, py::arg( "key" ) )
         .def( "get_vector", &Reader::get_vector, py::arg( "key" ) )
         .def( "get_vector_float", &Reader::get_vector_float, py::arg( "key" ) )
+        .def( "dot_product", &Reader::dot_product, py::arg( "key" ), py::arg( "query" ) )
+        .def( "cosine_similarity", &Reader::cosine_similarity, py::arg( "key" ), py::arg( "query" ) )
+        .def( "score_many", &Reader::score_many, py::arg( "keys" ), py::arg( "query" ), py::arg( "metric" ) = CACHE_READER_SCORE_DOT_PRODUCT, py::arg( "default_score" ) = 0.0F )
+        .def( "top_k", &Reader::top_k, py::arg( "keys" ), py::arg( "query" ), py::arg( "k" ), py::arg( "metric" ) = CACHE_READER_SCORE_DOT_PRODUCT )
         .def( "close", &Reader::close );
 
     py::class_<Writer>( m, "Writer" )
@@ -422,5 +499,8 @@ PYBIND11_MODULE( axoncache, m )
         .def( "finish_cache_creation", &Writer::finish_cache_creation )
         .def( "close", &Writer::close );
 
+    m.attr( "SCORE_DOT_PRODUCT" ) = CACHE_READER_SCORE_DOT_PRODUCT;
+    m.attr( "SCORE_COSINE" ) = CACHE_READER_SCORE_COSINE;
+
     m.doc() = "Python bindings for AxonCache C API";
 }
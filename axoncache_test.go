@@ -156,6 +156,32 @@ func TestCacheReader(t *testing.T) {
 
 	_, err = cache.GetVectorFloat("")
 	assert.Equal(ErrNotFound, err)
+
+	// Scores of float32[]
+	var squaredNorm float32
+	for _, value := range expectedVector {
+		squaredNorm += value * value
+	}
+	dot, _ := cache.DotProduct("1909.xxx", expectedVector)
+	assert.InDelta(squaredNorm, dot, float64(squaredNorm)*1e-5)
+
+	cosine, _ := cache.CosineSimilarity("1909.xxx", expectedVector)
+	assert.InDelta(1.0, cosine, 1e-5)
+
+	_, err = cache.DotProduct("1909.xxx", expectedVector[:3])
+	assert.Equal(ErrNotFound, err)
+
+	_, err = cache.DotProduct("1909.NOTFOUND", expectedVector)
+	assert.Equal(ErrNotFound, err)
+
+	scores, _ := cache.ScoreMany([]string{"1909.NOTFOUND", "1909.xxx"}, expectedVector, ScoreCosine, -1)
+	assert.Equal(2, len(scores))
+	assert.Equal(float32(-1), scores[0])
+	assert.InDelta(1.0, scores[1], 1e-5)
+
+	indexes, topScores, _ := cache.TopK([]string{"1909.NOTFOUND", "1909.xxx", "999.vec1"}, expectedVector, ScoreDotProduct, 2)
+	assert.Equal([]int{1}, indexes)
+	assert.Equal(1, len(topScores))
 }
 
 // Golang 1.23 has a copy folder routine but it does not work as expected, so bring in our own
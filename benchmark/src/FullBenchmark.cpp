@@ -7,8 +7,12 @@
 #include <axoncache/Constants.h>
 #include <axoncache/loader/CacheOneTimeLoader.h>
 #include <axoncache/cache/BucketChainCache.h>
+#include <axoncache/cache/CuckooCache.h>
 #include <axoncache/cache/LinearProbeCache.h>
 #include <axoncache/cache/LinearProbeDedupCache.h>
+#include <axoncache/cache/LinearProbeSimdCache.h>
+#include <axoncache/cache/PerfectHashCache.h>
+#include <axoncache/cache/probe/SlotMapping.h>
 #include <axoncache/memory/MallocMemoryHandler.h>
 #include <axoncache/cache/MapCache.h>
 
@@ -25,7 +29,7 @@
 
 namespace axoncache
 {
-template<typename Cache, CacheType CacheT>
+template<typename Cache, CacheType CacheT, uint32_t HeaderFlags = 0U>
 class FullBenchmark : public benchmark::Fixture
 {
   public:
@@ -58,6 +62,11 @@ class FullBenchmark : public benchmark::Fixture
         settings.setSetting( axoncache::Constants::ConfKey::kOutputDir + "." + cacheName, std::filesystem::temp_directory_path().string() );
         settings.setSetting( axoncache::Constants::ConfKey::kControlCharLine, "\n" );
         settings.setSetting( axoncache::Constants::ConfKey::kControlCharVectorType, "\t" );
+        settings.setSetting( axoncache::Constants::ConfKey::kRobinHood + "." + cacheName, ( HeaderFlags & Constants::HeaderFlag::kRobinHood ) != 0U ? "true" : "false" );
+        if ( toSlotMapping( HeaderFlags ) != SlotMapping::MODULO )
+        {
+            settings.setSetting( axoncache::Constants::ConfKey::kSlotMapping + "." + cacheName, toSlotMapping( HeaderFlags ) == SlotMapping::FAST_RANGE ? "fastrange" : "pow2" );
+        }
 
         const auto strKeyRatio = 0.8;                                     // 80% string keys, 20% vector keys
         const auto numberOfStringKeys = numberOfKeySlots * maxLoadFactor; // target 85% load factor
@@ -183,6 +192,21 @@ class FullBenchmark : public benchmark::Fixture
         }
     }
 
+    void lookupMany( benchmark::State & state )
+    {
+        // Request-sized batches, as handlers issue them
+        const auto batchSize = 256UL;
+        std::vector<std::string_view> keys( mStringKeys.begin(), mStringKeys.end() );
+        auto ix = 0UL;
+        for ( auto _ : state )
+        {
+            ix = ix + batchSize > keys.size() ? 0UL : ix;
+            benchmark::DoNotOptimize( mCache->getMany( std::span<const std::string_view>{ keys.data() + ix, batchSize } ) );
+            ix += batchSize;
+        }
+        state.SetItemsProcessed( state.iterations() * batchSize );
+    }
+
     void negativeLookup( benchmark::State & state )
     {
         // This is *not* guranteed to be 100% negative lookups but should mostly be so
@@ -231,6 +255,60 @@ BENCHMARK_TEMPLATE_DEFINE_F( FullBenchmark, LinearProbeNegativeLookup, LinearPro
     negativeLookup( state );
 }
 
+BENCHMARK_TEMPLATE_DEFINE_F( FullBenchmark, LinearProbeFastRangeLookup, LinearProbeCache, CacheType::LINEAR_PROBE, Constants::HeaderFlag::kSlotMappingFastRange )
+( benchmark::State & state )
+{
+    lookup( state );
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F( FullBenchmark, LinearProbePow2Lookup, LinearProbeCache, CacheType::LINEAR_PROBE, Constants::HeaderFlag::kSlotMappingPow2Mask )
+( benchmark::State & state )
+{
+    lookup( state );
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F( FullBenchmark, LinearProbeRobinHoodNegativeLookup, LinearProbeCache, CacheType::LINEAR_PROBE, Constants::HeaderFlag::kRobinHood | Constants::HeaderFlag::kSlotMappingPow2Mask )
+( benchmark::State & state )
+{
+    negativeLookup( state );
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F( FullBenchmark, LinearProbeSimdLookup, LinearProbeSimdCache, CacheType::LINEAR_PROBE_SIMD )
+( benchmark::State & state )
+{
+    lookup( state );
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F( FullBenchmark, LinearProbeSimdNegativeLookup, LinearProbeSimdCache, CacheType::LINEAR_PROBE_SIMD )
+( benchmark::State & state )
+{
+    negativeLookup( state );
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F( FullBenchmark, PerfectHashLookup, PerfectHashCache, CacheType::PERFECT_HASH )
+( benchmark::State & state )
+{
+    lookup( state );
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F( FullBenchmark, PerfectHashNegativeLookup, PerfectHashCache, CacheType::PERFECT_HASH )
+( benchmark::State & state )
+{
+    negativeLookup( state );
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F( FullBenchmark, CuckooLookup, CuckooCache, CacheType::CUCKOO )
+( benchmark::State & state )
+{
+    lookup( state );
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F( FullBenchmark, CuckooNegativeLookup, CuckooCache, CacheType::CUCKOO )
+( benchmark::State & state )
+{
+    negativeLookup( state );
+}
+
 BENCHMARK_TEMPLATE_DEFINE_F( FullBenchmark, BucketChainNegativeLookup, BucketChainCache, CacheType::BUCKET_CHAIN )
 ( benchmark::State & state )
 {
@@ -256,6 +334,18 @@ BENCHMARK_TEMPLATE_DEFINE_F( FullBenchmark, LinearProbeDedupLookup, LinearProbeD
     lookup( state );
 }
 
+BENCHMARK_TEMPLATE_DEFINE_F( FullBenchmark, LinearProbeGetMany, LinearProbeCache, CacheType::LINEAR_PROBE )
+( benchmark::State & state )
+{
+    lookupMany( state );
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F( FullBenchmark, LinearProbeDedupGetMany, LinearProbeDedupCache, CacheType::LINEAR_PROBE_DEDUP )
+( benchmark::State & state )
+{
+    lookupMany( state );
+}
+
 BENCHMARK_TEMPLATE_DEFINE_F( FullBenchmark, LinearProbeDedupNegativeLookup, LinearProbeDedupCache, CacheType::LINEAR_PROBE_DEDUP )
 ( benchmark::State & state )
 {
@@ -271,6 +361,21 @@ BENCHMARK_REGISTER_F( FullBenchmark, BucketChainNegativeLookup )->Range( start,
 
 BENCHMARK_REGISTER_F( FullBenchmark, LinearProbeLookup )->Range( start, end );
 BENCHMARK_REGISTER_F( FullBenchmark, LinearProbeNegativeLookup )->Range( start, end );
+BENCHMARK_REGISTER_F( FullBenchmark, LinearProbeFastRangeLookup )->Range( start, end );
+BENCHMARK_REGISTER_F( FullBenchmark, LinearProbePow2Lookup )->Range( start, end );
+BENCHMARK_REGISTER_F( FullBenchmark, LinearProbeRobinHoodNegativeLookup )->Range( start, end );
+
+BENCHMARK_REGISTER_F( FullBenchmark, LinearProbeSimdLookup )->Range( start, end );
+BENCHMARK_REGISTER_F( FullBenchmark, LinearProbeSimdNegativeLookup )->Range( start, end );
+
+BENCHMARK_REGISTER_F( FullBenchmark, PerfectHashLookup )->Range( start, end );
+BENCHMARK_REGISTER_F( FullBenchmark, PerfectHashNegativeLookup )->Range( start, end );
+
+BENCHMARK_REGISTER_F( FullBenchmark, CuckooLookup )->Range( start, end );
+BENCHMARK_REGISTER_F( FullBenchmark, CuckooNegativeLookup )->Range( start, end );
 
 BENCHMARK_REGISTER_F( FullBenchmark, LinearProbeDedupLookup )->Range( start, end );
 BENCHMARK_REGISTER_F( FullBenchmark, LinearProbeDedupNegativeLookup )->Range( start, end );
+
+BENCHMARK_REGISTER_F( FullBenchmark, LinearProbeGetMany )->Range( start, end );
+BENCHMARK_REGISTER_F( FullBenchmark, LinearProbeDedupGetMany )->Range( start, end );
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <axoncache/cache/EmbeddingCache.h>
+#include <axoncache/cache/LinearProbeCache.h>
+#include <axoncache/memory/MallocMemoryHandler.h>
+#include <benchmark/benchmark.h>
+#include "CacheBenchmarkUtils.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+using namespace axoncache;
+
+namespace
+{
+constexpr uint64_t kNumberOfEmbeddings = 200000UL;
+constexpr size_t kEmbeddingDimension = 64U;
+constexpr size_t kGatherBatchSize = 256U;
+
+template<typename Cache>
+auto buildEmbeddings( Cache & cache, std::vector<std::string> & keys ) -> void
+{
+    keys.reserve( kNumberOfEmbeddings );
+    std::vector<float> row( kEmbeddingDimension );
+    for ( const auto & [key, value] : benchmark_utils::gen_random_str_map( kNumberOfEmbeddings ) )
+    {
+        for ( size_t i = 0; i < kEmbeddingDimension; ++i )
+        {
+            row[i] = static_cast<float>( value.size() + i );
+        }
+        cache.put( key, row );
+        keys.push_back( key );
+    }
+    cache.finalize();
+}
+
+auto nextBatch( const std::vector<std::string> & keys, size_t & ix, std::vector<std::string_view> & batch ) -> void
+{
+    for ( auto & key : batch )
+    {
+        key = keys[ix];
+        ix = ( ix + 7919UL ) % keys.size();
+    }
+}
+}
+
+// One batch of rows copied into an inference input, from FloatList records of LINEAR_PROBE
+static void GatherFloatLists( benchmark::State & state )
+{
+    std::vector<std::string> keys;
+    LinearProbeCache cache( 35U, kNumberOfEmbeddings * 2, 0.5, std::make_unique<MallocMemoryHandler>() );
+    buildEmbeddings( cache, keys );
+
+    std::vector<std::string_view> batch( kGatherBatchSize );
+    std::vector<float> out( kGatherBatchSize * kEmbeddingDimension );
+    auto ix = 0UL;
+    for ( auto _ : state )
+    {
+        nextBatch( keys, ix, batch );
+        for ( size_t i = 0; i < batch.size(); ++i )
+        {
+            const auto row = cache.getFloatSpan( batch[i] );
+            std::memcpy( out.data() + i * kEmbeddingDimension, row.data(), row.size_bytes() );
+        }
+        benchmark::DoNotOptimize( out.data() );
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * kGatherBatchSize ) );
+}
+
+// Same batch from the matrix of an EMBEDDING cache
+static void GatherEmbeddingRows( benchmark::State & state )
+{
+    std::vector<std::string> keys;
+    EmbeddingCache cache( 35U, kNumberOfEmbeddings * 2, 0.5, std::make_unique<MallocMemoryHandler>() );
+    buildEmbeddings( cache, keys );
+
+    std::vector<std::string_view> batch( kGatherBatchSize );
+    std::vector<float> out( kGatherBatchSize * kEmbeddingDimension );
+    auto ix = 0UL;
+    for ( auto _ : state )
+    {
+        nextBatch( keys, ix, batch );
+        benchmark::DoNotOptimize( cache.gatherRows( batch, out.data() ) );
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * kGatherBatchSize ) );
+}
+
+BENCHMARK( GatherFloatLists );
+BENCHMARK( GatherEmbeddingRows );
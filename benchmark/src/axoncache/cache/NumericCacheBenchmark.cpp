@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <axoncache/cache/LinearProbeCache.h>
+#include <axoncache/cache/NumericCache.h>
+#include <axoncache/memory/MallocMemoryHandler.h>
+#include <benchmark/benchmark.h>
+#include "CacheBenchmarkUtils.h"
+
+#include <string>
+#include <vector>
+using namespace axoncache;
+
+namespace
+{
+constexpr uint64_t kNumberOfKeys = 1000000UL;
+}
+
+// Int64 lookups over a cache much larger than L2, the record load is what NUMERIC saves
+template<typename Cache>
+static void Int64Lookup( benchmark::State & state )
+{
+    std::vector<std::string> keys;
+    keys.reserve( kNumberOfKeys );
+    Cache cache( 35U, kNumberOfKeys * 2, 0.5, std::make_unique<MallocMemoryHandler>() );
+    for ( const auto & [key, value] : benchmark_utils::gen_random_str_map( kNumberOfKeys ) )
+    {
+        auto number = static_cast<int64_t>( value.size() );
+        cache.put( key, number );
+        keys.push_back( key );
+    }
+    cache.finalize();
+
+    auto ix = 0UL;
+    for ( auto _ : state )
+    {
+        benchmark::DoNotOptimize( cache.getInt64( keys[ix] ) );
+        benchmark::ClobberMemory();
+        ix = ( ix + 7919UL ) % keys.size();
+    }
+}
+
+BENCHMARK_TEMPLATE( Int64Lookup, LinearProbeCache );
+BENCHMARK_TEMPLATE( Int64Lookup, NumericCache );
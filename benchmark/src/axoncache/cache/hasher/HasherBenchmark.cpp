@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <axoncache/cache/LinearProbeCache.h>
+#include <axoncache/cache/hasher/WyHasher.h>
+#include <axoncache/cache/hasher/Xxh3Hasher.h>
+#include <axoncache/memory/MallocMemoryHandler.h>
+#include <benchmark/benchmark.h>
+#include "CacheBenchmarkUtils.h"
+
+#include <string>
+#include <vector>
+using namespace axoncache;
+
+namespace
+{
+constexpr uint64_t kNumberOfKeys = 100000UL;
+
+auto gen_keys( int64_t keySize ) -> std::vector<std::string>
+{
+    std::vector<std::string> keys;
+    keys.reserve( kNumberOfKeys );
+    for ( auto ix = 0UL; ix < kNumberOfKeys; ++ix )
+    {
+        keys.push_back( benchmark_utils::gen_random( static_cast<int>( keySize ) ) );
+    }
+    return keys;
+}
+}
+
+// Hash cost alone, to compare with the lookup below on the same key size
+template<typename Hasher>
+static void HashCost( benchmark::State & state )
+{
+    const auto keys = gen_keys( state.range( 0 ) );
+    auto ix = 0UL;
+    for ( auto _ : state )
+    {
+        ix = ix >= keys.size() ? 0UL : ix;
+        benchmark::DoNotOptimize( Hasher::hash( keys[ix] ) );
+        ++ix;
+    }
+}
+
+// Whole lookup, hash included, over a cache much larger than L2
+template<typename Cache>
+static void HashLookupCost( benchmark::State & state )
+{
+    const auto keys = gen_keys( state.range( 0 ) );
+    Cache cache( 35U, kNumberOfKeys * 2, 0.5, std::make_unique<MallocMemoryHandler>() );
+    for ( const auto & key : keys )
+    {
+        cache.put( key, key );
+    }
+    cache.finalize();
+
+    auto ix = 0UL;
+    for ( auto _ : state )
+    {
+        ix = ix >= keys.size() ? 0UL : ix;
+        benchmark::DoNotOptimize( cache.get( keys[ix] ) );
+        benchmark::ClobberMemory();
+        ++ix;
+    }
+}
+
+BENCHMARK_TEMPLATE( HashCost, Xxh3Hasher )->RangeMultiplier( 2 )->Range( 8, 64 );
+BENCHMARK_TEMPLATE( HashCost, WyHasher )->RangeMultiplier( 2 )->Range( 8, 64 );
+BENCHMARK_TEMPLATE( HashLookupCost, LinearProbeCache )->RangeMultiplier( 2 )->Range( 8, 64 );
+BENCHMARK_TEMPLATE( HashLookupCost, LinearProbeWyhashCache )->RangeMultiplier( 2 )->Range( 8, 64 );
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <axoncache/cache/LinearProbeCache.h>
+#include <axoncache/cache/probe/LinearProbe.h>
+#include <axoncache/memory/MallocMemoryHandler.h>
+#include <benchmark/benchmark.h>
+#include "CacheBenchmarkUtils.h"
+
+#include <string>
+#include <vector>
+using namespace axoncache;
+
+namespace
+{
+constexpr uint64_t kNumberOfKeys = 200000UL;
+constexpr size_t kFloatListSize = 24U;
+}
+
+// Dot products of FloatList values with packed records or values aligned on state.range( 0 )
+// bytes. Keys of 10 to 19 bytes leave packed values at any alignment. The dataSize counter
+// reports what the padding costs.
+static void AlignedFloatListDotProduct( benchmark::State & state )
+{
+    const auto headerFlags = linear::valueAlignmentHeaderFlag( state.range( 0 ) );
+    LinearProbeCache cache( 35U, kNumberOfKeys * 2, 0.5, std::make_unique<MallocMemoryHandler>(), headerFlags );
+    std::vector<std::string> keys;
+    keys.reserve( kNumberOfKeys );
+    std::vector<float> floats( kFloatListSize );
+    for ( const auto & [key, value] : benchmark_utils::gen_random_str_map( kNumberOfKeys ) )
+    {
+        for ( size_t i = 0; i < floats.size(); ++i )
+        {
+            floats[i] = static_cast<float>( value.size() + i );
+        }
+        cache.put( key, floats );
+        keys.push_back( key );
+    }
+    cache.finalize();
+
+    const std::vector<float> query( kFloatListSize, 0.5F );
+    auto ix = 0UL;
+    for ( auto _ : state )
+    {
+        benchmark::DoNotOptimize( cache.dotProduct( keys[ix], query ) );
+        benchmark::ClobberMemory();
+        ix = ( ix + 7919UL ) % keys.size();
+    }
+    state.counters["dataSize"] = static_cast<double>( cache.dataSize() );
+}
+
+// Same for Int64 values, which are aligned on 8 bytes at most
+static void AlignedInt64Lookup( benchmark::State & state )
+{
+    const auto headerFlags = linear::valueAlignmentHeaderFlag( state.range( 0 ) );
+    LinearProbeCache cache( 35U, kNumberOfKeys * 2, 0.5, std::make_unique<MallocMemoryHandler>(), headerFlags );
+    std::vector<std::string> keys;
+    keys.reserve( kNumberOfKeys );
+    for ( const auto & [key, value] : benchmark_utils::gen_random_str_map( kNumberOfKeys ) )
+    {
+        auto number = static_cast<int64_t>( value.size() );
+        cache.put( key, number );
+        keys.push_back( key );
+    }
+    cache.finalize();
+
+    auto ix = 0UL;
+    for ( auto _ : state )
+    {
+        benchmark::DoNotOptimize( cache.getInt64( keys[ix] ) );
+        benchmark::ClobberMemory();
+        ix = ( ix + 7919UL ) % keys.size();
+    }
+    state.counters["dataSize"] = static_cast<double>( cache.dataSize() );
+}
+
+BENCHMARK( AlignedFloatListDotProduct )->Arg( 0 )->Arg( 8 )->Arg( 16 );
+BENCHMARK( AlignedInt64Lookup )->Arg( 0 )->Arg( 8 );
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <axoncache/cache/LinearProbeCache.h>
+#include <axoncache/memory/MallocMemoryHandler.h>
+#include <benchmark/benchmark.h>
+#include "CacheBenchmarkUtils.h"
+
+#include <string>
+#include <vector>
+using namespace axoncache;
+
+namespace
+{
+constexpr uint64_t kNumberOfKeys = 100000UL;
+
+auto gen_json_value( const std::string & id ) -> std::string
+{
+    return R"({"campaign_id":")" + id + R"(","country":"US","platform":"android","bid_floor":0.25,"creative_type":"video","enabled":true})";
+}
+}
+
+// String lookups of JSON-like values, plain or compressed against the trained dictionary. The
+// bytes counter reports the data space, the working set the compression shrinks.
+static void JsonValueLookup( benchmark::State & state )
+{
+    const auto headerFlags = state.range( 0 ) != 0 ? Constants::HeaderFlag::kCompressedValues : 0U;
+    LinearProbeCache cache( 35U, kNumberOfKeys * 2, 0.5, std::make_unique<MallocMemoryHandler>(), headerFlags );
+    std::vector<std::string> keys;
+    keys.reserve( kNumberOfKeys );
+    for ( auto ix = 0UL; ix < kNumberOfKeys; ++ix )
+    {
+        keys.push_back( benchmark_utils::gen_random( 16 ) );
+        cache.put( keys.back(), gen_json_value( benchmark_utils::gen_random( 12 ) ) );
+    }
+    cache.finalize();
+
+    auto ix = 0UL;
+    std::string buffer;
+    for ( auto _ : state )
+    {
+        ix = ix >= keys.size() ? 0UL : ix;
+        benchmark::DoNotOptimize( cache.getString( keys[ix], buffer ) );
+        benchmark::ClobberMemory();
+        ++ix;
+    }
+    state.counters["dataSize"] = static_cast<double>( cache.dataSize() );
+}
+
+BENCHMARK( JsonValueLookup )->Arg( 0 )->Arg( 1 );
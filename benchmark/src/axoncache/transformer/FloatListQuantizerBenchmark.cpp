@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <axoncache/cache/LinearProbeCache.h>
+#include <axoncache/memory/MallocMemoryHandler.h>
+#include <axoncache/transformer/FloatListQuantizer.h>
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+using namespace axoncache;
+
+namespace
+{
+constexpr uint64_t kNumberOfKeys = 20000UL;
+constexpr size_t kDimensions = 256U;
+}
+
+// getFloatVector of 256 float embeddings stored as FloatList (range(0) = 7) or quantized, the
+// quantized values read 2 to 4 times fewer bytes and the SIMD dequantization has to pay for itself
+static void GetFloatVector( benchmark::State & state )
+{
+    const auto type = static_cast<CacheValueType>( state.range( 0 ) );
+    LinearProbeCache cache( 35U, kNumberOfKeys * 2, 0.5, std::make_unique<MallocMemoryHandler>() );
+    std::vector<std::string> keys;
+    keys.reserve( kNumberOfKeys );
+    std::vector<float> values( kDimensions );
+    for ( uint64_t i = 0; i < kNumberOfKeys; ++i )
+    {
+        for ( size_t j = 0; j < kDimensions; ++j )
+        {
+            values[j] = std::sin( static_cast<float>( i * kDimensions + j ) );
+        }
+        keys.push_back( "embedding_" + std::to_string( i ) );
+        cache.put( keys.back(), values, type );
+    }
+    cache.finalize();
+
+    auto ix = 0UL;
+    for ( auto _ : state )
+    {
+        benchmark::DoNotOptimize( cache.getFloatVector( keys[ix] ) );
+        ix = ( ix + 7919UL ) % keys.size();
+    }
+    state.SetLabel( to_string( type ) + " " + std::string{ FloatListQuantizer::isaName() } );
+}
+
+BENCHMARK( GetFloatVector )->Arg( static_cast<int64_t>( CacheValueType::FloatList ) )->Arg( static_cast<int64_t>( CacheValueType::Float16List ) )->Arg( static_cast<int64_t>( CacheValueType::BFloat16List ) )->Arg( static_cast<int64_t>( CacheValueType::Int8List ) );
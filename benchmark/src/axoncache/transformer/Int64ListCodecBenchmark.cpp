@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <axoncache/cache/LinearProbeCache.h>
+#include <axoncache/common/StringUtils.h>
+#include <axoncache/memory/MallocMemoryHandler.h>
+#include <axoncache/transformer/Int64ListCodec.h>
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+using namespace axoncache;
+
+namespace
+{
+constexpr uint64_t kNumberOfKeys = 20000UL;
+constexpr size_t kIdsPerKey = 500U;
+
+// Sorted campaign like ids, a few hundred apart, as one Int64List (range(0) = 11) or as the
+// StringList of their decimal strings
+auto buildIdLists( LinearProbeCache & cache, CacheValueType type, std::vector<std::string> & keys ) -> std::vector<std::vector<int64_t>>
+{
+    std::vector<std::vector<int64_t>> lists;
+    keys.reserve( kNumberOfKeys );
+    for ( uint64_t i = 0; i < kNumberOfKeys; ++i )
+    {
+        std::vector<int64_t> ids( kIdsPerKey );
+        auto id = static_cast<int64_t>( 1000000000UL + i * 7919UL );
+        for ( size_t j = 0; j < kIdsPerKey; ++j )
+        {
+            id += static_cast<int64_t>( ( i * 31U + j * 17U ) % 400U ) + 1;
+            ids[j] = id;
+        }
+        keys.push_back( "ids_" + std::to_string( i ) );
+        if ( type == CacheValueType::Int64List )
+        {
+            cache.put( keys.back(), ids );
+        }
+        else
+        {
+            std::vector<std::string> strings;
+            for ( const auto value : ids )
+            {
+                strings.push_back( std::to_string( value ) );
+            }
+            cache.put( keys.back(), std::vector<std::string_view>( strings.begin(), strings.end() ) );
+        }
+        lists.push_back( std::move( ids ) );
+    }
+    cache.finalize();
+    return lists;
+}
+}
+
+// Sum of every id of a list: getVector and toLong on each element of a StringList, or a walk
+// over the getInt64List iterator. The dataSize counter compares the value sizes.
+static void ConsumeIdList( benchmark::State & state )
+{
+    const auto type = static_cast<CacheValueType>( state.range( 0 ) );
+    LinearProbeCache cache( 35U, kNumberOfKeys * 2, 0.5, std::make_unique<MallocMemoryHandler>() );
+    std::vector<std::string> keys;
+    buildIdLists( cache, type, keys );
+
+    auto ix = 0UL;
+    for ( auto _ : state )
+    {
+        int64_t sum = 0;
+        if ( type == CacheValueType::Int64List )
+        {
+            for ( const auto id : cache.getInt64List( keys[ix] ) )
+            {
+                sum += id;
+            }
+        }
+        else
+        {
+            for ( const auto id : cache.getVector( keys[ix] ) )
+            {
+                sum += StringUtils::toLong( id );
+            }
+        }
+        benchmark::DoNotOptimize( sum );
+        ix = ( ix + 7919UL ) % keys.size();
+    }
+    state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * kIdsPerKey ) );
+    state.SetLabel( to_string( type ) + " " + std::string{ Int64ListCodec::isaName() } );
+    state.counters["dataSize"] = static_cast<double>( cache.dataSize() );
+}
+
+// Membership of one id: a scan of the StringList elements, or containsInt64
+static void ContainsId( benchmark::State & state )
+{
+    const auto type = static_cast<CacheValueType>( state.range( 0 ) );
+    LinearProbeCache cache( 35U, kNumberOfKeys * 2, 0.5, std::make_unique<MallocMemoryHandler>() );
+    std::vector<std::string> keys;
+    const auto lists = buildIdLists( cache, type, keys );
+
+    auto ix = 0UL;
+    for ( auto _ : state )
+    {
+        const auto id = lists[ix][ix % kIdsPerKey] + static_cast<int64_t>( ix % 2U );
+        if ( type == CacheValueType::Int64List )
+        {
+            benchmark::DoNotOptimize( cache.containsInt64( keys[ix], id ) );
+        }
+        else
+        {
+            bool isFound = false;
+            for ( const auto element : cache.getVector( keys[ix] ) )
+            {
+                if ( StringUtils::toLong( element ) == id )
+                {
+                    isFound = true;
+                    break;
+                }
+            }
+            benchmark::DoNotOptimize( isFound );
+        }
+        ix = ( ix + 7919UL ) % keys.size();
+    }
+    state.SetLabel( to_string( type ) );
+}
+
+BENCHMARK( ConsumeIdList )->Arg( static_cast<int64_t>( CacheValueType::StringList ) )->Arg( static_cast<int64_t>( CacheValueType::Int64List ) );
+BENCHMARK( ContainsId )->Arg( static_cast<int64_t>( CacheValueType::StringList ) )->Arg( static_cast<int64_t>( CacheValueType::Int64List ) );
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <axoncache/cache/LinearProbeCache.h>
+#include <axoncache/common/StringUtils.h>
+#include <axoncache/memory/MallocMemoryHandler.h>
+#include <axoncache/transformer/RoaringBitmap.h>
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+using namespace axoncache;
+
+namespace
+{
+constexpr uint64_t kNumberOfKeys = 2000UL;
+constexpr size_t kSegmentsPerKey = 3000U;
+
+// Segment ids of users, 3000 out of the first million, as a Bitmap (range(0) = 12) or as the
+// StringList of their decimal strings
+auto buildSegments( LinearProbeCache & cache, CacheValueType type, std::vector<std::string> & keys ) -> void
+{
+    keys.reserve( kNumberOfKeys );
+    for ( uint64_t i = 0; i < kNumberOfKeys; ++i )
+    {
+        std::vector<int64_t> segments( kSegmentsPerKey );
+        for ( size_t j = 0; j < kSegmentsPerKey; ++j )
+        {
+            segments[j] = static_cast<int64_t>( ( i * 7919U + j * 331U ) % 1000000U );
+        }
+        keys.push_back( "user_" + std::to_string( i ) );
+        if ( type == CacheValueType::Bitmap )
+        {
+            cache.put( keys.back(), segments, CacheValueType::Bitmap );
+        }
+        else
+        {
+            std::vector<std::string> strings;
+            for ( const auto value : segments )
+            {
+                strings.push_back( std::to_string( value ) );
+            }
+            cache.put( keys.back(), std::vector<std::string_view>( strings.begin(), strings.end() ) );
+        }
+    }
+    cache.finalize();
+}
+
+// What a caller does with a StringList today: parse it into a hash set
+auto toSet( const std::vector<std::string_view> & elements ) -> std::unordered_set<int64_t>
+{
+    std::unordered_set<int64_t> set;
+    set.reserve( elements.size() );
+    for ( const auto element : elements )
+    {
+        set.insert( StringUtils::toLong( element ) );
+    }
+    return set;
+}
+}
+
+// Membership of one segment: a StringList parsed into a set, or bitmapContains
+static void SegmentContains( benchmark::State & state )
+{
+    const auto type = static_cast<CacheValueType>( state.range( 0 ) );
+    LinearProbeCache cache( 35U, kNumberOfKeys * 2, 0.5, std::make_unique<MallocMemoryHandler>() );
+    std::vector<std::string> keys;
+    buildSegments( cache, type, keys );
+
+    auto ix = 0UL;
+    for ( auto _ : state )
+    {
+        const auto segment = static_cast<uint32_t>( ( ix * 331U ) % 1000000U );
+        if ( type == CacheValueType::Bitmap )
+        {
+            benchmark::DoNotOptimize( cache.bitmapContains( keys[ix], segment ) );
+        }
+        else
+        {
+            benchmark::DoNotOptimize( toSet( cache.getVector( keys[ix] ) ).contains( segment ) );
+        }
+        ix = ( ix + 7919UL ) % keys.size();
+    }
+    state.SetLabel( to_string( type ) );
+    state.counters["dataSize"] = static_cast<double>( cache.dataSize() );
+}
+
+// Segments two users share: two StringLists parsed into sets and probed, or bitmapIntersectCount
+static void SegmentIntersectCount( benchmark::State & state )
+{
+    const auto type = static_cast<CacheValueType>( state.range( 0 ) );
+    LinearProbeCache cache( 35U, kNumberOfKeys * 2, 0.5, std::make_unique<MallocMemoryHandler>() );
+    std::vector<std::string> keys;
+    buildSegments( cache, type, keys );
+
+    auto ix = 0UL;
+    for ( auto _ : state )
+    {
+        const auto & other = keys[( ix + 1U ) % keys.size()];
+        if ( type == CacheValueType::Bitmap )
+        {
+            benchmark::DoNotOptimize( cache.bitmapIntersectCount( keys[ix], other ) );
+        }
+        else
+        {
+            const auto set = toSet( cache.getVector( keys[ix] ) );
+            uint64_t count = 0;
+            for ( const auto value : toSet( cache.getVector( other ) ) )
+            {
+                count += set.contains( value ) ? 1U : 0U;
+            }
+            benchmark::DoNotOptimize( count );
+        }
+        ix = ( ix + 7919UL ) % keys.size();
+    }
+    state.SetLabel( to_string( type ) + " " + std::string{ RoaringBitmap::isaName() } );
+}
+
+BENCHMARK( SegmentContains )->Arg( static_cast<int64_t>( CacheValueType::StringList ) )->Arg( static_cast<int64_t>( CacheValueType::Bitmap ) );
+BENCHMARK( SegmentIntersectCount )->Arg( static_cast<int64_t>( CacheValueType::StringList ) )->Arg( static_cast<int64_t>( CacheValueType::Bitmap ) );
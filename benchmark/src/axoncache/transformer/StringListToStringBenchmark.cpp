@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <axoncache/transformer/StringListToString.h>
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+using namespace axoncache;
+
+namespace
+{
+auto listOf( size_t size ) -> std::vector<std::string>
+{
+    std::vector<std::string> elements;
+    for ( size_t i = 0; i < size; ++i )
+    {
+        elements.push_back( "element_" + std::to_string( i ) );
+    }
+    return elements;
+}
+}
+
+// One element of a list of range(0) elements, by decoding the list as getVector did
+static void StringListDecodeThenIndex( benchmark::State & state )
+{
+    const auto elements = listOf( state.range( 0 ) );
+    const auto str = StringListToString::transform( std::vector<std::string_view>( elements.begin(), elements.end() ) );
+    auto ix = 0UL;
+    for ( auto _ : state )
+    {
+        benchmark::DoNotOptimize( StringListToString::transform( std::string_view{ str } )[ix] );
+        ix = ( ix + 7919UL ) % elements.size();
+    }
+}
+
+static void StringListAt( benchmark::State & state )
+{
+    const auto elements = listOf( state.range( 0 ) );
+    const auto str = StringListToString::transform( std::vector<std::string_view>( elements.begin(), elements.end() ) );
+    auto ix = 0UL;
+    for ( auto _ : state )
+    {
+        benchmark::DoNotOptimize( StringListToString::at( str, ix ) );
+        ix = ( ix + 7919UL ) % elements.size();
+    }
+}
+
+static void StringListIndexedAt( benchmark::State & state )
+{
+    const auto elements = listOf( state.range( 0 ) );
+    const auto str = StringListToString::transformIndexed( std::vector<std::string_view>( elements.begin(), elements.end() ) );
+    auto ix = 0UL;
+    for ( auto _ : state )
+    {
+        benchmark::DoNotOptimize( StringListToString::at( str, ix ) );
+        ix = ( ix + 7919UL ) % elements.size();
+    }
+}
+
+BENCHMARK( StringListDecodeThenIndex )->Arg( 16 )->Arg( 4096 );
+BENCHMARK( StringListAt )->Arg( 16 )->Arg( 4096 );
+BENCHMARK( StringListIndexedAt )->Arg( 16 )->Arg( 4096 );
@@ -28,12 +28,17 @@ func (e *OutOfDataSpaceError) Error() string {
 
 const (
 	// enum from "alcache/domain/CacheValue.h"
-	StringValueType     int8 = 0
-	StringListValueType      = 1
-	BoolValueType            = 2
-	Int64ValueType           = 3
-	DoubleValueType          = 4
-	FloatListValueType       = 7
+	StringValueType       int8 = 0
+	StringListValueType        = 1
+	BoolValueType              = 2
+	Int64ValueType             = 3
+	DoubleValueType            = 4
+	FloatListValueType         = 7
+	Float16ListValueType       = 8
+	BFloat16ListValueType      = 9
+	Int8ListValueType          = 10
+	Int64ListValueType         = 11
+	BitmapValueType            = 12
 
 	// Special type to bring old C-Cache behavior
 	StringNoNullType = 127
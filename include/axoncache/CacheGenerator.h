@@ -45,6 +45,9 @@ class CacheGenerator
         uint16_t offsetBits;
         uint64_t numberOfKeySlots;
         double maxLoadFactor;
+        uint32_t headerFlags;
+        uint16_t hashFuncId;
+        uint64_t frequentValues;
 
         std::string cacheName;
         CacheType cacheType;
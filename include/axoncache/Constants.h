@@ -19,6 +19,10 @@ namespace axoncache::Constants
 [[maybe_unused]] constexpr uint16_t kMaxLinearProbeOffsetBits = 38; // reference upto 274,877,906,944, i.e. 274GB
 [[maybe_unused]] constexpr unsigned long kMaxCacheNameSize = 32;
 
+// CacheHeader::version of files that readers of version 2.5 read right. Writers keep it unless the
+// file uses something those readers would misread, see CacheBase::formatVersion.
+[[maybe_unused]] constexpr uint16_t kBaseFormatVersion = 2050;
+
 namespace ProbeStatus
 {
 [[maybe_unused]] constexpr int64_t AXONCACHE_KEY_NOT_FOUND = -1;
@@ -30,6 +34,61 @@ namespace HashFuncId
 [[maybe_unused]] constexpr uint16_t UNKNOWN = 0;
 [[maybe_unused]] constexpr uint16_t XXHASH64 = 1;
 [[maybe_unused]] constexpr uint16_t XXH3 = 2;
+[[maybe_unused]] constexpr uint16_t WYHASH = 3;
+}
+
+// Bits of CacheHeader::flags, all 0 in files written before flags existed
+namespace HeaderFlag
+{
+// Every probe cluster is ordered by home slot (Robin Hood placement) and maxCollisions
+// holds the longest displacement, so a lookup can give up after maxCollisions + 1 slots.
+// The layout is still valid for readers that ignore the flag.
+[[maybe_unused]] constexpr uint32_t kRobinHood = 1U << 0;
+
+// Home slot mapping of linear probe caches, see SlotMapping.h. Neither bit means modulo. Readers
+// must know about it to find any key.
+[[maybe_unused]] constexpr uint32_t kSlotMappingFastRange = 1U << 1;
+[[maybe_unused]] constexpr uint32_t kSlotMappingPow2Mask = 1U << 2;
+
+// A BlockedBloomFilter over the key hashes sits between the keySpace and the records, sized from
+// numberOfEntries. Slot offsets include it, so readers that ignore the flag skip over it.
+[[maybe_unused]] constexpr uint32_t kNegativeLookupFilter = 1U << 3;
+
+// Records store a namespace id and the key after its first '.' instead of the whole key, see
+// NamespaceTable. The table follows the keySpace, after the negative lookup filter if any.
+// Readers must know about it to find any key.
+[[maybe_unused]] constexpr uint32_t kNamespacePrefix = 1U << 4;
+
+// Records store a 16-byte fingerprint instead of the key, see KeyFingerprint. Lookups accept a
+// ~2^-128 chance of a false positive per record compared. Readers must know about it.
+[[maybe_unused]] constexpr uint32_t kKeyFingerprint = 1U << 5;
+
+// String values are compressed one by one against a dictionary trained on them, see
+// ValueDictionary. The dictionary follows the namespace table, or the filter, or the keySpace.
+// Readers must know about it to read the compressed values.
+[[maybe_unused]] constexpr uint32_t kCompressedValues = 1U << 6;
+
+// StringList values are written with an offset table, so one element is read without decoding
+// the list, see StringListToString. Readers tell the encodings apart by the value itself, but
+// readers from before this flag see the lists as empty, so they must not load such files.
+[[maybe_unused]] constexpr uint32_t kIndexedStringLists = 1U << 7;
+
+// A value already written for another record is written once and the later records point to it,
+// see linear::kSharedValueFlags. Readers must know about it to read the shared values.
+[[maybe_unused]] constexpr uint32_t kSharedValues = 1U << 8;
+
+// Zeroed padding before a record makes its Int64, Double and FloatList value start on an 8 or
+// 16-byte boundary of the file, see linear::valueAlignment. Int64 and Double values need no more
+// than 8. Neither bit means packed records. Readers do not need to know about it.
+[[maybe_unused]] constexpr uint32_t kAlignedValues8 = 1U << 9;
+[[maybe_unused]] constexpr uint32_t kAlignedValues16 = 1U << 10;
+
+// Every bit above. Loaders reject files with any other bit set, whatever it would change.
+[[maybe_unused]] constexpr uint32_t kKnownFlags = ( 1U << 11 ) - 1U;
+
+// Flags that readers of kBaseFormatVersion ignore and then misread the file. Files with any of
+// them set are written with the runtime version, which those readers refuse to load.
+[[maybe_unused]] constexpr uint32_t kIncompatibleFlags = kSlotMappingFastRange | kSlotMappingPow2Mask | kNamespacePrefix | kKeyFingerprint | kCompressedValues | kIndexedStringLists | kSharedValues;
 }
 
 namespace ConfKey
@@ -45,7 +104,18 @@ namespace ConfKey
 [[maybe_unused]] const std::string kOffsetBits = "axoncache.offset_bits";
 [[maybe_unused]] const std::string kKeySlots = "axoncache.key_slots";
 [[maybe_unused]] const std::string kCacheUpdateIntervalMs = "axoncache.update_interval_ms";
-[[maybe_unused]] const std::string kMaxLoadFactor = "axoncache.max_load_factor"; // < 0.8. preferably 0.5 for linear probe
+[[maybe_unused]] const std::string kMaxLoadFactor = "axoncache.max_load_factor";               // < 0.8. preferably 0.5 for linear probe
+[[maybe_unused]] const std::string kRobinHood = "axoncache.robin_hood";                        // linear probe only
+[[maybe_unused]] const std::string kSlotMapping = "axoncache.slot_mapping";                    // modulo, fastrange or pow2. linear probe only
+[[maybe_unused]] const std::string kNegativeLookupFilter = "axoncache.negative_lookup_filter"; // linear probe only
+[[maybe_unused]] const std::string kNamespacePrefix = "axoncache.namespace_prefix";             // linear probe only
+[[maybe_unused]] const std::string kKeyFingerprint = "axoncache.key_fingerprint";               // linear probe only
+[[maybe_unused]] const std::string kCompressedValues = "axoncache.compressed_values";           // linear probe only
+[[maybe_unused]] const std::string kIndexedStringLists = "axoncache.indexed_string_lists";
+[[maybe_unused]] const std::string kSharedValues = "axoncache.shared_values";                  // linear probe only
+[[maybe_unused]] const std::string kValueAlignment = "axoncache.value_alignment";              // 0, 8 or 16. linear probe only
+[[maybe_unused]] const std::string kFrequentValues = "axoncache.frequent_values";              // max values to detect, linear probe dedup only
+[[maybe_unused]] const std::string kHashFunc = "axoncache.hash_func";                          // xxh3 or wyhash. wyhash is linear probe only
 
 [[maybe_unused]] const std::string kControlCharLine = "axoncache.control_char.line";
 [[maybe_unused]] const std::string kControlCharKeyValue = "axoncache.control_char.key_value";
@@ -69,6 +139,7 @@ namespace ConfDefault
 [[maybe_unused]] constexpr uint64_t kMemoryCapcityBytes = 1024;
 [[maybe_unused]] constexpr uint64_t kCacheUpdateIntervalMs = 300000UL; // 5 mins
 [[maybe_unused]] constexpr double kLinearProbeMaxLoadFactor = 0.8;
+[[maybe_unused]] constexpr double kCuckooMaxLoadFactor = 0.95;
 [[maybe_unused]] constexpr double kMaxLoadFactor = 0.5;
 
 [[maybe_unused]] constexpr char kControlCharLine = '\036';
@@ -83,5 +154,6 @@ namespace Limit
 [[maybe_unused]] constexpr uint64_t kVectorLength = ( 1 << 16 ) - 1;
 [[maybe_unused]] constexpr uint64_t kVectorElementLength = ( 1 << 16 ) - 1;
 [[maybe_unused]] constexpr uint64_t kValueLength = ( 1 << 24 ) - 1;
+[[maybe_unused]] constexpr uint64_t kFrequentValues = 1 << 20;
 }
 }
@@ -8,8 +8,10 @@
 #include <vector>
 #include <ostream>
 #include <memory>
+#include <atomic>
 #include <axoncache/version.h>
 #include "axoncache/cache/CacheType.h"
+#include "axoncache/domain/CacheValue.h"
 #include "axoncache/memory/MemoryHandler.h"
 #include "axoncache/Constants.h"
 
@@ -21,7 +23,8 @@ class CacheBase
 {
   public:
     CacheBase( std::unique_ptr<MemoryHandler> handler ) :
-        mMemoryHandler( std::move( handler ) )
+        mMemoryHandler( std::move( handler ) ),
+        mInstanceId( nextInstanceId() )
     {
     }
 
@@ -35,6 +38,9 @@ class CacheBase
     virtual auto put( std::string_view key, int64_t & value ) -> PutStats = 0;
     virtual auto put( std::string_view key, double & value ) -> PutStats = 0;
     virtual auto put( std::string_view key, const std::vector<float> & value ) -> PutStats = 0;
+    virtual auto put( std::string_view key, const std::vector<float> & value, CacheValueType listType ) -> PutStats = 0; // FloatList or a quantized list type
+    virtual auto put( std::string_view key, const std::vector<int64_t> & value ) -> PutStats = 0;
+    virtual auto put( std::string_view key, const std::vector<int64_t> & value, CacheValueType listType ) -> PutStats = 0; // Int64List or Bitmap
 
     [[nodiscard]] virtual auto type() const -> CacheType = 0;
     [[nodiscard]] virtual auto hashcodeBits() const -> uint16_t = 0;
@@ -50,9 +56,24 @@ class CacheBase
     [[nodiscard]] virtual auto size() const -> uint64_t = 0;     // total size in bytes
     [[nodiscard]] virtual auto headerInfo() const -> std::vector<std::pair<std::string, std::string>> = 0;
 
+    [[nodiscard]] virtual auto headerFlags() const -> uint32_t // Constants::HeaderFlag bits
+    {
+        return 0U;
+    }
+
+    // Called once every entry is in, right before the header and data are written
+    virtual auto finalize() -> void
+    {
+    }
+
     virtual auto output( std::ostream & output ) const -> void = 0;
 
     [[nodiscard]] constexpr auto virtual version() const -> uint16_t final
+    {
+        return runtimeVersion();
+    }
+
+    [[nodiscard]] static constexpr auto runtimeVersion() -> uint16_t
     {
         // Version has to fit in a uint16_t so limit max version of each part
         static_assert( AXONCACHE_VERSION_MAJOR < 64, "Major version version number limit reached" );
@@ -61,6 +82,20 @@ class CacheBase
         return ( AXONCACHE_VERSION_MAJOR * 1000 ) + ( AXONCACHE_VERSION_MINOR * 10 ) + AXONCACHE_VERSION_PATCH;
     }
 
+    // Written to CacheHeader::version. Loaders accept files from kBaseFormatVersion up to their own
+    // version, so a file keeps the base version unless older readers would misread it.
+    [[nodiscard]] virtual auto formatVersion() const -> uint16_t
+    {
+        return Constants::kBaseFormatVersion;
+    }
+
+    // Unique for the life of the process, never reused by another cache object. Per-thread front caches
+    // tag their entries with it, so a cache swapped for a newly loaded one never sees the old entries.
+    [[nodiscard]] auto instanceId() const -> uint64_t
+    {
+        return mInstanceId;
+    }
+
     // Get/contains are explicitly not mark virtual. In production we do not want to pay the cost of the virtual call.
     /* auto get( std::string_view key, std::string_view defaultValue ) const -> std::string_view; */
     /* auto get( std::string_view key, std::vector<std::string_view> defaultValue ) const -> std::vector<std::string_view>; */
@@ -78,5 +113,14 @@ class CacheBase
     }
 
     std::unique_ptr<MemoryHandler> mMemoryHandler;
+
+  private:
+    static auto nextInstanceId() -> uint64_t
+    {
+        static std::atomic<uint64_t> instanceCount{ 0U };
+        return instanceCount.fetch_add( 1U, std::memory_order_relaxed ) + 1U;
+    }
+
+    uint64_t mInstanceId;
 };
 } // axoncache
@@ -16,6 +16,11 @@ enum class CacheType
     LINEAR_PROBE,
     LINEAR_PROBE_DEDUP,
     LINEAR_PROBE_DEDUP_TYPED,
+    LINEAR_PROBE_SIMD,
+    PERFECT_HASH,
+    CUCKOO,
+    NUMERIC,
+    EMBEDDING,
 };
 }
 
@@ -35,6 +40,16 @@ enum class CacheType
             return "LINEAR_PROBE_DEDUP";
         case axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED:
             return "LINEAR_PROBE_DEDUP_TYPED";
+        case axoncache::CacheType::LINEAR_PROBE_SIMD:
+            return "LINEAR_PROBE_SIMD";
+        case axoncache::CacheType::PERFECT_HASH:
+            return "PERFECT_HASH";
+        case axoncache::CacheType::CUCKOO:
+            return "CUCKOO";
+        case axoncache::CacheType::NUMERIC:
+            return "NUMERIC";
+        case axoncache::CacheType::EMBEDDING:
+            return "EMBEDDING";
     }
     return "NONE";
 }
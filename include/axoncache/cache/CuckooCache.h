@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include "axoncache/cache/base/HashedCacheBase.h"
+#include "axoncache/cache/probe/CuckooProbe.h"
+#include "axoncache/cache/value/LinearProbeValue.h"
+#include "axoncache/cache/hasher/Xxh3Hasher.h"
+
+namespace axoncache
+{
+using CuckooCacheBase = HashedCacheBase<Xxh3Hasher, CuckooProbe<sizeof( uint64_t )>, LinearProbeValue, CacheType::CUCKOO>;
+
+// Bounded lookup cost at high load factors, see CuckooProbe. The requested number of key
+// slots is rounded up to whole buckets, plus the few padding slots that align them.
+class CuckooCache : public CuckooCacheBase
+{
+  public:
+    CuckooCache( uint16_t offsetBits, uint64_t numberOfKeySlots, double maxLoadFactor, std::unique_ptr<MemoryHandler> memoryHandler, uint32_t headerFlags = 0U ) :
+        CuckooCacheBase( offsetBits, cuckoo::keySlotsFor( numberOfKeySlots ), checkLoadFactor( maxLoadFactor ), std::move( memoryHandler ), headerFlags )
+    {
+    }
+
+    CuckooCache( const CacheHeader & header, std::unique_ptr<MemoryHandler> memoryHandler ) :
+        CuckooCacheBase( header, std::move( memoryHandler ) )
+    {
+    }
+
+  private:
+    static auto checkLoadFactor( double maxLoadFactor ) -> double
+    {
+        if ( maxLoadFactor > Constants::ConfDefault::kCuckooMaxLoadFactor )
+        {
+            throw std::runtime_error( "LoadFactor for CUCKOO can't greater than " + std::to_string( Constants::ConfDefault::kCuckooMaxLoadFactor ) );
+        }
+        return maxLoadFactor;
+    }
+};
+}
@@ -0,0 +1,268 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <span>
+#include "axoncache/cache/base/HashedCacheBase.h"
+#include "axoncache/cache/probe/LinearProbe.h"
+#include "axoncache/cache/value/LinearProbeValue.h"
+#include "axoncache/cache/hasher/Xxh3Hasher.h"
+#include "axoncache/cache/key/KeyFingerprint.h"
+
+namespace axoncache
+{
+namespace embedding
+{
+// Key slot of an EMBEDDING cache
+struct Entry
+{
+    uint64_t tag;   // Key hash, 1 for a hash of 0, 0 is an empty slot
+    uint32_t check; // High half of KeyFingerprint::secondHash of the key
+    uint32_t row;   // Row of the value in the matrix
+};
+static_assert( sizeof( Entry ) == 16 );
+
+// Right after the entries, 0 dimension until the first put
+struct MatrixHeader
+{
+    uint32_t dimension;
+    uint32_t rowStride; // Floats from a row to the next, the dimension rounded up to kRowAlignment
+    uint64_t numberOfRows;
+};
+static_assert( sizeof( MatrixHeader ) == 16 );
+
+// Row 0 starts on a cache line of the file, so of the mmapped cache, and each row on a 32-byte
+// boundary after it: whole rows are aligned AVX loads
+constexpr uint64_t kMatrixAlignment = 64U;
+constexpr uint64_t kRowAlignment = 32U;
+}
+
+using EmbeddingCacheBase = HashedCacheBase<Xxh3Hasher, LinearProbe<sizeof( uint64_t )>, LinearProbeValue, CacheType::EMBEDDING>;
+
+// Linear probe cache of FloatList values that all have the same dimension, stored as one
+// row-major matrix: the data is one embedding::Entry per key slot, then the matrix. A key maps
+// to its row id in its slot, rows carry no record header, and gatherRows copies the rows of a
+// batch of keys into one buffer, the layout an inference runtime takes as input.
+//
+// The first put sets the dimension, values of another type or dimension are rejected. Keys are
+// not stored, a key matches on its hash and 32 bits of its second hash (see KeyFingerprint), a
+// false positive rate of about 2^-96 per compared entry. The FloatList getters, dotProduct,
+// scoreMany and topK read the rows in place. Only the slot mapping header flags are supported.
+class EmbeddingCache : public EmbeddingCacheBase
+{
+  public:
+    EmbeddingCache( uint16_t offsetBits, uint64_t numberOfKeySlots, double maxLoadFactor, std::unique_ptr<MemoryHandler> memoryHandler, uint32_t headerFlags = 0U );
+
+    EmbeddingCache( const CacheHeader & header, std::unique_ptr<MemoryHandler> memoryHandler );
+
+    // Entries beyond the keySpace size of LINEAR_PROBE, then the matrix
+    [[nodiscard]] auto dataSize() const -> uint64_t override
+    {
+        return memoryHandler()->dataSize() - mProbe.keyspaceSize();
+    }
+
+    // Floats per row, 0 before the first put
+    [[nodiscard]] auto dimension() const -> uint32_t
+    {
+        return matrixHeader().dimension;
+    }
+
+    [[nodiscard]] auto numberOfRows() const -> uint64_t
+    {
+        return matrixHeader().numberOfRows;
+    }
+
+    [[nodiscard]] auto contains( std::string_view key, uint64_t * foundHash = nullptr ) const -> bool
+    {
+        const auto hash = Xxh3Hasher::hash( key );
+        const auto * entry = find( key, hash );
+        setFoundHash( foundHash, hash, entry == nullptr ? Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND : 0 );
+        return entry != nullptr;
+    }
+
+    [[nodiscard]] auto contains( std::string_view key, KeyHash hash ) const -> bool
+    {
+        return find( key, hash.value ) != nullptr;
+    }
+
+    // Row of key, empty if missing
+    [[nodiscard]] auto getRow( std::string_view key ) const -> std::span<const float>
+    {
+        return rowOf( find( key, Xxh3Hasher::hash( key ) ) );
+    }
+
+    // Copies the row of each key to out, keys.size() * dimension() floats one row after the
+    // other, zeros for a missing key. found, when given, gets keys.size() flags. Returns the
+    // number of keys found. Keys go in batches: the entries of a batch are prefetched, then its
+    // rows, before the first copy, so the cache misses of the batch overlap.
+    auto gatherRows( std::span<const std::string_view> keys, float * out, bool * found = nullptr ) const -> size_t
+    {
+        const auto dimensionBytes = static_cast<size_t>( dimension() ) * sizeof( float );
+        std::array<uint64_t, kGetManyBatchSize> hashes{};
+        std::array<const float *, kGetManyBatchSize> rows{};
+        size_t foundCount = 0;
+        for ( size_t begin = 0; begin < keys.size(); begin += kGetManyBatchSize )
+        {
+            const auto count = std::min( kGetManyBatchSize, keys.size() - begin );
+            for ( size_t i = 0; i < count; ++i )
+            {
+                hashes[i] = Xxh3Hasher::hash( keys[begin + i] );
+                __builtin_prefetch( entries() + homeSlot( mProbe.slotMapping(), hashes[i], mProbe.numberOfKeySlots() ) );
+            }
+            for ( size_t i = 0; i < count; ++i )
+            {
+                rows[i] = rowOf( find( keys[begin + i], hashes[i] ) ).data();
+                if ( rows[i] != nullptr )
+                {
+                    const auto * bytes = reinterpret_cast<const uint8_t *>( rows[i] );
+                    for ( size_t line = 0; line < dimensionBytes; line += embedding::kMatrixAlignment )
+                    {
+                        __builtin_prefetch( bytes + line );
+                    }
+                }
+            }
+            for ( size_t i = 0; i < count; ++i )
+            {
+                auto * target = out + ( begin + i ) * dimension();
+                if ( rows[i] != nullptr )
+                {
+                    std::memcpy( target, rows[i], dimensionBytes );
+                    ++foundCount;
+                }
+                else
+                {
+                    std::fill_n( target, dimension(), 0.0F );
+                }
+                if ( found != nullptr )
+                {
+                    found[begin + i] = rows[i] != nullptr;
+                }
+            }
+        }
+        return foundCount;
+    }
+
+  protected:
+    auto putInternal( std::string_view key, CacheValueType type, std::string_view value ) -> std::pair<bool, uint32_t> override;
+
+    // A value of another type is reported missing
+    [[nodiscard]] auto getInternal( std::string_view key, CacheValueType type, uint64_t * foundHash = nullptr ) const -> std::string_view override
+    {
+        bool isExist = false;
+        return getInternal( key, type, &isExist, foundHash );
+    }
+
+    [[nodiscard]] auto getInternal( std::string_view key, CacheValueType type, bool * isExist, uint64_t * foundHash = nullptr, [[maybe_unused]] std::string * buffer = nullptr ) const -> std::string_view override
+    {
+        const auto hash = Xxh3Hasher::hash( key );
+        const auto * entry = find( key, hash );
+        setFoundHash( foundHash, hash, entry == nullptr ? Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND : 0 );
+        const auto value = type == CacheValueType::FloatList ? withType( entry ).first : std::string_view{};
+        *isExist = !value.empty();
+        return value;
+    }
+
+    [[nodiscard]] auto getHashedInternal( std::string_view key, uint64_t hash, CacheValueType type, bool * isExist, [[maybe_unused]] std::string * buffer = nullptr ) const -> std::string_view override
+    {
+        const auto value = type == CacheValueType::FloatList ? withType( find( key, hash ) ).first : std::string_view{};
+        *isExist = !value.empty();
+        return value;
+    }
+
+    [[nodiscard]] auto getWithTypeInternal( std::string_view key, uint64_t * foundHash = nullptr, [[maybe_unused]] std::string * buffer = nullptr ) const -> std::pair<std::string_view, CacheValueType> override
+    {
+        const auto hash = Xxh3Hasher::hash( key );
+        const auto * entry = find( key, hash );
+        setFoundHash( foundHash, hash, entry == nullptr ? Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND : 0 );
+        return withType( entry );
+    }
+
+    [[nodiscard]] auto getWithTypeHashedInternal( std::string_view key, uint64_t hash, [[maybe_unused]] std::string * buffer = nullptr ) const -> std::pair<std::string_view, CacheValueType> override
+    {
+        return withType( find( key, hash ) );
+    }
+
+  private:
+    [[nodiscard]] static auto tagOf( uint64_t hash ) -> uint64_t
+    {
+        return hash == 0U ? 1U : hash;
+    }
+
+    [[nodiscard]] static auto checkOf( std::string_view key ) -> uint32_t
+    {
+        return static_cast<uint32_t>( KeyFingerprint::secondHash( key ) >> 32U );
+    }
+
+    // Offset of row 0 in the data, see kMatrixAlignment
+    [[nodiscard]] static auto rowsOffset( uint64_t numberOfKeySlots ) -> uint64_t
+    {
+        const auto matrixEnd = sizeof( CacheHeader ) + numberOfKeySlots * sizeof( embedding::Entry ) + sizeof( embedding::MatrixHeader );
+        return ( matrixEnd + embedding::kMatrixAlignment - 1U ) / embedding::kMatrixAlignment * embedding::kMatrixAlignment - sizeof( CacheHeader );
+    }
+
+    [[nodiscard]] auto entries() const -> const embedding::Entry *
+    {
+        return reinterpret_cast<const embedding::Entry *>( mKeySpacePtr );
+    }
+
+    [[nodiscard]] auto matrixHeader() const -> const embedding::MatrixHeader &
+    {
+        return *reinterpret_cast<const embedding::MatrixHeader *>( mKeySpacePtr + mProbe.numberOfKeySlots() * sizeof( embedding::Entry ) );
+    }
+
+    [[nodiscard]] auto rowOf( const embedding::Entry * entry ) const -> std::span<const float>
+    {
+        if ( entry == nullptr )
+        {
+            return {};
+        }
+        const auto & header = matrixHeader();
+        const auto * rows = reinterpret_cast<const float *>( mKeySpacePtr + rowsOffset( mProbe.numberOfKeySlots() ) );
+        return { rows + static_cast<uint64_t>( entry->row ) * header.rowStride, header.dimension };
+    }
+
+    [[nodiscard]] auto withType( const embedding::Entry * entry ) const -> std::pair<std::string_view, CacheValueType>
+    {
+        const auto row = rowOf( entry );
+        if ( row.empty() )
+        {
+            return {};
+        }
+        return { { reinterpret_cast<const char *>( row.data() ), row.size_bytes() }, CacheValueType::FloatList };
+    }
+
+    // Entry of key or nullptr, the second hash is only computed once a tag matches
+    [[nodiscard]] auto find( std::string_view key, uint64_t hash ) const -> const embedding::Entry *
+    {
+        const auto numberOfKeySlots = mProbe.numberOfKeySlots();
+        const auto tag = tagOf( hash );
+        const auto * slotEntries = entries();
+        bool isCheckComputed = false;
+        uint32_t check = 0U;
+        auto slotId = homeSlot( mProbe.slotMapping(), hash, numberOfKeySlots );
+        for ( uint32_t probes = 0; probes <= mHeader.maxCollisions; ++probes )
+        {
+            const auto & entry = slotEntries[slotId];
+            if ( entry.tag == 0U )
+            {
+                return nullptr;
+            }
+            if ( entry.tag == tag )
+            {
+                check = isCheckComputed ? check : checkOf( key );
+                isCheckComputed = true;
+                if ( entry.check == check )
+                {
+                    return &entry;
+                }
+            }
+            slotId = slotId + 1U == numberOfKeySlots ? 0U : slotId + 1U;
+        }
+        return nullptr;
+    }
+};
+}
@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include "axoncache/cache/hasher/KeyHash.h"
+#include "axoncache/domain/CacheValue.h"
+
+namespace axoncache
+{
+// Bounded per-thread front cache of resolved lookups, for skewed key popularity where a few
+// keys serve most of the reads. A hit costs the key hash and one 64-byte entry, no probe and
+// no record load. Missing keys are cached too, as entries that say the key does not exist, so a
+// hot missing key skips the probe as well. Long keys and entries of other caches fall through to
+// Cache.
+//
+// Every thread has its own direct-mapped table of NumberOfEntries, shared by all the views of
+// the same Cache type, so nothing is locked. Entries are tagged with the cache instanceId: a
+// cache swapped for a newly loaded one starts cold instead of returning the old values. An
+// entry only replaces a hotter one after enough misses on its position, so the Zipf tail does
+// not evict the head.
+//
+// Values point into the cache memory, the cache must outlive them and must no longer change.
+// Compressed values are not in the cache memory, so caches that have them can't be fronted.
+template<typename Cache, size_t NumberOfEntries = 1024>
+class HotKeyCache
+{
+  public:
+    static_assert( std::has_single_bit( NumberOfEntries ), "number of entries must be a power of 2" );
+
+    // Longer keys are looked up in Cache directly
+    static constexpr size_t kMaxKeySize = 32;
+
+    explicit HotKeyCache( const Cache & cache ) :
+        mCache( &cache )
+    {
+        if ( cache.hasCompressedValues() )
+        {
+            throw std::runtime_error( "Caches with compressed values can't be fronted" );
+        }
+    }
+
+    [[nodiscard]] auto getString( std::string_view key, std::string_view defaultValue = {} ) const -> std::pair<std::string_view, bool>
+    {
+        const auto resolved = resolve( key );
+        if ( !resolved.isExist )
+        {
+            return std::make_pair( defaultValue, false );
+        }
+        return std::make_pair( resolved.type == CacheValueType::String ? resolved.value : std::string_view{}, true );
+    }
+
+    // Same as getString, for callers that also read Cache directly with a buffer. The fronted cache
+    // has no compressed values, so buffer stays unused.
+    [[nodiscard]] auto getString( std::string_view key, [[maybe_unused]] std::string & buffer, std::string_view defaultValue = {} ) const -> std::pair<std::string_view, bool>
+    {
+        return getString( key, defaultValue );
+    }
+
+    [[nodiscard]] auto getBool( std::string_view key, bool defaultValue = false ) const -> std::pair<bool, bool>
+    {
+        const auto resolved = resolve( key );
+        return Cache::toBool( key, { resolved.value, resolved.type }, defaultValue );
+    }
+
+    [[nodiscard]] auto getInt64( std::string_view key, int64_t defaultValue = 0 ) const -> std::pair<int64_t, bool>
+    {
+        const auto resolved = resolve( key );
+        return Cache::toInt64( key, { resolved.value, resolved.type }, defaultValue );
+    }
+
+    [[nodiscard]] auto getDouble( std::string_view key, double defaultValue = 0 ) const -> std::pair<double, bool>
+    {
+        const auto resolved = resolve( key );
+        return Cache::toDouble( key, { resolved.value, resolved.type }, defaultValue );
+    }
+
+    [[nodiscard]] auto getWithType( std::string_view key ) const -> std::pair<std::string_view, CacheValueType>
+    {
+        const auto resolved = resolve( key );
+        return resolved.isExist ? std::make_pair( resolved.value, resolved.type ) : std::pair<std::string_view, CacheValueType>{};
+    }
+
+    [[nodiscard]] auto contains( std::string_view key ) const -> bool
+    {
+        return resolve( key ).isExist;
+    }
+
+    // Drop every entry of the calling thread, for all the caches
+    static auto clear() -> void
+    {
+        entries().fill( Entry{} );
+    }
+
+  private:
+    struct Resolved
+    {
+        std::string_view value;
+        CacheValueType type;
+        bool isExist;
+    };
+
+    struct alignas( 64 ) Entry
+    {
+        uint64_t hash{ 0U };
+        uint64_t instanceId{ 0U }; // 0 is never a cache instanceId, the entry is empty
+        const char * value{ nullptr };
+        uint32_t valueSize{ 0U };
+        CacheValueType type{ CacheValueType::String };
+        uint8_t isExist{ 0U };
+        uint8_t keySize{ 0U };
+        uint8_t hits{ 0U };
+        char key[kMaxKeySize]{};
+    };
+    static_assert( sizeof( Entry ) == 64 );
+
+    static auto entries() -> std::array<Entry, NumberOfEntries> &
+    {
+        static thread_local std::array<Entry, NumberOfEntries> threadEntries{};
+        return threadEntries;
+    }
+
+    [[nodiscard]] auto lookup( std::string_view key, KeyHash hash ) const -> Resolved
+    {
+        const auto [value, type] = mCache->getWithType( key, hash );
+        // An empty value is either missing or stored empty, only then pay for a second probe
+        return { value, type, !value.empty() || mCache->contains( key, hash ) };
+    }
+
+    [[nodiscard]] auto resolve( std::string_view key ) const -> Resolved
+    {
+        const auto hash = Cache::hashKey( key );
+        if ( key.size() > kMaxKeySize )
+        {
+            return lookup( key, hash );
+        }
+
+        auto & entry = entries()[hash.value & ( NumberOfEntries - 1 )];
+        const auto instanceId = mCache->instanceId();
+        if ( entry.instanceId == instanceId && entry.hash == hash.value && entry.keySize == key.size() && std::memcmp( entry.key, key.data(), key.size() ) == 0 )
+        {
+            entry.hits += entry.hits < UINT8_MAX ? 1U : 0U;
+            return { { entry.value, entry.valueSize }, entry.type, entry.isExist != 0U };
+        }
+
+        const auto resolved = lookup( key, hash );
+        if ( entry.instanceId != instanceId || entry.hits == 0U )
+        {
+            entry.hash = hash.value;
+            entry.instanceId = instanceId;
+            entry.value = resolved.value.data();
+            entry.valueSize = static_cast<uint32_t>( resolved.value.size() );
+            entry.type = resolved.type;
+            entry.isExist = resolved.isExist ? 1U : 0U;
+            entry.keySize = static_cast<uint8_t>( key.size() );
+            entry.hits = 1U;
+            std::memcpy( entry.key, key.data(), key.size() );
+        }
+        else
+        {
+            --entry.hits;
+        }
+        return resolved;
+    }
+
+    const Cache * mCache;
+};
+} // namespace axoncache
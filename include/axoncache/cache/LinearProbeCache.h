@@ -6,9 +6,13 @@
 #include "axoncache/cache/base/HashedCacheBase.h"
 #include "axoncache/cache/probe/LinearProbe.h"
 #include "axoncache/cache/value/LinearProbeValue.h"
+#include "axoncache/cache/hasher/WyHasher.h"
 #include "axoncache/cache/hasher/Xxh3Hasher.h"
 
 namespace axoncache
 {
 using LinearProbeCache = HashedCacheBase<Xxh3Hasher, LinearProbe<sizeof( uint64_t )>, LinearProbeValue, CacheType::LINEAR_PROBE>;
+
+// Same cache type, keys hashed with wyhash. Files record it in hashFuncId.
+using LinearProbeWyhashCache = HashedCacheBase<WyHasher, LinearProbe<sizeof( uint64_t )>, LinearProbeValue, CacheType::LINEAR_PROBE>;
 }
@@ -5,6 +5,7 @@
 
 #include "axoncache/cache/LinearProbeCache.h"
 #include "axoncache/cache/probe/LinearProbe.h"
+#include "axoncache/cache/value/FrequentValueSketch.h"
 #include "axoncache/memory/MallocMemoryHandler.h"
 #include <map>
 #include <unordered_map>
@@ -14,8 +15,8 @@ namespace axoncache
 class LinearProbeDedupCache : public LinearProbeCache
 {
   public:
-    LinearProbeDedupCache( uint16_t offsetBits, uint64_t numberOfKeySlots, double maxLoadFactor, std::unique_ptr<MemoryHandler> memoryHandler, CacheType cacheType ) :
-        LinearProbeCache( offsetBits, numberOfKeySlots, maxLoadFactor, std::move( memoryHandler ) ), mCacheType( cacheType )
+    LinearProbeDedupCache( uint16_t offsetBits, uint64_t numberOfKeySlots, double maxLoadFactor, std::unique_ptr<MemoryHandler> memoryHandler, CacheType cacheType, uint32_t headerFlags = 0U ) :
+        LinearProbeCache( offsetBits, numberOfKeySlots, maxLoadFactor, std::move( memoryHandler ), headerFlags ), mCacheType( cacheType )
     {
     }
 
@@ -35,6 +36,12 @@ class LinearProbeDedupCache : public LinearProbeCache
         return mCacheType;
     }
 
+    // Readers of the base format read a 16-bit count of frequent values and 1 or 2-byte indexes
+    [[nodiscard]] auto formatVersion() const -> uint16_t override
+    {
+        return mValues.size() > 0xFFFFU ? version() : LinearProbeCache::formatVersion();
+    }
+
     // Keep the common string lookup on the concrete cache type so it can be
     // inlined without the base implementation's virtual getInternal dispatch.
     [[nodiscard]] auto getString( std::string_view key, std::string_view defaultValue = {}, uint64_t * foundHash = nullptr ) const -> std::pair<std::string_view, bool>
@@ -48,11 +55,72 @@ class LinearProbeDedupCache : public LinearProbeCache
         return std::make_pair( StringViewToNullTerminatedString::trimExtraNullTerminator( str ), true );
     }
 
+    [[nodiscard]] auto getString( std::string_view key, KeyHash hash, std::string_view defaultValue = {} ) const -> std::pair<std::string_view, bool>
+    {
+        bool isExist = false;
+        const auto str = LinearProbeDedupCache::getHashedInternal( key, hash.value, CacheValueType::String, &isExist );
+        if ( !isExist )
+        {
+            return std::make_pair( defaultValue, false );
+        }
+        return std::make_pair( StringViewToNullTerminatedString::trimExtraNullTerminator( str ), true );
+    }
+
+    [[nodiscard]] auto getString( std::string_view key, std::string & buffer, std::string_view defaultValue = {} ) const -> std::pair<std::string_view, bool>
+    {
+        bool isExist = false;
+        const auto str = LinearProbeDedupCache::getInternal( key, CacheValueType::String, &isExist, nullptr, &buffer );
+        if ( !isExist )
+        {
+            return std::make_pair( defaultValue, false );
+        }
+        return std::make_pair( StringViewToNullTerminatedString::trimExtraNullTerminator( str ), true );
+    }
+
+    [[nodiscard]] auto getString( std::string_view key, KeyHash hash, std::string & buffer, std::string_view defaultValue = {} ) const -> std::pair<std::string_view, bool>
+    {
+        bool isExist = false;
+        const auto str = LinearProbeDedupCache::getHashedInternal( key, hash.value, CacheValueType::String, &isExist, &buffer );
+        if ( !isExist )
+        {
+            return std::make_pair( defaultValue, false );
+        }
+        return std::make_pair( StringViewToNullTerminatedString::trimExtraNullTerminator( str ), true );
+    }
+
+    // Hides the base getMany to use the slot-reusing lookup below without a virtual call per key
+    [[nodiscard]] auto getMany( std::span<const std::string_view> keys, std::string_view defaultValue = {} ) const -> std::vector<std::pair<std::string_view, bool>>
+    {
+        if ( hasCompressedValues() )
+        {
+            thread_local std::vector<std::string> threadBuffers;
+            return getMany( keys, threadBuffers, defaultValue );
+        }
+        return getManyInto( keys, nullptr, defaultValue );
+    }
+
+    [[nodiscard]] auto getMany( std::span<const std::string_view> keys, std::vector<std::string> & buffers, std::string_view defaultValue = {} ) const -> std::vector<std::pair<std::string_view, bool>>
+    {
+        buffers.resize( std::max( buffers.size(), keys.size() ) );
+        return getManyInto( keys, buffers.data(), defaultValue );
+    }
+
+    // Picks up to maxValues frequent values from the values put, instead of setDuplicatedValues. A
+    // sketch follows the puts, finalize counts its candidates exactly and keeps the values saving
+    // the most bytes, then replaces them in the records by their index.
+    auto detectFrequentValues( size_t maxValues ) -> void;
+
+    auto finalize() -> void override;
+
     auto setDuplicatedValues( const std::vector<std::string> & values ) -> void
     {
-        if ( values.size() > 65536 )
+        if ( values.size() > Constants::Limit::kFrequentValues )
+        {
+            throw std::runtime_error( "Should not set more than " + std::to_string( Constants::Limit::kFrequentValues ) + " duplicated values" );
+        }
+        if ( mSketch != nullptr )
         {
-            throw std::runtime_error( "Should not set more than 65536 duplicated values" );
+            throw std::runtime_error( "Frequent values are detected, don't set them" );
         }
         if ( mIsValuesLoaded )
         {
@@ -74,7 +142,7 @@ class LinearProbeDedupCache : public LinearProbeCache
         mValuesToIndex.clear();
         mValues.reserve( values.size() );
 
-        uint16_t index = 0U;
+        uint32_t index = 0U;
         auto ptr = ( char * )mValuesMemoryHandler->data();
         for ( const auto & value : values )
         {
@@ -97,40 +165,73 @@ class LinearProbeDedupCache : public LinearProbeCache
     }
 
   protected:
+    [[nodiscard]] auto getManyInto( std::span<const std::string_view> keys, std::string * buffers, std::string_view defaultValue ) const -> std::vector<std::pair<std::string_view, bool>>
+    {
+        std::vector<std::pair<std::string_view, bool>> results;
+        results.reserve( keys.size() );
+        auto lookup = [&]( std::string_view key, uint64_t hash )
+        {
+            bool isExist = false;
+            const auto str = LinearProbeDedupCache::getHashedInternal( key, hash, CacheValueType::String, &isExist, buffers == nullptr ? nullptr : &buffers[results.size()] );
+            results.emplace_back( isExist ? StringViewToNullTerminatedString::trimExtraNullTerminator( str ) : defaultValue, isExist );
+        };
+        forEachPrefetched( keys, lookup );
+        return results;
+    }
+
     // Keep the complete slot loaded by the probe and pass it to value decoding.
     // Returning only its key-space offset would make the decoder load it again.
     [[nodiscard]] auto getInternal( std::string_view key, CacheValueType type, uint64_t * foundHash = nullptr ) const -> std::string_view override
     {
         auto hash = Xxh3Hasher::hash( key );
         uint64_t slot = 0;
-        auto keySlotOffset = mProbe.findKeySlotOffset( key, hash, mKeySpacePtr, &slot );
+        auto keySlotOffset = this->findKeySlotOffset( key, hash, &slot );
         this->setFoundHash( foundHash, hash, keySlotOffset );
         return keySlotOffset == Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND
                    ? std::string_view{}
                    : mValueMgr.getFromSlot( mKeySpacePtr, slot, static_cast<uint8_t>( type ), mValues );
     }
 
-    [[nodiscard]] auto getInternal( std::string_view key, CacheValueType type, bool * isExists, uint64_t * foundHash = nullptr ) const -> std::string_view override
+    [[nodiscard]] auto getInternal( std::string_view key, CacheValueType type, bool * isExists, uint64_t * foundHash = nullptr, std::string * buffer = nullptr ) const -> std::string_view override
     {
         auto hash = Xxh3Hasher::hash( key );
         uint64_t slot = 0;
-        auto keySlotOffset = mProbe.findKeySlotOffset( key, hash, mKeySpacePtr, &slot );
+        auto keySlotOffset = this->findKeySlotOffset( key, hash, &slot );
         *isExists = ( keySlotOffset != Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND );
         this->setFoundHash( foundHash, hash, keySlotOffset );
         return *isExists
-                   ? mValueMgr.getFromSlot( mKeySpacePtr, slot, static_cast<uint8_t>( type ), mValues )
+                   ? mValueMgr.getFromSlot( mKeySpacePtr, slot, static_cast<uint8_t>( type ), mValues, buffer )
+                   : std::string_view{};
+    }
+
+    [[nodiscard]] auto getHashedInternal( std::string_view key, uint64_t hash, CacheValueType type, bool * isExists, std::string * buffer = nullptr ) const -> std::string_view override
+    {
+        uint64_t slot = 0;
+        auto keySlotOffset = this->findKeySlotOffset( key, hash, &slot );
+        *isExists = ( keySlotOffset != Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND );
+        return *isExists
+                   ? mValueMgr.getFromSlot( mKeySpacePtr, slot, static_cast<uint8_t>( type ), mValues, buffer )
                    : std::string_view{};
     }
 
-    [[nodiscard]] auto getWithTypeInternal( std::string_view key, uint64_t * foundHash = nullptr ) const -> std::pair<std::string_view, CacheValueType> override
+    [[nodiscard]] auto getWithTypeInternal( std::string_view key, uint64_t * foundHash = nullptr, std::string * buffer = nullptr ) const -> std::pair<std::string_view, CacheValueType> override
     {
         auto hash = Xxh3Hasher::hash( key );
         uint64_t slot = 0;
-        auto keySlotOffset = mProbe.findKeySlotOffset( key, hash, mKeySpacePtr, &slot );
+        auto keySlotOffset = this->findKeySlotOffset( key, hash, &slot );
         this->setFoundHash( foundHash, hash, keySlotOffset );
         return keySlotOffset == Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND
                    ? std::pair<std::string_view, CacheValueType>{}
-                   : mValueMgr.getWithTypeFromSlot( mKeySpacePtr, slot, mValues );
+                   : mValueMgr.getWithTypeFromSlot( mKeySpacePtr, slot, mValues, buffer );
+    }
+
+    [[nodiscard]] auto getWithTypeHashedInternal( std::string_view key, uint64_t hash, std::string * buffer = nullptr ) const -> std::pair<std::string_view, CacheValueType> override
+    {
+        uint64_t slot = 0;
+        auto keySlotOffset = this->findKeySlotOffset( key, hash, &slot );
+        return keySlotOffset == Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND
+                   ? std::pair<std::string_view, CacheValueType>{}
+                   : mValueMgr.getWithTypeFromSlot( mKeySpacePtr, slot, mValues, buffer );
     }
 
     auto putInternal( std::string_view key, CacheValueType type, std::string_view value ) -> std::pair<bool, uint32_t> override;
@@ -139,8 +240,12 @@ class LinearProbeDedupCache : public LinearProbeCache
 
     auto setFrequentValue() -> void;
 
+    auto selectFrequentValues() -> void;
+
     std::vector<std::string_view> mValues;
-    std::map<size_t, std::unordered_map<std::string_view, uint16_t>> mValuesToIndex;
+    std::map<size_t, std::unordered_map<std::string_view, uint32_t>> mValuesToIndex;
+    std::unique_ptr<FrequentValueSketch> mSketch{ nullptr };
+    size_t mMaxFrequentValues{ 0U };
     std::unique_ptr<MallocMemoryHandler> mValuesMemoryHandler{ nullptr };
     bool mIsValuesLoaded{ false };
     CacheType mCacheType{ CacheType::LINEAR_PROBE };
@@ -0,0 +1,14 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include "axoncache/cache/base/HashedCacheBase.h"
+#include "axoncache/cache/probe/SimdProbe.h"
+#include "axoncache/cache/value/LinearProbeValue.h"
+#include "axoncache/cache/hasher/Xxh3Hasher.h"
+
+namespace axoncache
+{
+using LinearProbeSimdCache = HashedCacheBase<Xxh3Hasher, SimdProbe<sizeof( uint64_t )>, LinearProbeValue, CacheType::LINEAR_PROBE_SIMD>;
+}
@@ -0,0 +1,243 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <cstring>
+#include "axoncache/cache/base/HashedCacheBase.h"
+#include "axoncache/cache/probe/LinearProbe.h"
+#include "axoncache/cache/value/LinearProbeValue.h"
+#include "axoncache/cache/hasher/Xxh3Hasher.h"
+#include "axoncache/cache/key/KeyFingerprint.h"
+
+namespace axoncache
+{
+namespace numeric
+{
+// Key slot of a NUMERIC cache, a lookup reads no record
+struct Entry
+{
+    uint64_t tag;         // Key hash, 1 for a hash of 0, 0 is an empty slot
+    uint64_t fingerprint; // KeyFingerprint::secondHash of the key, its 2 low bits replaced by the value type
+    uint64_t value;       // Int64 or Double bytes, a Bool in the first byte
+};
+static_assert( sizeof( Entry ) == 24 );
+
+constexpr uint64_t kTypeMask = 3U;
+}
+
+using NumericCacheBase = HashedCacheBase<Xxh3Hasher, LinearProbe<sizeof( uint64_t )>, LinearProbeValue, CacheType::NUMERIC>;
+
+// Linear probe cache of Int64, Double and Bool values only, stored inline: the data is one
+// numeric::Entry per key slot and nothing else. Keys are not stored, a key matches on its hash
+// and the 62 high bits of its second hash, the other 2 hold the value type. That is 126 bits, so
+// a compared entry is a false positive with a ~2^-126 chance, against ~2^-128 for a record in key
+// fingerprint mode, see KeyFingerprint.
+//
+// A typed lookup reads the entries from the home slot on, usually a single cache line, where
+// LINEAR_PROBE reads the slot then the record with its 6-byte header, key and value. String,
+// StringList and FloatList values are rejected by put. Only the slot mapping header flags are
+// supported.
+//
+// Every slot takes 24 bytes, empty ones included, against 8 bytes plus 14 bytes and the key per
+// record for LINEAR_PROBE: the cache is smaller at high load factors or with long keys.
+class NumericCache : public NumericCacheBase
+{
+  public:
+    NumericCache( uint16_t offsetBits, uint64_t numberOfKeySlots, double maxLoadFactor, std::unique_ptr<MemoryHandler> memoryHandler, uint32_t headerFlags = 0U );
+
+    NumericCache( const CacheHeader & header, std::unique_ptr<MemoryHandler> memoryHandler );
+
+    // The entries beyond the keySpace size of LINEAR_PROBE
+    [[nodiscard]] auto dataSize() const -> uint64_t override
+    {
+        return mProbe.numberOfKeySlots() * ( sizeof( numeric::Entry ) - sizeof( uint64_t ) );
+    }
+
+    [[nodiscard]] auto contains( std::string_view key, uint64_t * foundHash = nullptr ) const -> bool
+    {
+        const auto hash = Xxh3Hasher::hash( key );
+        const auto * entry = find( key, hash );
+        setFoundHash( foundHash, hash, entry == nullptr ? Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND : 0 );
+        return entry != nullptr;
+    }
+
+    [[nodiscard]] auto contains( std::string_view key, KeyHash hash ) const -> bool
+    {
+        return find( key, hash.value ) != nullptr;
+    }
+
+    // The typed getters read the entry directly, other types of values decode like in HashedCacheBase
+    [[nodiscard]] auto getBool( std::string_view key, bool defaultValue = false, uint64_t * foundHash = nullptr ) const -> std::pair<bool, bool>
+    {
+        const auto hash = Xxh3Hasher::hash( key );
+        const auto * entry = find( key, hash );
+        setFoundHash( foundHash, hash, entry == nullptr ? Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND : 0 );
+        return toBool( key, entry, defaultValue );
+    }
+
+    [[nodiscard]] auto getBool( std::string_view key, KeyHash hash, bool defaultValue = false ) const -> std::pair<bool, bool>
+    {
+        return toBool( key, find( key, hash.value ), defaultValue );
+    }
+
+    [[nodiscard]] auto getInt64( std::string_view key, int64_t defaultValue = 0, uint64_t * foundHash = nullptr ) const -> std::pair<int64_t, bool>
+    {
+        const auto hash = Xxh3Hasher::hash( key );
+        const auto * entry = find( key, hash );
+        setFoundHash( foundHash, hash, entry == nullptr ? Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND : 0 );
+        return toInt64( key, entry, defaultValue );
+    }
+
+    [[nodiscard]] auto getInt64( std::string_view key, KeyHash hash, int64_t defaultValue = 0 ) const -> std::pair<int64_t, bool>
+    {
+        return toInt64( key, find( key, hash.value ), defaultValue );
+    }
+
+    [[nodiscard]] auto getDouble( std::string_view key, double defaultValue = 0, uint64_t * foundHash = nullptr ) const -> std::pair<double, bool>
+    {
+        const auto hash = Xxh3Hasher::hash( key );
+        const auto * entry = find( key, hash );
+        setFoundHash( foundHash, hash, entry == nullptr ? Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND : 0 );
+        return toDouble( key, entry, defaultValue );
+    }
+
+    [[nodiscard]] auto getDouble( std::string_view key, KeyHash hash, double defaultValue = 0 ) const -> std::pair<double, bool>
+    {
+        return toDouble( key, find( key, hash.value ), defaultValue );
+    }
+
+    using NumericCacheBase::toBool;
+    using NumericCacheBase::toDouble;
+    using NumericCacheBase::toInt64;
+
+  protected:
+    auto putInternal( std::string_view key, CacheValueType type, std::string_view value ) -> std::pair<bool, uint32_t> override;
+
+    // A value of another type is reported missing, there is no String value to trim
+    [[nodiscard]] auto getInternal( std::string_view key, CacheValueType type, uint64_t * foundHash = nullptr ) const -> std::string_view override
+    {
+        bool isExist = false;
+        return getInternal( key, type, &isExist, foundHash );
+    }
+
+    [[nodiscard]] auto getInternal( std::string_view key, CacheValueType type, bool * isExist, uint64_t * foundHash = nullptr, [[maybe_unused]] std::string * buffer = nullptr ) const -> std::string_view override
+    {
+        const auto hash = Xxh3Hasher::hash( key );
+        const auto * entry = find( key, hash );
+        setFoundHash( foundHash, hash, entry == nullptr ? Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND : 0 );
+        const auto value = valueOf( entry, type );
+        *isExist = !value.empty();
+        return value;
+    }
+
+    [[nodiscard]] auto getHashedInternal( std::string_view key, uint64_t hash, CacheValueType type, bool * isExist, [[maybe_unused]] std::string * buffer = nullptr ) const -> std::string_view override
+    {
+        const auto value = valueOf( find( key, hash ), type );
+        *isExist = !value.empty();
+        return value;
+    }
+
+    [[nodiscard]] auto getWithTypeInternal( std::string_view key, uint64_t * foundHash = nullptr, [[maybe_unused]] std::string * buffer = nullptr ) const -> std::pair<std::string_view, CacheValueType> override
+    {
+        const auto hash = Xxh3Hasher::hash( key );
+        const auto * entry = find( key, hash );
+        setFoundHash( foundHash, hash, entry == nullptr ? Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND : 0 );
+        return withType( entry );
+    }
+
+    [[nodiscard]] auto getWithTypeHashedInternal( std::string_view key, uint64_t hash, [[maybe_unused]] std::string * buffer = nullptr ) const -> std::pair<std::string_view, CacheValueType> override
+    {
+        return withType( find( key, hash ) );
+    }
+
+  private:
+    [[nodiscard]] static auto tagOf( uint64_t hash ) -> uint64_t
+    {
+        return hash == 0U ? 1U : hash;
+    }
+
+    [[nodiscard]] static auto typeOf( const numeric::Entry & entry ) -> CacheValueType
+    {
+        return static_cast<CacheValueType>( ( entry.fingerprint & numeric::kTypeMask ) + 1U );
+    }
+
+    [[nodiscard]] auto entries() const -> const numeric::Entry *
+    {
+        return reinterpret_cast<const numeric::Entry *>( mKeySpacePtr );
+    }
+
+    // Entry of key or nullptr, the second hash is only computed once a tag matches
+    [[nodiscard]] auto find( std::string_view key, uint64_t hash ) const -> const numeric::Entry *
+    {
+        const auto numberOfKeySlots = mProbe.numberOfKeySlots();
+        const auto tag = tagOf( hash );
+        const auto * slotEntries = entries();
+        uint64_t fingerprint = 0U;
+        auto slotId = homeSlot( mProbe.slotMapping(), hash, numberOfKeySlots );
+        for ( uint32_t probes = 0; probes <= mHeader.maxCollisions; ++probes )
+        {
+            const auto & entry = slotEntries[slotId];
+            if ( entry.tag == 0U )
+            {
+                return nullptr;
+            }
+            if ( entry.tag == tag )
+            {
+                fingerprint = fingerprint == 0U ? ( KeyFingerprint::secondHash( key ) | numeric::kTypeMask ) : fingerprint;
+                if ( ( entry.fingerprint | numeric::kTypeMask ) == fingerprint )
+                {
+                    return &entry;
+                }
+            }
+            slotId = slotId + 1U == numberOfKeySlots ? 0U : slotId + 1U;
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] static auto withType( const numeric::Entry * entry ) -> std::pair<std::string_view, CacheValueType>
+    {
+        if ( entry == nullptr )
+        {
+            return {};
+        }
+        const auto type = typeOf( *entry );
+        return { { reinterpret_cast<const char *>( &entry->value ), type == CacheValueType::Bool ? sizeof( bool ) : sizeof( uint64_t ) }, type };
+    }
+
+    [[nodiscard]] static auto valueOf( const numeric::Entry * entry, CacheValueType type ) -> std::string_view
+    {
+        const auto [value, storedType] = withType( entry );
+        return storedType == type ? value : std::string_view{};
+    }
+
+    [[nodiscard]] static auto toBool( std::string_view key, const numeric::Entry * entry, bool defaultValue ) -> std::pair<bool, bool>
+    {
+        if ( entry != nullptr && typeOf( *entry ) == CacheValueType::Bool )
+        {
+            return { *reinterpret_cast<const uint8_t *>( &entry->value ) != 0U, true };
+        }
+        return toBool( key, withType( entry ), defaultValue );
+    }
+
+    [[nodiscard]] static auto toInt64( std::string_view key, const numeric::Entry * entry, int64_t defaultValue ) -> std::pair<int64_t, bool>
+    {
+        if ( entry != nullptr && typeOf( *entry ) == CacheValueType::Int64 )
+        {
+            return { static_cast<int64_t>( entry->value ), true };
+        }
+        return toInt64( key, withType( entry ), defaultValue );
+    }
+
+    [[nodiscard]] static auto toDouble( std::string_view key, const numeric::Entry * entry, double defaultValue ) -> std::pair<double, bool>
+    {
+        if ( entry != nullptr && typeOf( *entry ) == CacheValueType::Double )
+        {
+            double value = 0;
+            std::memcpy( &value, &entry->value, sizeof( value ) );
+            return { value, true };
+        }
+        return toDouble( key, withType( entry ), defaultValue );
+    }
+};
+}
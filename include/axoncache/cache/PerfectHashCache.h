@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include "axoncache/cache/base/HashedCacheBase.h"
+#include "axoncache/cache/probe/PerfectHashProbe.h"
+#include "axoncache/cache/value/LinearProbeValue.h"
+#include "axoncache/cache/hasher/Xxh3Hasher.h"
+
+namespace axoncache
+{
+using PerfectHashCacheBase = HashedCacheBase<Xxh3Hasher, PerfectHashProbe<sizeof( uint64_t )>, LinearProbeValue, CacheType::PERFECT_HASH>;
+
+// Immutable cache whose keySpace has exactly one slot per key. Entries are staged in a linear
+// probe keySpace sized like LINEAR_PROBE; finalize replaces it with the perfect hash layout
+// (see PerfectHashProbe), so numberOfKeySlots is the number of entries in the written file.
+class PerfectHashCache : public PerfectHashCacheBase
+{
+  public:
+    PerfectHashCache( uint16_t offsetBits, uint64_t numberOfKeySlots, double maxLoadFactor, std::unique_ptr<MemoryHandler> memoryHandler, uint32_t headerFlags = 0U ) :
+        PerfectHashCacheBase( offsetBits, numberOfKeySlots, maxLoadFactor, std::move( memoryHandler ), headerFlags )
+    {
+    }
+
+    PerfectHashCache( const CacheHeader & header, std::unique_ptr<MemoryHandler> memoryHandler ) :
+        PerfectHashCacheBase( header, std::move( memoryHandler ) )
+    {
+        mProbe.loadFunction( mKeySpacePtr );
+    }
+
+    auto finalize() -> void override;
+};
+}
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <string>
 #include <string_view>
 #include <memory>
@@ -15,10 +16,21 @@
 #include <span>
 
 #include "axoncache/Constants.h"
+#include "axoncache/Math.h"
 #include "axoncache/cache/CacheBase.h"
 #include "axoncache/cache/CacheType.h"
+#include "axoncache/cache/filter/BlockedBloomFilter.h"
+#include "axoncache/cache/hasher/KeyHash.h"
+#include "axoncache/cache/key/KeyFingerprint.h"
+#include "axoncache/cache/key/NamespaceTable.h"
+#include "axoncache/cache/probe/LinearProbe.h"
+#include "axoncache/cache/probe/SlotMapping.h"
 #include "axoncache/domain/CacheHeader.h"
 #include "axoncache/domain/CacheValue.h"
+#include "axoncache/transformer/FloatListMath.h"
+#include "axoncache/transformer/FloatListQuantizer.h"
+#include "axoncache/transformer/Int64ListCodec.h"
+#include "axoncache/transformer/RoaringBitmap.h"
 #include "axoncache/transformer/StringListToString.h"
 #include "axoncache/transformer/StringViewToNullTerminatedString.h"
 #include "axoncache/transformer/TypeToString.h"
@@ -35,20 +47,23 @@ template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTy
 class HashedCacheBase : public CacheBase
 {
   public:
-    HashedCacheBase( uint16_t offsetBits, uint64_t numberOfKeySlots, double maxLoadFactor, std::unique_ptr<MemoryHandler> memoryHandler ) :
+    HashedCacheBase( uint16_t offsetBits, uint64_t numberOfKeySlots, double maxLoadFactor, std::unique_ptr<MemoryHandler> memoryHandler, uint32_t headerFlags = 0U ) :
         CacheBase( std::move( memoryHandler ) ),
-        mMaxNumberOfEntries( numberOfKeySlots * maxLoadFactor ),
+        mMaxNumberOfEntries( keySlotsFor( numberOfKeySlots, headerFlags ) * maxLoadFactor ),
         mKeySpacePtr( nullptr ),
         mHeader(),
-        mProbe( offsetBits, numberOfKeySlots ),
-        mValueMgr( offsetBits, numberOfKeySlots, mProbe.hashcodeMask(), mProbe.offsetMask() )
+        mProbe( offsetBits, keySlotsFor( numberOfKeySlots, headerFlags ) ),
+        mValueMgr( offsetBits, keySlotsFor( numberOfKeySlots, headerFlags ), mProbe.hashcodeMask(), mProbe.offsetMask() ),
+        mIsFinalized( false )
     {
-        if ( mProbe.cacheType() == CacheType::LINEAR_PROBE && maxLoadFactor > Constants::ConfDefault::kLinearProbeMaxLoadFactor )
+        if ( ( mProbe.cacheType() == CacheType::LINEAR_PROBE || mProbe.cacheType() == CacheType::LINEAR_PROBE_SIMD || mProbe.cacheType() == CacheType::PERFECT_HASH ) && maxLoadFactor > Constants::ConfDefault::kLinearProbeMaxLoadFactor )
         {
             throw std::runtime_error( "LoadFactor for LINEAR_PROBE can't greater than " + std::to_string( Constants::ConfDefault::kLinearProbeMaxLoadFactor ) );
         }
-        mHeader.numberOfKeySlots = numberOfKeySlots;
+        mHeader.flags = headerFlags;
+        mHeader.numberOfKeySlots = keySlotsFor( numberOfKeySlots, headerFlags );
         mHeader.maxLoadFactor = maxLoadFactor;
+        applyHeaderFlags();
         mutableMemoryHandler()->allocate( mProbe.calculateKeySpaceSize() );
         updateKeySpacePtr();
     }
@@ -59,9 +74,17 @@ class HashedCacheBase : public CacheBase
         mKeySpacePtr( nullptr ),
         mHeader( header ),
         mProbe( header.offsetBits, header.numberOfKeySlots ),
-        mValueMgr( header.offsetBits, header.numberOfKeySlots, mProbe.hashcodeMask(), mProbe.offsetMask() )
+        mValueMgr( header.offsetBits, header.numberOfKeySlots, mProbe.hashcodeMask(), mProbe.offsetMask() ),
+        mIsFinalized( true )
     {
+        // Keys hashed by another function would all be missing. UNKNOWN is accepted for headers
+        // that never set it.
+        if ( header.hashFuncId != Constants::HashFuncId::UNKNOWN && header.hashFuncId != HashAlgo::hashFuncId() )
+        {
+            throw std::runtime_error( "cache data hashed with hashFuncId " + std::to_string( header.hashFuncId ) + " can't be read with hashFuncId " + std::to_string( HashAlgo::hashFuncId() ) );
+        }
         updateKeySpacePtr();
+        applyHeaderFlags();
     }
 
     HashedCacheBase( const HashedCacheBase & ) = delete;
@@ -135,7 +158,7 @@ class HashedCacheBase : public CacheBase
 
     [[nodiscard]] auto dataSize() const -> uint64_t override
     {
-        return memoryHandler()->dataSize() - mProbe.keyspaceSize();
+        return memoryHandler()->dataSize() - sectionOffset( Section::End );
     }
 
     [[nodiscard]] auto size() const -> uint64_t override
@@ -148,6 +171,100 @@ class HashedCacheBase : public CacheBase
         return toHeaderInfo( mHeader );
     }
 
+    [[nodiscard]] auto headerFlags() const -> uint32_t override
+    {
+        return mHeader.flags;
+    }
+
+    // Files with incompatible header flags get the runtime version. Cache types added after the base
+    // format are stamped too, since a base LINEAR_PROBE loader only refused the dedup types, and so
+    // are hash functions other than xxh3, which base readers never checked,
+    // and values of the types added after FloatList
+    [[nodiscard]] auto formatVersion() const -> uint16_t override
+    {
+        const auto isBaseCacheType = type() == CacheType::BUCKET_CHAIN || type() == CacheType::LINEAR_PROBE || type() == CacheType::LINEAR_PROBE_DEDUP || type() == CacheType::LINEAR_PROBE_DEDUP_TYPED;
+        const auto isBaseFormat = isBaseCacheType && HashAlgo::hashFuncId() == Constants::HashFuncId::XXH3 && ( mHeader.flags & Constants::HeaderFlag::kIncompatibleFlags ) == 0U && !mHasNewValueTypes;
+        return isBaseFormat ? Constants::kBaseFormatVersion : version();
+    }
+
+    // String values then only come out of the getters taking a buffer, the ones returning a view of
+    // the cache throw on them
+    [[nodiscard]] auto hasCompressedValues() const -> bool
+    {
+        return ( mHeader.flags & Constants::HeaderFlag::kCompressedValues ) != 0U;
+    }
+
+    [[nodiscard]] auto hasIndexedStringLists() const -> bool
+    {
+        return ( mHeader.flags & Constants::HeaderFlag::kIndexedStringLists ) != 0U;
+    }
+
+    // Dedup caches with frequent values have already replaced them by their index, see
+    // LinearProbeDedupCache::finalize. Values are compressed next, so the following steps see the
+    // final records. Each record move keeps shared values pointing to the same records. With Robin
+    // Hood placement, maxCollisions becomes the longest displacement of the final layout.
+    // The sections are added last, once no record moves anymore. With aligned values, a gap
+    // before the records keeps them as far from the file start as when they were padded.
+    auto finalize() -> void override
+    {
+        if ( mIsFinalized )
+        {
+            return;
+        }
+        mIsFinalized = true;
+
+        if constexpr ( kIsLinearProbe )
+        {
+            mValueMgr.shareValues( false );
+            if ( hasCompressedValues() )
+            {
+                mValueMgr.compressValues( mProbe.numberOfKeySlots(), mProbe.keyspaceSize(), mutableMemoryHandler() );
+                updateKeySpacePtr();
+            }
+            if ( ( mHeader.flags & Constants::HeaderFlag::kRobinHood ) != 0U )
+            {
+                mHeader.maxCollisions = mProbe.robinHoodLayout( mKeySpacePtr, [this]( std::string_view storedKey )
+                                                                { return hashStoredKey( storedKey ); } );
+                mProbe.setMaxDisplacement( mHeader.maxCollisions );
+            }
+            layoutSections( [this]( Section section, uint64_t /*offset*/ ) -> uint64_t
+                            {
+                                switch ( section )
+                                {
+                                    case Section::NegativeLookupFilter:
+                                        return BlockedBloomFilter::sizeFor( mHeader.numberOfEntries );
+                                    case Section::Namespaces:
+                                        return mNamespaces.serializedSize();
+                                    default:
+                                        return mValueMgr.dictionary().serializedSize();
+                                }
+                            } );
+            const auto sectionsSize = sectionOffset( Section::End ) - mProbe.keyspaceSize();
+            const auto valueAlignment = linear::valueAlignment( mHeader.flags );
+            const auto gapSize = valueAlignment == 0U ? 0U : ( valueAlignment - sectionsSize % valueAlignment ) % valueAlignment;
+            if ( sectionsSize + gapSize == 0U )
+            {
+                return;
+            }
+            mValueMgr.reserveAfterKeySpace( mProbe.numberOfKeySlots(), mProbe.keyspaceSize(), sectionsSize + gapSize, mutableMemoryHandler() );
+            updateKeySpacePtr();
+            if ( hasCompressedValues() )
+            {
+                mValueMgr.dictionary().write( mKeySpacePtr + sectionOffset( Section::ValueDictionary ) );
+            }
+            if ( mNamespaces.isEnabled() )
+            {
+                mNamespaces.write( mKeySpacePtr + sectionOffset( Section::Namespaces ) );
+            }
+            if ( ( mHeader.flags & Constants::HeaderFlag::kNegativeLookupFilter ) != 0U )
+            {
+                mFilter = BlockedBloomFilter( mKeySpacePtr + sectionOffset( Section::NegativeLookupFilter ), BlockedBloomFilter::sizeFor( mHeader.numberOfEntries ) );
+                mValueMgr.forEachKey( mKeySpacePtr, mProbe.numberOfKeySlots(), [this]( std::string_view storedKey )
+                                      { mFilter.insert( hashStoredKey( storedKey ) ); } );
+            }
+        }
+    }
+
     auto output( std::ostream & output ) const -> void override
     {
         output.write( ( const char * )memoryHandler()->data(), memoryHandler()->dataSize() );
@@ -161,7 +278,7 @@ class HashedCacheBase : public CacheBase
 
     auto put( std::string_view key, const std::vector<std::string_view> & value ) -> std::pair<bool, uint32_t> override
     {
-        const auto str = StringListToString::transform( value );
+        const auto str = hasIndexedStringLists() ? StringListToString::transformIndexed( value ) : StringListToString::transform( value );
         return putInternal( key, CacheValueType::StringList, std::string_view{ str.data(), str.size() } );
     }
 
@@ -189,6 +306,52 @@ class HashedCacheBase : public CacheBase
         return putInternal( key, CacheValueType::FloatList, std::string_view{ str.data(), str.size() } );
     }
 
+    auto put( std::string_view key, const std::vector<float> & value, CacheValueType listType ) -> std::pair<bool, uint32_t> override
+    {
+        if ( listType == CacheValueType::FloatList )
+        {
+            return put( key, value );
+        }
+        if ( !FloatListQuantizer::isQuantized( listType ) )
+        {
+            throw std::runtime_error( "Can't store a FloatList as " + to_string( listType ) );
+        }
+        const auto str = FloatListQuantizer::quantize( value, listType );
+        const auto result = putInternal( key, listType, std::string_view{ str.data(), str.size() } );
+        mHasNewValueTypes = mHasNewValueTypes || result.first;
+        return result;
+    }
+
+    auto put( std::string_view key, const std::vector<int64_t> & value ) -> std::pair<bool, uint32_t> override
+    {
+        const auto str = Int64ListCodec::encode( value );
+        const auto result = putInternal( key, CacheValueType::Int64List, std::string_view{ str.data(), str.size() } );
+        mHasNewValueTypes = mHasNewValueTypes || result.first;
+        return result;
+    }
+
+    auto put( std::string_view key, const std::vector<int64_t> & value, CacheValueType listType ) -> std::pair<bool, uint32_t> override
+    {
+        if ( listType == CacheValueType::Int64List )
+        {
+            return put( key, value );
+        }
+        if ( listType != CacheValueType::Bitmap )
+        {
+            throw std::runtime_error( "Can't store an Int64List as " + to_string( listType ) );
+        }
+        const auto str = RoaringBitmap::encode( value );
+        const auto result = putInternal( key, CacheValueType::Bitmap, std::string_view{ str.data(), str.size() } );
+        mHasNewValueTypes = mHasNewValueTypes || result.first;
+        return result;
+    }
+
+    // Hash once, then look the key up in any cache with the same hashFuncId through the KeyHash overloads
+    [[nodiscard]] static auto hashKey( std::string_view key ) -> KeyHash
+    {
+        return KeyHash{ HashAlgo::hash( key ) };
+    }
+
     [[nodiscard]] auto get( std::string_view key, std::string_view defaultValue = {}, uint64_t * foundHash = nullptr ) const -> std::string_view
     {
         auto str = getInternal( key, CacheValueType::String, foundHash );
@@ -199,6 +362,13 @@ class HashedCacheBase : public CacheBase
         return str.empty() ? defaultValue : str;
     }
 
+    [[nodiscard]] auto get( std::string_view key, KeyHash hash, std::string_view defaultValue = {} ) const -> std::string_view
+    {
+        bool isExist = false;
+        const auto str = getHashedInternal( key, hash.value, CacheValueType::String, &isExist );
+        return str.empty() ? defaultValue : StringViewToNullTerminatedString::trimExtraNullTerminator( str );
+    }
+
     [[nodiscard]] auto getVector( std::string_view key, const std::vector<std::string_view> & defaultValue = {}, uint64_t * foundHash = nullptr ) const -> std::vector<std::string_view>
     {
         const auto str = getInternal( key, CacheValueType::StringList, foundHash );
@@ -206,52 +376,551 @@ class HashedCacheBase : public CacheBase
         return retValue.empty() ? defaultValue : retValue;
     }
 
+    [[nodiscard]] auto getVector( std::string_view key, KeyHash hash, const std::vector<std::string_view> & defaultValue = {} ) const -> std::vector<std::string_view>
+    {
+        bool isExist = false;
+        const auto str = getHashedInternal( key, hash.value, CacheValueType::StringList, &isExist );
+        const auto retValue = str.empty() ? defaultValue : StringListToString::transform( str );
+        return retValue.empty() ? defaultValue : retValue;
+    }
+
+    // Number of elements of a StringList value, 0 when the key is missing, without decoding the list
+    [[nodiscard]] auto getVectorSize( std::string_view key, uint64_t * foundHash = nullptr ) const -> size_t
+    {
+        return StringListToString::size( getInternal( key, CacheValueType::StringList, foundHash ) );
+    }
+
+    [[nodiscard]] auto getVectorSize( std::string_view key, KeyHash hash ) const -> size_t
+    {
+        bool isExist = false;
+        return StringListToString::size( getHashedInternal( key, hash.value, CacheValueType::StringList, &isExist ) );
+    }
+
+    // Element index of a StringList value, or defaultValue past its end. One load with indexed
+    // string lists, a walk over the elements before it otherwise, and no allocation either way.
+    [[nodiscard]] auto getVectorElement( std::string_view key, size_t index, std::string_view defaultValue = {}, uint64_t * foundHash = nullptr ) const -> std::string_view
+    {
+        const auto str = getInternal( key, CacheValueType::StringList, foundHash );
+        return index < StringListToString::size( str ) ? StringListToString::at( str, index ) : defaultValue;
+    }
+
+    [[nodiscard]] auto getVectorElement( std::string_view key, KeyHash hash, size_t index, std::string_view defaultValue = {} ) const -> std::string_view
+    {
+        bool isExist = false;
+        const auto str = getHashedInternal( key, hash.value, CacheValueType::StringList, &isExist );
+        return index < StringListToString::size( str ) ? StringListToString::at( str, index ) : defaultValue;
+    }
+
     [[nodiscard]] auto getString( std::string_view key, std::string_view defaultValue = {}, uint64_t * foundHash = nullptr ) const -> std::pair<std::string_view, bool>;
+    [[nodiscard]] auto getString( std::string_view key, KeyHash hash, std::string_view defaultValue = {} ) const -> std::pair<std::string_view, bool>;
+
+    // Same as getString, a compressed value is decompressed into buffer and the result points into it
+    [[nodiscard]] auto getString( std::string_view key, std::string & buffer, std::string_view defaultValue = {} ) const -> std::pair<std::string_view, bool>;
+    [[nodiscard]] auto getString( std::string_view key, KeyHash hash, std::string & buffer, std::string_view defaultValue = {} ) const -> std::pair<std::string_view, bool>;
+
+    // Same result as calling getString on each key, in order. Keys are looked up in batches: every
+    // key of a batch is hashed and its slot prefetched, then its record prefetched, before the
+    // first compare, so the cache misses of the whole batch overlap instead of running one by one.
+    // Compressed values go to buffers of the calling thread, which its next getMany reuses.
+    [[nodiscard]] auto getMany( std::span<const std::string_view> keys, std::string_view defaultValue = {} ) const -> std::vector<std::pair<std::string_view, bool>>
+    {
+        if ( hasCompressedValues() )
+        {
+            thread_local std::vector<std::string> threadBuffers;
+            return getMany( keys, threadBuffers, defaultValue );
+        }
+        return getManyInto( keys, nullptr, defaultValue );
+    }
+
+    // Same as getMany, the compressed value of keys[i] is decompressed into buffers[i]
+    [[nodiscard]] auto getMany( std::span<const std::string_view> keys, std::vector<std::string> & buffers, std::string_view defaultValue = {} ) const -> std::vector<std::pair<std::string_view, bool>>
+    {
+        buffers.resize( std::max( buffers.size(), keys.size() ) );
+        return getManyInto( keys, buffers.data(), defaultValue );
+    }
 
     [[nodiscard]] auto getBool( std::string_view key, bool defaultValue = false, uint64_t * foundHash = nullptr ) const -> std::pair<bool, bool>;
+    [[nodiscard]] auto getBool( std::string_view key, KeyHash hash, bool defaultValue = false ) const -> std::pair<bool, bool>;
 
     [[nodiscard]] auto getInt64( std::string_view key, int64_t defaultValue = 0, uint64_t * foundHash = nullptr ) const -> std::pair<int64_t, bool>;
+    [[nodiscard]] auto getInt64( std::string_view key, KeyHash hash, int64_t defaultValue = 0 ) const -> std::pair<int64_t, bool>;
 
     [[nodiscard]] auto getDouble( std::string_view key, double defaultValue = 0, uint64_t * foundHash = nullptr ) const -> std::pair<double, bool>;
+    [[nodiscard]] auto getDouble( std::string_view key, KeyHash hash, double defaultValue = 0 ) const -> std::pair<double, bool>;
 
     [[nodiscard]] auto getWithType( std::string_view key, uint64_t * foundHash = nullptr ) const -> std::pair<std::string_view, CacheValueType>
     {
-        const auto valueAndType = getWithTypeInternal( key, foundHash );
-        switch ( valueAndType.second )
-        {
-            case CacheValueType::String:
-                return std::make_pair( valueAndType.first.empty() ? valueAndType.first : StringViewToNullTerminatedString::trimExtraNullTerminator( valueAndType.first ), valueAndType.second );
-            case CacheValueType::StringList:
-                return std::make_pair( std::string_view{}, valueAndType.second ); // Not supported
-            default:
-                break;
-        }
-        return valueAndType;
+        return trimWithType( getWithTypeInternal( key, foundHash ) );
+    }
+
+    [[nodiscard]] auto getWithType( std::string_view key, KeyHash hash ) const -> std::pair<std::string_view, CacheValueType>
+    {
+        return trimWithType( getWithTypeHashedInternal( key, hash.value ) );
+    }
+
+    // Same as getWithType, a compressed value is decompressed into buffer
+    [[nodiscard]] auto getWithType( std::string_view key, std::string & buffer, uint64_t * foundHash = nullptr ) const -> std::pair<std::string_view, CacheValueType>
+    {
+        return trimWithType( getWithTypeInternal( key, foundHash, &buffer ) );
+    }
+
+    [[nodiscard]] auto getWithType( std::string_view key, KeyHash hash, std::string & buffer ) const -> std::pair<std::string_view, CacheValueType>
+    {
+        return trimWithType( getWithTypeHashedInternal( key, hash.value, &buffer ) );
     }
 
     [[nodiscard]] auto getFloatVector( std::string_view key, uint64_t * foundHash = nullptr ) const -> std::vector<float>;
+    [[nodiscard]] auto getFloatVector( std::string_view key, KeyHash hash ) const -> std::vector<float>;
     [[nodiscard]] auto getFloatAtIndices( std::string_view key, const std::vector<int32_t> & indices, uint64_t * foundHash = nullptr ) const -> std::vector<float>;
     [[nodiscard]] auto getFloatAtIndex( std::string_view key, int32_t index, uint64_t * foundHash = nullptr ) const -> float;
 
     [[nodiscard]] auto getFloatSpan( std::string_view key, uint64_t * foundHash = nullptr ) const -> std::span<const float>;
+    [[nodiscard]] auto getFloatSpan( std::string_view key, KeyHash hash ) const -> std::span<const float>;
+
+    // Dot product of the FloatList value of key with query, run on the cached bytes without copying
+    // them (see FloatListMath), quantized lists included. Not found when the key is missing, its
+    // value is not a FloatList or it has not query.size() floats.
+    [[nodiscard]] auto dotProduct( std::string_view key, std::span<const float> query, uint64_t * foundHash = nullptr ) const -> std::pair<float, bool>
+    {
+        std::string buffer;
+        return FloatListMath::score( key, getWithTypeInternal( key, foundHash, &buffer ), query, FloatListScore::DotProduct, 0.0F );
+    }
+
+    [[nodiscard]] auto cosineSimilarity( std::string_view key, std::span<const float> query, uint64_t * foundHash = nullptr ) const -> std::pair<float, bool>
+    {
+        std::string buffer;
+        return FloatListMath::score( key, getWithTypeInternal( key, foundHash, &buffer ), query, FloatListScore::Cosine, FloatListMath::squaredNorm( query ) );
+    }
+
+    // Score of each key against query into scores, defaultScore where dotProduct would not find
+    // one, and returns the number of keys that scored. Keys are looked up in prefetched batches
+    // like getMany.
+    auto scoreMany( std::span<const std::string_view> keys, std::span<const float> query, std::span<float> scores, FloatListScore metric = FloatListScore::DotProduct, float defaultScore = 0.0F ) const -> size_t
+    {
+        if ( scores.size() != keys.size() )
+        {
+            throw std::runtime_error( "scoreMany needs one score per key, got " + std::to_string( scores.size() ) + " for " + std::to_string( keys.size() ) + " keys" );
+        }
+        const auto querySquaredNorm = metric == FloatListScore::Cosine ? FloatListMath::squaredNorm( query ) : 0.0F;
+        size_t index = 0;
+        size_t scored = 0;
+        std::string buffer;
+        auto lookup = [&]( std::string_view key, uint64_t hash )
+        {
+            const auto [score, isExist] = FloatListMath::score( key, getWithTypeHashedInternal( key, hash, &buffer ), query, metric, querySquaredNorm );
+            scores[index++] = isExist ? score : defaultScore;
+            scored += isExist ? 1U : 0U;
+        };
+        forEachPrefetched( keys, lookup );
+        return scored;
+    }
+
+    // Indexes in keys of the k best scoring keys with their scores, best first. Keys without a
+    // score are skipped, so fewer than k may come back.
+    [[nodiscard]] auto topK( std::span<const std::string_view> keys, std::span<const float> query, size_t k, FloatListScore metric = FloatListScore::DotProduct ) const -> std::vector<std::pair<uint32_t, float>>
+    {
+        // Min-heap on the score: its front is the worst of the k kept so far
+        auto isBetter = []( const std::pair<uint32_t, float> & left, const std::pair<uint32_t, float> & right )
+        { return left.second > right.second; };
+        std::vector<std::pair<uint32_t, float>> best;
+        best.reserve( std::min( k, keys.size() ) + 1U );
+        if ( k == 0U )
+        {
+            return best;
+        }
+        const auto querySquaredNorm = metric == FloatListScore::Cosine ? FloatListMath::squaredNorm( query ) : 0.0F;
+        uint32_t index = 0;
+        std::string buffer;
+        auto lookup = [&]( std::string_view key, uint64_t hash )
+        {
+            const auto [score, isExist] = FloatListMath::score( key, getWithTypeHashedInternal( key, hash, &buffer ), query, metric, querySquaredNorm );
+            const auto keyIndex = index++;
+            if ( !isExist || ( best.size() == k && score <= best.front().second ) )
+            {
+                return;
+            }
+            best.emplace_back( keyIndex, score );
+            std::push_heap( best.begin(), best.end(), isBetter );
+            if ( best.size() > k )
+            {
+                std::pop_heap( best.begin(), best.end(), isBetter );
+                best.pop_back();
+            }
+        };
+        forEachPrefetched( keys, lookup );
+        std::sort_heap( best.begin(), best.end(), isBetter );
+        return best;
+    }
+
+    // Int64List value of key read in place, empty when the key is missing or has another type.
+    // Iterating it decodes one block at a time, see Int64ListView.
+    [[nodiscard]] auto getInt64List( std::string_view key, uint64_t * foundHash = nullptr ) const -> Int64ListView
+    {
+        return Int64ListView( getInternal( key, CacheValueType::Int64List, foundHash ) );
+    }
+
+    [[nodiscard]] auto getInt64List( std::string_view key, KeyHash hash ) const -> Int64ListView
+    {
+        bool isExist = false;
+        return Int64ListView( getHashedInternal( key, hash.value, CacheValueType::Int64List, &isExist ) );
+    }
+
+    // Whether the Int64List value of key holds id, decoding at most one block of a sorted list
+    [[nodiscard]] auto containsInt64( std::string_view key, int64_t id, uint64_t * foundHash = nullptr ) const -> bool
+    {
+        return getInt64List( key, foundHash ).contains( id );
+    }
+
+    [[nodiscard]] auto containsInt64( std::string_view key, KeyHash hash, int64_t id ) const -> bool
+    {
+        return getInt64List( key, hash ).contains( id );
+    }
+
+    // Bitmap value of key read in place, empty when the key is missing or has another type
+    [[nodiscard]] auto getBitmap( std::string_view key, uint64_t * foundHash = nullptr ) const -> BitmapView
+    {
+        return BitmapView( getInternal( key, CacheValueType::Bitmap, foundHash ) );
+    }
+
+    [[nodiscard]] auto getBitmap( std::string_view key, KeyHash hash ) const -> BitmapView
+    {
+        bool isExist = false;
+        return BitmapView( getHashedInternal( key, hash.value, CacheValueType::Bitmap, &isExist ) );
+    }
+
+    [[nodiscard]] auto bitmapContains( std::string_view key, uint32_t value, uint64_t * foundHash = nullptr ) const -> bool
+    {
+        return getBitmap( key, foundHash ).contains( value );
+    }
+
+    [[nodiscard]] auto bitmapContains( std::string_view key, KeyHash hash, uint32_t value ) const -> bool
+    {
+        return getBitmap( key, hash ).contains( value );
+    }
+
+    // Number of values in both Bitmaps, a missing key counting as an empty set
+    [[nodiscard]] auto bitmapIntersectCount( std::string_view leftKey, std::string_view rightKey ) const -> uint64_t
+    {
+        return getBitmap( leftKey ).intersectCount( getBitmap( rightKey ) );
+    }
+
+    // Whether the Bitmap of each key holds value into found, and returns the number that do. Keys
+    // are looked up in prefetched batches like getMany.
+    auto bitmapContainsMany( std::span<const std::string_view> keys, uint32_t value, std::span<bool> found ) const -> size_t
+    {
+        if ( found.size() != keys.size() )
+        {
+            throw std::runtime_error( "bitmapContainsMany needs one result per key, got " + std::to_string( found.size() ) + " for " + std::to_string( keys.size() ) + " keys" );
+        }
+        size_t index = 0;
+        size_t contained = 0;
+        auto lookup = [&]( std::string_view key, uint64_t hash )
+        {
+            bool isExist = false;
+            found[index] = RoaringBitmap::contains( getHashedInternal( key, hash, CacheValueType::Bitmap, &isExist ), value );
+            contained += found[index++] ? 1U : 0U;
+        };
+        forEachPrefetched( keys, lookup );
+        return contained;
+    }
 
     [[nodiscard]] auto getKeyType( std::string_view key, uint64_t * foundHash = nullptr ) const -> std::string;
 
     [[nodiscard]] auto contains( std::string_view key, uint64_t * foundHash = nullptr ) const -> bool
     {
         auto hash = HashAlgo::hash( key );
-        auto keySlotOffset = mProbe.findKeySlotOffset( key, hash, mKeySpacePtr );
+        auto keySlotOffset = findKeySlotOffset( key, hash );
         setFoundHash( foundHash, hash, keySlotOffset );
         return mValueMgr.contains( mKeySpacePtr, keySlotOffset, key );
     }
 
+    [[nodiscard]] auto contains( std::string_view key, KeyHash hash ) const -> bool
+    {
+        return mValueMgr.contains( mKeySpacePtr, findKeySlotOffset( key, hash.value ), key );
+    }
+
+    // Decode a getWithType result the way the typed getters do, for callers that keep such results (see HotKeyCache)
+    [[nodiscard]] static auto toBool( std::string_view key, std::pair<std::string_view, CacheValueType> valueAndType, bool defaultValue ) -> std::pair<bool, bool>;
+    [[nodiscard]] static auto toInt64( std::string_view key, std::pair<std::string_view, CacheValueType> valueAndType, int64_t defaultValue ) -> std::pair<int64_t, bool>;
+    [[nodiscard]] static auto toDouble( std::string_view key, std::pair<std::string_view, CacheValueType> valueAndType, double defaultValue ) -> std::pair<double, bool>;
+
     // C-Cache migration methods
     auto readKey( std::string_view key, uint64_t * foundHash = nullptr ) -> std::string_view;
     auto readKeys( std::string_view key, uint64_t * foundHash = nullptr ) -> std::vector<std::string_view>;
 
   protected:
+    static constexpr size_t kGetManyBatchSize = 32;
+
+    // Header flags only describe linear probe layouts
+    static constexpr bool kIsLinearProbe = requires( Probe & probe ) {
+        probe.setMaxDisplacement( 0U );
+        probe.setSlotMapping( SlotMapping::MODULO );
+    };
+
+    // POW2_MASK needs the slot count rounded up to a power of two before anything is sized from it
+    static auto keySlotsFor( uint64_t numberOfKeySlots, uint32_t headerFlags ) -> uint64_t
+    {
+        return toSlotMapping( headerFlags ) == SlotMapping::POW2_MASK ? math::roundUpToPowerOfTwo( numberOfKeySlots ) : numberOfKeySlots;
+    }
+
+    // Header flags that only linear probe caches support, other caches throw the first message
+    // whose flags they are given any of
+    static constexpr std::array<std::pair<uint32_t, std::string_view>, 7> kLinearProbeOnlyFlags{ {
+        { Constants::HeaderFlag::kRobinHood | Constants::HeaderFlag::kSlotMappingFastRange | Constants::HeaderFlag::kSlotMappingPow2Mask,
+          "Robin Hood placement and slot mapping are only supported by linear probe caches" },
+        { Constants::HeaderFlag::kNegativeLookupFilter, "The negative lookup filter is only supported by linear probe caches" },
+        { Constants::HeaderFlag::kNamespacePrefix, "Namespace prefixes are only supported by linear probe caches" },
+        { Constants::HeaderFlag::kKeyFingerprint, "Key fingerprints are only supported by linear probe caches" },
+        { Constants::HeaderFlag::kCompressedValues, "Compressed values are only supported by linear probe caches" },
+        { Constants::HeaderFlag::kSharedValues, "Shared values are only supported by linear probe caches" },
+        { Constants::HeaderFlag::kAlignedValues8 | Constants::HeaderFlag::kAlignedValues16, "Aligned values are only supported by linear probe caches" },
+    } };
+
+    // Header flags that can't be set together
+    static constexpr std::array<std::pair<uint32_t, std::string_view>, 2> kExclusiveFlags{ {
+        { Constants::HeaderFlag::kKeyFingerprint | Constants::HeaderFlag::kNamespacePrefix, "Key fingerprints and namespace prefixes can't be combined" },
+        { Constants::HeaderFlag::kSharedValues | Constants::HeaderFlag::kCompressedValues, "Shared values and compressed values can't be combined" },
+    } };
+
+    // Sections between the keySpace and the records of a linear probe cache, in file order. A
+    // section is only there when its header flag is set. End is where the last one ends, the
+    // records follow, after a gap with aligned values.
+    enum class Section : uint8_t
+    {
+        NegativeLookupFilter,
+        Namespaces,
+        ValueDictionary,
+        End
+    };
+
+    static constexpr std::array<uint32_t, static_cast<size_t>( Section::End )> kSectionFlags{ Constants::HeaderFlag::kNegativeLookupFilter, Constants::HeaderFlag::kNamespacePrefix,
+                                                                                               Constants::HeaderFlag::kCompressedValues };
+
+    // Offset of section from the keySpace start
+    [[nodiscard]] auto sectionOffset( Section section ) const -> uint64_t
+    {
+        return mProbe.keyspaceSize() + mSectionStarts[static_cast<size_t>( section )];
+    }
+
+    // Place the sections one after the other from the end of the keySpace, sizeOf( section, offset )
+    // giving the size of each section that is there
+    template<typename SizeOf>
+    auto layoutSections( SizeOf && sizeOf ) -> void
+    {
+        uint64_t start = 0U;
+        for ( size_t index = 0; index < kSectionFlags.size(); ++index )
+        {
+            mSectionStarts[index] = start;
+            if ( ( mHeader.flags & kSectionFlags[index] ) != 0U )
+            {
+                start += sizeOf( static_cast<Section>( index ), mProbe.keyspaceSize() + start );
+            }
+        }
+        mSectionStarts[kSectionFlags.size()] = start;
+    }
+
+    auto applyHeaderFlags() -> void
+    {
+        if constexpr ( kIsLinearProbe )
+        {
+            for ( const auto & [flags, message] : kExclusiveFlags )
+            {
+                if ( ( mHeader.flags & flags ) == flags )
+                {
+                    throw std::runtime_error( std::string{ message } );
+                }
+            }
+            mProbe.setSlotMapping( toSlotMapping( mHeader.flags ) );
+            if ( ( mHeader.flags & Constants::HeaderFlag::kRobinHood ) != 0U && mIsFinalized )
+            {
+                mProbe.setMaxDisplacement( mHeader.maxCollisions );
+            }
+            mIsKeyFingerprint = ( mHeader.flags & Constants::HeaderFlag::kKeyFingerprint ) != 0U;
+            if ( ( mHeader.flags & Constants::HeaderFlag::kNamespacePrefix ) != 0U && !mIsFinalized )
+            {
+                mNamespaces.enable();
+            }
+            if ( mIsFinalized )
+            {
+                // Each section is read where the previous one ends
+                layoutSections( [this]( Section section, uint64_t offset ) -> uint64_t
+                                {
+                                    switch ( section )
+                                    {
+                                        case Section::NegativeLookupFilter:
+                                            mFilter = BlockedBloomFilter( mKeySpacePtr + offset, BlockedBloomFilter::sizeFor( mHeader.numberOfEntries ) );
+                                            return mFilter.size();
+                                        case Section::Namespaces:
+                                            mNamespaces.load( mKeySpacePtr + offset );
+                                            return mNamespaces.size();
+                                        default:
+                                            mValueMgr.dictionary().load( mKeySpacePtr + offset );
+                                            return mValueMgr.dictionary().size();
+                                    }
+                                } );
+            }
+            if ( ( mHeader.flags & Constants::HeaderFlag::kSharedValues ) != 0U )
+            {
+                mValueMgr.shareValues( !mIsFinalized );
+            }
+            mValueMgr.alignValues( linear::valueAlignment( mHeader.flags ) );
+        }
+        else
+        {
+            for ( const auto & [flags, message] : kLinearProbeOnlyFlags )
+            {
+                if ( ( mHeader.flags & flags ) != 0U )
+                {
+                    throw std::runtime_error( std::string{ message } );
+                }
+            }
+        }
+    }
+
+    template<typename Lookup>
+    auto forEachPrefetched( std::span<const std::string_view> keys, Lookup && lookup ) const -> void
+    {
+        std::array<uint64_t, kGetManyBatchSize> hashes{};
+        for ( size_t begin = 0; begin < keys.size(); begin += kGetManyBatchSize )
+        {
+            const auto count = std::min( kGetManyBatchSize, keys.size() - begin );
+            for ( size_t i = 0; i < count; ++i )
+            {
+                hashes[i] = HashAlgo::hash( keys[begin + i] );
+                if ( mFilter.isEnabled() )
+                {
+                    mFilter.prefetch( hashes[i] );
+                }
+                mProbe.prefetchKeySlot( hashes[i], mKeySpacePtr );
+            }
+            for ( size_t i = 0; i < count; ++i )
+            {
+                mProbe.prefetchRecord( hashes[i], mKeySpacePtr );
+            }
+            for ( size_t i = 0; i < count; ++i )
+            {
+                lookup( keys[begin + i], hashes[i] );
+            }
+        }
+    }
+
     virtual auto putInternal( std::string_view key, CacheValueType type, std::string_view value ) -> std::pair<bool, uint32_t>;
 
+    [[nodiscard]] auto getManyInto( std::span<const std::string_view> keys, std::string * buffers, std::string_view defaultValue ) const -> std::vector<std::pair<std::string_view, bool>>
+    {
+        std::vector<std::pair<std::string_view, bool>> results;
+        results.reserve( keys.size() );
+        auto lookup = [&]( std::string_view key, uint64_t hash )
+        {
+            bool isExist = false;
+            const auto str = getHashedInternal( key, hash, CacheValueType::String, &isExist, buffers == nullptr ? nullptr : &buffers[results.size()] );
+            results.emplace_back( isExist ? StringViewToNullTerminatedString::trimExtraNullTerminator( str ) : defaultValue, isExist );
+        };
+        forEachPrefetched( keys, lookup );
+        return results;
+    }
+
+    // Misses that the negative lookup filter rules out return before the probe touches the keySpace
+    [[nodiscard]] auto findKeySlotOffset( std::string_view key, uint64_t hash ) const -> int64_t
+    {
+        if ( mFilter.isEnabled() && !mFilter.mayContain( hash ) )
+        {
+            return Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND;
+        }
+        if constexpr ( kIsLinearProbe )
+        {
+            if ( mNamespaces.isEnabled() || mIsKeyFingerprint )
+            {
+                return findStoredKeySlotOffset( key, hash, nullptr );
+            }
+        }
+        return mProbe.findKeySlotOffset( key, hash, mKeySpacePtr );
+    }
+
+    [[nodiscard]] auto findKeySlotOffset( std::string_view key, uint64_t hash, uint64_t * foundSlot ) const -> int64_t
+    {
+        if ( mFilter.isEnabled() && !mFilter.mayContain( hash ) )
+        {
+            return Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND;
+        }
+        if constexpr ( kIsLinearProbe )
+        {
+            if ( mNamespaces.isEnabled() || mIsKeyFingerprint )
+            {
+                return findStoredKeySlotOffset( key, hash, foundSlot );
+            }
+        }
+        return mProbe.findKeySlotOffset( key, hash, mKeySpacePtr, foundSlot );
+    }
+
+    // Records of a namespace prefix or key fingerprint cache hold the stored form of the key, see
+    // NamespaceTable and KeyFingerprint
+    [[nodiscard]] auto findStoredKeySlotOffset( std::string_view key, uint64_t hash, uint64_t * foundSlot ) const -> int64_t
+    {
+        StoredKey storedKey;
+        if ( mIsKeyFingerprint )
+        {
+            KeyFingerprint::toStoredKey( key, hash, storedKey );
+        }
+        else if ( !mNamespaces.toStoredKey( key, storedKey ) )
+        {
+            return Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND;
+        }
+        return mProbe.findKeySlotOffset( storedKey.view(), hash, mKeySpacePtr, foundSlot );
+    }
+
+    // Key as put in the records, storedKey keeps the bytes when it differs from key
+    auto toStoredKey( std::string_view key, uint64_t hash, StoredKey & storedKey ) -> std::string_view
+    {
+        if ( mIsKeyFingerprint )
+        {
+            KeyFingerprint::toStoredKey( key, hash, storedKey );
+            return storedKey.view();
+        }
+        if ( !mNamespaces.isEnabled() )
+        {
+            return key;
+        }
+        mNamespaces.addStoredKey( key, storedKey );
+        return storedKey.view();
+    }
+
+    [[nodiscard]] auto hashStoredKey( std::string_view storedKey ) const -> uint64_t
+    {
+        if ( mIsKeyFingerprint )
+        {
+            return KeyFingerprint::hash( storedKey );
+        }
+        return mNamespaces.isEnabled() ? HashAlgo::hash( mNamespaces.toKey( storedKey ) ) : HashAlgo::hash( storedKey );
+    }
+
+    // The filter is a view into the buffer and only knows the keys present when it was built
+    auto checkNoFilter() const -> void
+    {
+        if ( mFilter.isEnabled() )
+        {
+            throw std::runtime_error( "can't put into a cache once its negative lookup filter is built" );
+        }
+    }
+
+    // Decoding shared by the overloads that hash the key and the ones that take its KeyHash
+    [[nodiscard]] static auto trimWithType( std::pair<std::string_view, CacheValueType> valueAndType ) -> std::pair<std::string_view, CacheValueType>
+    {
+        switch ( valueAndType.second )
+        {
+            case CacheValueType::String:
+                return std::make_pair( valueAndType.first.empty() ? valueAndType.first : StringViewToNullTerminatedString::trimExtraNullTerminator( valueAndType.first ), valueAndType.second );
+            case CacheValueType::StringList:
+                return std::make_pair( std::string_view{}, valueAndType.second ); // Not supported
+            default:
+                break;
+        }
+        return valueAndType;
+    }
+
+    [[nodiscard]] static auto toFloatVector( std::string_view key, std::pair<std::string_view, CacheValueType> valueAndType ) -> std::vector<float>;
+    [[nodiscard]] static auto toFloatSpan( std::string_view key, std::pair<std::string_view, CacheValueType> valueAndType ) -> std::span<const float>;
+
     // Surfaces the already-computed hash of the cache access key. Writes 0 when the key is
     // absent, so callers can treat 0 as "no key, do not mark". The absence signal is exact for
     // LinearProbe (findKeySlotOffset returns NOT_FOUND on a miss); for SimpleProbe/chained caches
@@ -268,27 +937,42 @@ class HashedCacheBase : public CacheBase
     [[nodiscard]] virtual auto getInternal( std::string_view key, CacheValueType type, uint64_t * foundHash = nullptr ) const -> std::string_view
     {
         auto hash = HashAlgo::hash( key );
-        auto keySlotOffset = mProbe.findKeySlotOffset( key, hash, mKeySpacePtr );
+        auto keySlotOffset = findKeySlotOffset( key, hash );
         bool isExist = false;
         setFoundHash( foundHash, hash, keySlotOffset );
         return mValueMgr.get( mKeySpacePtr, keySlotOffset, key, static_cast<uint8_t>( type ), &isExist );
     }
 
-    [[nodiscard]] virtual auto getInternal( std::string_view key, CacheValueType type, bool * isExist, uint64_t * foundHash = nullptr ) const -> std::string_view
+    // Lookups given a buffer decompress compressed values into it, the others into a buffer of the
+    // calling thread that the next of them overwrites
+    [[nodiscard]] virtual auto getInternal( std::string_view key, CacheValueType type, bool * isExist, uint64_t * foundHash = nullptr, std::string * buffer = nullptr ) const -> std::string_view
     {
         auto hash = HashAlgo::hash( key );
-        auto keySlotOffset = mProbe.findKeySlotOffset( key, hash, mKeySpacePtr );
+        auto keySlotOffset = findKeySlotOffset( key, hash );
         *isExist = ( keySlotOffset != Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND );
         setFoundHash( foundHash, hash, keySlotOffset );
-        return mValueMgr.get( mKeySpacePtr, keySlotOffset, key, static_cast<uint8_t>( type ), isExist );
+        return mValueMgr.get( mKeySpacePtr, keySlotOffset, key, static_cast<uint8_t>( type ), isExist, buffer );
     }
 
-    [[nodiscard]] virtual auto getWithTypeInternal( std::string_view key, uint64_t * foundHash = nullptr ) const -> std::pair<std::string_view, CacheValueType>
+    // Lookup for a key whose hash the caller already computed
+    [[nodiscard]] virtual auto getHashedInternal( std::string_view key, uint64_t hash, CacheValueType type, bool * isExist, std::string * buffer = nullptr ) const -> std::string_view
+    {
+        auto keySlotOffset = findKeySlotOffset( key, hash );
+        *isExist = ( keySlotOffset != Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND );
+        return mValueMgr.get( mKeySpacePtr, keySlotOffset, key, static_cast<uint8_t>( type ), isExist, buffer );
+    }
+
+    [[nodiscard]] virtual auto getWithTypeInternal( std::string_view key, uint64_t * foundHash = nullptr, std::string * buffer = nullptr ) const -> std::pair<std::string_view, CacheValueType>
     {
         auto hash = HashAlgo::hash( key );
-        auto keySlotOffset = mProbe.findKeySlotOffset( key, hash, mKeySpacePtr );
+        auto keySlotOffset = findKeySlotOffset( key, hash );
         setFoundHash( foundHash, hash, keySlotOffset );
-        return mValueMgr.getWithType( mKeySpacePtr, keySlotOffset, {} );
+        return mValueMgr.getWithType( mKeySpacePtr, keySlotOffset, {}, buffer );
+    }
+
+    [[nodiscard]] virtual auto getWithTypeHashedInternal( std::string_view key, uint64_t hash, std::string * buffer = nullptr ) const -> std::pair<std::string_view, CacheValueType>
+    {
+        return mValueMgr.getWithType( mKeySpacePtr, findKeySlotOffset( key, hash ), {}, buffer );
     }
 
     uint64_t mMaxNumberOfEntries;
@@ -296,6 +980,13 @@ class HashedCacheBase : public CacheBase
     CacheHeader mHeader;
     Probe mProbe;
     ValueMgr mValueMgr;
+    BlockedBloomFilter mFilter;
+    NamespaceTable mNamespaces;
+    // Start of each Section after the keySpace, see layoutSections
+    std::array<uint64_t, static_cast<size_t>( Section::End ) + 1> mSectionStarts{};
+    bool mIsKeyFingerprint{ false };
+    bool mHasNewValueTypes{ false };
+    bool mIsFinalized;
 };
 
 } // axoncache
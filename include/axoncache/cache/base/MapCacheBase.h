@@ -66,6 +66,24 @@ class MapCacheBase : public CacheBase
         return std::make_pair( false, 0 );
     }
 
+    auto put( std::string_view /* key */, const std::vector<float> & /* value */, CacheValueType /* listType */ ) -> std::pair<bool, uint32_t> override
+    {
+        // not supported
+        return std::make_pair( false, 0 );
+    }
+
+    auto put( std::string_view /* key */, const std::vector<int64_t> & /* value */ ) -> std::pair<bool, uint32_t> override
+    {
+        // not supported
+        return std::make_pair( false, 0 );
+    }
+
+    auto put( std::string_view /* key */, const std::vector<int64_t> & /* value */, CacheValueType /* listType */ ) -> std::pair<bool, uint32_t> override
+    {
+        // not supported
+        return std::make_pair( false, 0 );
+    }
+
     [[nodiscard]] auto type() const -> CacheType override
     {
         return CacheType::MAP;
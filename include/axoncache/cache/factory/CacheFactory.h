@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <stdint.h>
+#include "axoncache/Constants.h"
 namespace axoncache
 {
 class CacheBase;
@@ -19,6 +20,7 @@ namespace axoncache
 class CacheFactory
 {
   public:
-    static auto createCache( uint16_t offsetBits, uint64_t numberOfKeySlots, double maxLoadFactor, CacheType type ) -> std::unique_ptr<CacheBase>;
+    // hashFuncId WYHASH is only supported by CacheType::LINEAR_PROBE
+    static auto createCache( uint16_t offsetBits, uint64_t numberOfKeySlots, double maxLoadFactor, CacheType type, uint32_t headerFlags = 0U, uint16_t hashFuncId = Constants::HashFuncId::XXH3 ) -> std::unique_ptr<CacheBase>;
 };
 }
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+namespace axoncache
+{
+// Split block Bloom filter over the key hashes. A key sets one bit in each of the eight 32-bit
+// words of a 32-byte block, so a query reads a single block instead of walking a probe cluster.
+// With kBitsPerKey the false positive rate is about 0.5%, and there are no false negatives.
+//
+// The filter does not own its memory: it is a view over kBlockSize aligned bytes in the cache.
+class BlockedBloomFilter
+{
+  public:
+    static constexpr uint64_t kBlockSize = 32;
+    static constexpr uint64_t kBitsPerKey = 12;
+
+    // Size in bytes of the filter for numberOfKeys keys, a multiple of kBlockSize
+    [[nodiscard]] static auto sizeFor( uint64_t numberOfKeys ) -> uint64_t
+    {
+        const auto bitsPerBlock = kBlockSize * 8;
+        return std::max<uint64_t>( 1U, ( numberOfKeys * kBitsPerKey + bitsPerBlock - 1 ) / bitsPerBlock ) * kBlockSize;
+    }
+
+    BlockedBloomFilter() = default;
+
+    BlockedBloomFilter( uint8_t * data, uint64_t size ) :
+        mBlocks( reinterpret_cast<uint32_t *>( data ) ),
+        mNumberOfBlocks( size / kBlockSize )
+    {
+    }
+
+    [[nodiscard]] auto isEnabled() const -> bool
+    {
+        return mBlocks != nullptr;
+    }
+
+    [[nodiscard]] auto size() const -> uint64_t
+    {
+        return mNumberOfBlocks * kBlockSize;
+    }
+
+    auto insert( uint64_t hash ) -> void
+    {
+        auto * block = blockOf( hash );
+        for ( size_t word = 0; word < kWordsPerBlock; ++word )
+        {
+            block[word] |= bitOf( hash, word );
+        }
+    }
+
+    // False only for hashes that were never inserted
+    [[nodiscard]] auto mayContain( uint64_t hash ) const -> bool
+    {
+        const auto * block = blockOf( hash );
+        uint32_t missing = 0;
+        for ( size_t word = 0; word < kWordsPerBlock; ++word )
+        {
+            missing |= bitOf( hash, word ) & ~block[word];
+        }
+        return missing == 0U;
+    }
+
+    auto prefetch( uint64_t hash ) const -> void
+    {
+        __builtin_prefetch( blockOf( hash ) );
+    }
+
+  private:
+    static constexpr size_t kWordsPerBlock = kBlockSize / sizeof( uint32_t );
+
+    // Odd constants from the Parquet split block Bloom filter, one per word
+    static constexpr std::array<uint32_t, kWordsPerBlock> kSalts{ 0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U };
+
+    // The high half of the hash picks the block, the low half the bits inside it
+    [[nodiscard]] auto blockOf( uint64_t hash ) const -> uint32_t *
+    {
+        return mBlocks + ( ( ( hash >> 32U ) * mNumberOfBlocks ) >> 32U ) * kWordsPerBlock;
+    }
+
+    [[nodiscard]] static auto bitOf( uint64_t hash, size_t word ) -> uint32_t
+    {
+        return 1U << ( ( static_cast<uint32_t>( hash ) * kSalts[word] ) >> 27U );
+    }
+
+    uint32_t * mBlocks{ nullptr };
+    uint64_t mNumberOfBlocks{ 0 };
+};
+} // namespace axoncache
@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include "axoncache/Constants.h"
+
+namespace axoncache
+{
+// Setting values: "xxh3" or "wyhash". The writer records the id in CacheHeader::hashFuncId.
+[[nodiscard]] inline auto hashFuncIdFromName( std::string_view name ) -> uint16_t
+{
+    if ( name.empty() || name == "xxh3" )
+    {
+        return Constants::HashFuncId::XXH3;
+    }
+    if ( name == "wyhash" )
+    {
+        return Constants::HashFuncId::WYHASH;
+    }
+    throw std::runtime_error( "Unknown hash function " + std::string{ name } + ", expected one of xxh3, wyhash" );
+}
+}
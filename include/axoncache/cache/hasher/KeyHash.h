@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+
+namespace axoncache
+{
+// Hash of a key returned by hashKey(). It can be passed to the get*( key, hash ) overloads of
+// every cache with the same hashFuncId, so looking a key up in several caches hashes it once.
+// A struct rather than a bare uint64_t so those overloads never compete with the default value ones.
+struct KeyHash
+{
+    uint64_t value;
+};
+} // namespace axoncache
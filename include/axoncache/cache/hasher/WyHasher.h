@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <string_view>
+#include <cstdint>
+#include <cstring>
+#include "axoncache/Constants.h"
+
+namespace axoncache
+{
+// wyhash (final version 4) with the default secret, keys use seed 0. Short keys, the common case,
+// take two 64-bit multiplies and no loop. It is inline: for an 8 to 64 byte key the call into
+// Xxh3Hasher costs about as much as the hash itself.
+//
+// Hashes are part of the file format, they must never change for the same key.
+class WyHasher
+{
+  public:
+    static auto hash( std::string_view val ) -> uint64_t
+    {
+        return hash( val, 0U );
+    }
+
+    // Same as upstream wyhash( val, seed ), other seeds are only used to check the test vectors
+    static auto hash( std::string_view val, uint64_t seed ) -> uint64_t
+    {
+        const auto * ptr = reinterpret_cast<const uint8_t *>( val.data() );
+        const auto len = static_cast<uint64_t>( val.size() );
+        seed ^= mix( seed ^ kSecret[0], kSecret[1] );
+        uint64_t a = 0;
+        uint64_t b = 0;
+        if ( len <= 16U )
+        {
+            if ( len >= 4U )
+            {
+                const auto middle = ( len >> 3U ) << 2U;
+                a = ( read4( ptr ) << 32U ) | read4( ptr + middle );
+                b = ( read4( ptr + len - 4U ) << 32U ) | read4( ptr + len - 4U - middle );
+            }
+            else if ( len > 0U )
+            {
+                a = ( static_cast<uint64_t>( ptr[0] ) << 16U ) | ( static_cast<uint64_t>( ptr[len >> 1U] ) << 8U ) | ptr[len - 1U];
+            }
+        }
+        else
+        {
+            auto remaining = len;
+            if ( remaining > 48U )
+            {
+                auto seed1 = seed;
+                auto seed2 = seed;
+                do
+                {
+                    seed = mix( read8( ptr ) ^ kSecret[1], read8( ptr + 8 ) ^ seed );
+                    seed1 = mix( read8( ptr + 16 ) ^ kSecret[2], read8( ptr + 24 ) ^ seed1 );
+                    seed2 = mix( read8( ptr + 32 ) ^ kSecret[3], read8( ptr + 40 ) ^ seed2 );
+                    ptr += 48;
+                    remaining -= 48U;
+                } while ( remaining > 48U );
+                seed ^= seed1 ^ seed2;
+            }
+            while ( remaining > 16U )
+            {
+                seed = mix( read8( ptr ) ^ kSecret[1], read8( ptr + 8 ) ^ seed );
+                ptr += 16;
+                remaining -= 16U;
+            }
+            a = read8( ptr + remaining - 16U );
+            b = read8( ptr + remaining - 8U );
+        }
+        a ^= kSecret[1];
+        b ^= seed;
+        multiply( a, b );
+        return mix( a ^ kSecret[0] ^ len, b ^ kSecret[1] );
+    }
+
+    static auto hashFuncId() -> uint16_t
+    {
+        return Constants::HashFuncId::WYHASH;
+    }
+
+  private:
+    static constexpr uint64_t kSecret[4] = { 0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL };
+
+    // 128-bit product, low half in a and high half in b
+    static auto multiply( uint64_t & a, uint64_t & b ) -> void
+    {
+        const auto product = static_cast<unsigned __int128>( a ) * b;
+        a = static_cast<uint64_t>( product );
+        b = static_cast<uint64_t>( product >> 64U );
+    }
+
+    static auto mix( uint64_t a, uint64_t b ) -> uint64_t
+    {
+        multiply( a, b );
+        return a ^ b;
+    }
+
+    static auto read8( const uint8_t * ptr ) -> uint64_t
+    {
+        uint64_t value = 0;
+        std::memcpy( &value, ptr, sizeof( value ) );
+        return value;
+    }
+
+    static auto read4( const uint8_t * ptr ) -> uint64_t
+    {
+        uint32_t value = 0;
+        std::memcpy( &value, ptr, sizeof( value ) );
+        return value;
+    }
+};
+} // namespace axoncache
@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include "axoncache/cache/key/StoredKey.h"
+
+namespace axoncache
+{
+// Records of a cache in key fingerprint mode (HeaderFlag::kKeyFingerprint) hold 16 bytes instead
+// of the key: the 64-bit key hash the slots are built from, then a second 64-bit hash of the key
+// with an independent seed. Lookups compare these 16 bytes and never the key, which is not stored.
+//
+// Two different keys only share a fingerprint if both hashes collide, about 2^-128 for a pair of
+// keys. A missing key is reported present with that probability for each record it is compared
+// to, and a put of a new key is rejected as existing with about n * 2^-128 over n stored keys.
+// Only use it where such a false positive is acceptable.
+class KeyFingerprint
+{
+  public:
+    static constexpr size_t kSize = 2 * sizeof( uint64_t );
+
+    // Stored form of a key whose hash is hash, as computed by the cache hasher
+    static auto toStoredKey( std::string_view key, uint64_t hash, StoredKey & storedKey ) -> void
+    {
+        const auto second = secondHash( key );
+        storedKey.assign( { reinterpret_cast<const char *>( &hash ), sizeof( hash ) }, { reinterpret_cast<const char *>( &second ), sizeof( second ) } );
+    }
+
+    // Key hash of a stored key, for rebuilding the layout without the key
+    [[nodiscard]] static auto hash( std::string_view storedKey ) -> uint64_t
+    {
+        uint64_t hash = 0;
+        std::memcpy( &hash, storedKey.data(), sizeof( hash ) );
+        return hash;
+    }
+
+    [[nodiscard]] static auto secondHash( std::string_view key ) -> uint64_t;
+};
+} // namespace axoncache
@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "axoncache/cache/key/StoredKey.h"
+
+namespace axoncache
+{
+// Namespaces of a cache in namespace prefix mode (HeaderFlag::kNamespacePrefix). A key is split
+// on its first separator, "resourceId.keyName", and its record stores the 2-byte id of
+// "resourceId" followed by "keyName" instead of the whole key. Keys without a separator get
+// id 0 and keep all their bytes. Key hashes are not affected, they are always over the whole key.
+//
+// Section layout: [ uint64_t size ][ uint32_t count ][ uint32_t 0 ][ uint16_t length ] * count
+//                 [ namespace bytes ] * count [ zeros up to a multiple of 8 ]
+class NamespaceTable
+{
+  public:
+    static constexpr char kSeparator = '.';
+    static constexpr uint16_t kNoNamespace = 0;
+    static constexpr size_t kMaxNamespaces = UINT16_MAX;
+    static constexpr size_t kIdSize = sizeof( uint16_t );
+
+    NamespaceTable() = default;
+    NamespaceTable( const NamespaceTable & ) = delete;
+    auto operator=( const NamespaceTable & ) -> NamespaceTable & = delete;
+
+    [[nodiscard]] auto isEnabled() const -> bool
+    {
+        return mIsEnabled;
+    }
+
+    // Start collecting the namespaces of the keys put in the cache
+    auto enable() -> void
+    {
+        mIsEnabled = true;
+    }
+
+    [[nodiscard]] auto numberOfNamespaces() const -> size_t
+    {
+        return mNamespaces.size();
+    }
+
+    // Size in bytes of the section, a multiple of 8
+    [[nodiscard]] auto size() const -> uint64_t
+    {
+        return mSize;
+    }
+
+    // Stored form of key for a lookup. False when its namespace is not in the table, then no
+    // stored key can match.
+    [[nodiscard]] auto toStoredKey( std::string_view key, StoredKey & storedKey ) const -> bool
+    {
+        const auto separator = key.find( kSeparator );
+        if ( separator == std::string_view::npos )
+        {
+            assign( kNoNamespace, key, storedKey );
+            return true;
+        }
+        const auto iter = mIds.find( key.substr( 0, separator ) );
+        if ( iter == mIds.end() )
+        {
+            return false;
+        }
+        assign( iter->second, key.substr( separator + 1 ), storedKey );
+        return true;
+    }
+
+    // Stored form of key for a put, the namespace is added to the table if it is new
+    auto addStoredKey( std::string_view key, StoredKey & storedKey ) -> void;
+
+    // Whole key of a stored key
+    [[nodiscard]] auto toKey( std::string_view storedKey ) const -> std::string;
+
+    // Serialized size of the namespaces collected so far
+    [[nodiscard]] auto serializedSize() const -> uint64_t;
+
+    // Write the section to data, serializedSize() bytes
+    auto write( uint8_t * data ) -> void;
+
+    // Namespaces of a section written by write, data must outlive the table
+    auto load( const uint8_t * data ) -> void;
+
+  private:
+    static auto assign( uint16_t id, std::string_view suffix, StoredKey & storedKey ) -> void
+    {
+        storedKey.assign( { reinterpret_cast<const char *>( &id ), kIdSize }, suffix );
+    }
+
+    bool mIsEnabled{ false };
+    uint64_t mSize{ 0U };
+    std::vector<std::string_view> mNamespaces; // by id - 1
+    std::unordered_map<std::string_view, uint16_t> mIds;
+    std::deque<std::string> mOwned; // namespaces added by puts, a deque never moves them
+};
+} // namespace axoncache
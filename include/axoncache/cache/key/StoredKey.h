@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace axoncache
+{
+// Key as put in the records when it differs from the key looked up, see NamespaceTable and
+// KeyFingerprint. On the stack unless the key is long.
+class StoredKey
+{
+  public:
+    [[nodiscard]] auto view() const -> std::string_view
+    {
+        return mView;
+    }
+
+    auto assign( std::string_view prefix, std::string_view suffix ) -> void
+    {
+        char * data = mInline.data();
+        if ( prefix.size() + suffix.size() > mInline.size() )
+        {
+            mHeap.resize( prefix.size() + suffix.size() );
+            data = mHeap.data();
+        }
+        std::memcpy( data, prefix.data(), prefix.size() );
+        std::memcpy( data + prefix.size(), suffix.data(), suffix.size() );
+        mView = { data, prefix.size() + suffix.size() };
+    }
+
+  private:
+    std::array<char, 256> mInline;
+    std::string mHeap;
+    std::string_view mView;
+};
+} // namespace axoncache
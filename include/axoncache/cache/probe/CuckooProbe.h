@@ -0,0 +1,264 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <string_view>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include "axoncache/Constants.h"
+#include "axoncache/cache/CacheType.h"
+#include "axoncache/cache/probe/LinearProbe.h"
+#include "axoncache/domain/CacheHeader.h"
+
+namespace axoncache
+{
+namespace cuckoo
+{
+constexpr uint64_t kSlotsPerBucket = 8; // 64 bytes, one cache line
+
+// Slots in front of the first bucket so that buckets start on a cache line in a mapped file,
+// where the keySpace follows the header. Readers get it back as numberOfKeySlots % kSlotsPerBucket.
+constexpr uint64_t kPaddingSlots = ( ( 64U - sizeof( CacheHeader ) % 64U ) % 64U ) / sizeof( uint64_t );
+static_assert( kPaddingSlots < kSlotsPerBucket );
+
+// Whole buckets plus the padding, never less than one bucket
+[[nodiscard]] inline auto keySlotsFor( uint64_t numberOfKeySlots ) -> uint64_t
+{
+    const auto numberOfBuckets = std::max<uint64_t>( 1U, ( numberOfKeySlots + kSlotsPerBucket - 1U ) / kSlotsPerBucket );
+    return numberOfBuckets * kSlotsPerBucket + kPaddingSlots;
+}
+
+// Both buckets of a key only depend on the hashcode bits kept in its slot, so the builder can
+// move a slot to its other bucket without reading the record to hash the key again.
+struct Layout
+{
+    uint64_t numberOfBuckets;
+    uint64_t paddingSlots;
+    uint64_t hashcodeMask;
+
+    [[nodiscard]] auto firstBucket( uint64_t hashcode ) const -> uint64_t
+    {
+        return static_cast<uint64_t>( ( static_cast<unsigned __int128>( hashcode & hashcodeMask ) * numberOfBuckets ) >> 64U );
+    }
+
+    [[nodiscard]] auto secondBucket( uint64_t hashcode ) const -> uint64_t
+    {
+        // An odd multiplier spreads the hashcode bits, a different bucket whenever there is one
+        const auto mixed = ( hashcode & hashcodeMask ) * 0xC2B2AE3D27D4EB4FULL;
+        const auto bucket = static_cast<uint64_t>( ( static_cast<unsigned __int128>( mixed ^ ( mixed >> 29U ) ) * numberOfBuckets ) >> 64U );
+        const auto first = firstBucket( hashcode );
+        return bucket != first || numberOfBuckets == 1U ? bucket : ( first + 1U == numberOfBuckets ? 0U : first + 1U );
+    }
+
+    [[nodiscard]] auto otherBucket( uint64_t hashcode, uint64_t bucket ) const -> uint64_t
+    {
+        const auto first = firstBucket( hashcode );
+        return bucket == first ? secondBucket( hashcode ) : first;
+    }
+
+    [[nodiscard]] auto firstSlotId( uint64_t bucket ) const -> uint64_t
+    {
+        return paddingSlots + bucket * kSlotsPerBucket;
+    }
+};
+
+// Frees a slot in one of the two buckets by moving slots to their other bucket along the
+// shortest path found by a bounded breadth-first search. Return the id of the freed slot,
+// or -1 if no path short enough exists.
+[[nodiscard]] auto makeRoom( const Layout & layout, uint64_t offsetMask, uint64_t * slots, uint64_t firstBucket, uint64_t secondBucket ) -> int64_t;
+}
+
+// Bucketized cuckoo hashing: a key lives in one of the 8 slots of one of its 2 buckets, and a
+// bucket is one 64-byte cache line. Lookups, hits and misses alike, read at most 2 lines of
+// the keySpace, whatever the load factor, which can go well above linear probing's.
+//
+// Slots use the linear probe encoding (hashcode bits above offsetBits, record offset below),
+// so LinearProbeValue reads them. Inserting into two full buckets moves other slots around;
+// records never move.
+//
+// KeySpace layout: [ padding slots ][ bucket 0: 8 slots ][ bucket 1 ] ...
+template<uint32_t KeyWidth>
+class CuckooProbe
+{
+  public:
+    CuckooProbe( uint16_t offsetBits, uint64_t numberOfKeySlots ) :
+        mLinearProbe( offsetBits, numberOfKeySlots ),
+        mLayout{ numberOfKeySlots / cuckoo::kSlotsPerBucket, numberOfKeySlots % cuckoo::kSlotsPerBucket, mLinearProbe.hashcodeMask() },
+        mKeyspaceSizeOffset( numberOfKeySlots * KeyWidth - 8 )
+    {
+        if ( mLayout.numberOfBuckets == 0U )
+        {
+            throw std::runtime_error( "CUCKOO needs at least " + std::to_string( cuckoo::kSlotsPerBucket ) + " key slots" );
+        }
+    }
+
+    [[nodiscard]] auto log2OfKeyWidth() const -> uint16_t
+    {
+        return mLinearProbe.log2OfKeyWidth();
+    }
+
+    [[nodiscard]] auto cacheType() const -> axoncache::CacheType
+    {
+        return CacheType::CUCKOO;
+    }
+
+    [[nodiscard]] auto hashcodeBits() const -> uint16_t
+    {
+        return mLinearProbe.hashcodeBits();
+    }
+
+    [[nodiscard]] auto offsetBits() const -> uint16_t
+    {
+        return mLinearProbe.offsetBits();
+    }
+
+    [[nodiscard]] auto numberOfKeySlots() const -> uint64_t
+    {
+        return mLinearProbe.numberOfKeySlots();
+    }
+
+    [[nodiscard]] auto keyspaceSize() const -> uint64_t
+    {
+        return mLinearProbe.keyspaceSize();
+    }
+
+    [[nodiscard]] auto hashcodeMask() const -> uint64_t
+    {
+        return mLinearProbe.hashcodeMask();
+    }
+
+    [[nodiscard]] auto offsetMask() const -> uint64_t
+    {
+        return mLinearProbe.offsetMask();
+    }
+
+    [[nodiscard]] auto keySlotToPtrOffset( uint64_t keySlot ) const -> uint64_t
+    {
+        return mLinearProbe.keySlotToPtrOffset( keySlot );
+    }
+
+    [[nodiscard]] auto calculateKeySpaceSize() const -> uint64_t
+    {
+        return mLinearProbe.calculateKeySpaceSize();
+    }
+
+    [[nodiscard]] auto numberOfBuckets() const -> uint64_t
+    {
+        return mLayout.numberOfBuckets;
+    }
+
+    [[nodiscard]] auto buckets( uint64_t hashcode ) const -> std::pair<uint64_t, uint64_t>
+    {
+        return { mLayout.firstBucket( hashcode ), mLayout.secondBucket( hashcode ) };
+    }
+
+    [[nodiscard]] auto findKeySlotOffset( std::string_view key, uint64_t hashcode, const uint8_t * keySpacePtr, uint64_t * foundSlot = nullptr ) const -> int64_t
+    {
+        const auto slotId = findInBucket( key, hashcode, keySpacePtr, mLayout.firstBucket( hashcode ), foundSlot );
+        if ( slotId != Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND )
+        {
+            return slotId;
+        }
+        return findInBucket( key, hashcode, keySpacePtr, mLayout.secondBucket( hashcode ), foundSlot );
+    }
+
+    // Takes the first empty slot of the first then the second bucket, and makes room when both are full
+    [[nodiscard]] auto findFreeKeySlotOffset( std::string_view key, uint64_t hashcode, uint8_t * keySpacePtr, uint32_t & collisions ) -> int64_t
+    {
+        collisions = 0;
+        if ( findKeySlotOffset( key, hashcode, keySpacePtr ) != Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND )
+        {
+            return Constants::ProbeStatus::AXONCACHE_KEY_EXISTS;
+        }
+
+        auto * slots = reinterpret_cast<uint64_t *>( keySpacePtr );
+        const auto firstBucket = mLayout.firstBucket( hashcode );
+        const auto secondBucket = mLayout.secondBucket( hashcode );
+        for ( const auto bucket : { firstBucket, secondBucket } )
+        {
+            for ( auto slotId = mLayout.firstSlotId( bucket ); slotId < mLayout.firstSlotId( bucket ) + cuckoo::kSlotsPerBucket; ++slotId )
+            {
+                if ( ( slots[slotId] & offsetMask() ) == 0UL )
+                {
+                    return keySlotToPtrOffset( slotId );
+                }
+            }
+            ++collisions;
+        }
+
+        const auto slotId = cuckoo::makeRoom( mLayout, offsetMask(), slots, firstBucket, secondBucket );
+        if ( slotId < 0 )
+        {
+            throw std::runtime_error( "keySpace is full, no cuckoo path frees a slot" );
+        }
+        return keySlotToPtrOffset( static_cast<uint64_t>( slotId ) );
+    }
+
+    auto prefetchKeySlot( uint64_t hashcode, const uint8_t * keySpacePtr ) const -> void
+    {
+        const auto * slots = reinterpret_cast<const uint64_t *>( keySpacePtr );
+        __builtin_prefetch( slots + mLayout.firstSlotId( mLayout.firstBucket( hashcode ) ) );
+        __builtin_prefetch( slots + mLayout.firstSlotId( mLayout.secondBucket( hashcode ) ) );
+    }
+
+    // The first slot of either bucket with the same hashcode bits is the likely hit
+    auto prefetchRecord( uint64_t hashcode, const uint8_t * keySpacePtr ) const -> void
+    {
+        const auto * slots = reinterpret_cast<const uint64_t *>( keySpacePtr );
+        for ( const auto bucket : { mLayout.firstBucket( hashcode ), mLayout.secondBucket( hashcode ) } )
+        {
+            for ( auto slotId = mLayout.firstSlotId( bucket ); slotId < mLayout.firstSlotId( bucket ) + cuckoo::kSlotsPerBucket; ++slotId )
+            {
+                const auto slot = slots[slotId];
+                if ( ( slot & offsetMask() ) != 0UL && ( slot & hashcodeMask() ) == ( hashcode & hashcodeMask() ) )
+                {
+                    __builtin_prefetch( keySpacePtr + ( slot & offsetMask() ) + mKeyspaceSizeOffset );
+                    return;
+                }
+            }
+        }
+    }
+
+    auto commitKeySlot( [[maybe_unused]] int64_t keySlotOffset, [[maybe_unused]] uint64_t hashcode, [[maybe_unused]] uint8_t * keySpacePtr ) const -> void
+    {
+    }
+
+  private:
+    [[nodiscard]] auto findInBucket( std::string_view key, uint64_t hashcode, const uint8_t * keySpacePtr, uint64_t bucket, uint64_t * foundSlot ) const -> int64_t
+    {
+        const auto cmpHashcode = hashcode & hashcodeMask();
+        const auto * slots = reinterpret_cast<const uint64_t *>( keySpacePtr ) + mLayout.firstSlotId( bucket );
+
+        // Compare the whole line first, a branch-free loop the compiler can vectorize
+        uint32_t matches = 0;
+        for ( uint32_t index = 0; index < cuckoo::kSlotsPerBucket; ++index )
+        {
+            matches |= static_cast<uint32_t>( ( slots[index] & hashcodeMask() ) == cmpHashcode && ( slots[index] & offsetMask() ) != 0UL ) << index;
+        }
+        while ( matches != 0U )
+        {
+            const auto index = static_cast<uint32_t>( __builtin_ctz( matches ) );
+            matches &= matches - 1U;
+            const auto slot = slots[index];
+            const auto * record = reinterpret_cast<const linear::LinearProbeRecord *>( keySpacePtr + ( slot & offsetMask() ) + mKeyspaceSizeOffset );
+            if ( record->keySize == key.size() && std::memcmp( ( const void * )record->data, key.data(), key.size() ) == 0 )
+            {
+                if ( foundSlot != nullptr )
+                {
+                    *foundSlot = slot;
+                }
+                return keySlotToPtrOffset( mLayout.firstSlotId( bucket ) + index );
+            }
+        }
+        return Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND;
+    }
+
+    LinearProbe<KeyWidth> mLinearProbe;
+    cuckoo::Layout mLayout;
+    uint64_t mKeyspaceSizeOffset;
+};
+} // namespace axoncache
@@ -4,8 +4,15 @@
 #pragma once
 
 #include "axoncache/Constants.h"
+#include "axoncache/cache/probe/SlotMapping.h"
+#include "axoncache/domain/CacheValue.h"
+#include <algorithm>
+#include <string>
 #include <string_view>
 #include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace axoncache
 {
@@ -24,6 +31,179 @@ struct __attribute__( ( __packed__ ) ) LinearProbeRecord
 static_assert( sizeof( LinearProbeRecord ) == 6, "sizeof( LinearProbeRecord ) != 6" );
 [[maybe_unused]] constexpr uint8_t kDedupFlag = 1 << 4;
 [[maybe_unused]] constexpr uint8_t kDedupExtendedFlag = 1;
+// The value is compressed against the cache ValueDictionary, valSize is its compressed size
+[[maybe_unused]] constexpr uint8_t kCompressedFlag = 1 << 1;
+// The record type is the CacheValueType on 5 bits: the 3 type bits hold the low bits, and these 2
+// bits of dedupIndex the high ones, 0 for the types up to FloatList
+[[maybe_unused]] constexpr uint8_t kTypeHighShift = 2;
+[[maybe_unused]] constexpr uint8_t kTypeHighMask = 3 << kTypeHighShift;
+
+constexpr auto recordType( uint8_t valueType ) -> uint8_t
+{
+    return valueType & 7U;
+}
+
+constexpr auto recordTypeBits( uint8_t valueType ) -> uint8_t
+{
+    return static_cast<uint8_t>( ( valueType >> 3U ) << kTypeHighShift );
+}
+
+inline auto valueType( const LinearProbeRecord * record ) -> uint8_t
+{
+    const auto typeBits = static_cast<uint8_t>( ( record->dedupIndex & kTypeHighMask ) >> kTypeHighShift );
+    return static_cast<uint8_t>( record->type | ( typeBits << 3U ) );
+}
+
+// A record sharing the value of another record (HeaderFlag::kSharedValues) stores, in place of
+// the value, the int64_t distance from itself to that record. valSize stays the value size. The
+// flags never meet otherwise, compressed records only have kCompressedFlag.
+[[maybe_unused]] constexpr uint8_t kSharedValueFlags = kCompressedFlag | kDedupExtendedFlag;
+
+inline auto isSharedValue( const LinearProbeRecord * record ) -> bool
+{
+    return ( record->dedupIndex & ( kCompressedFlag | kDedupExtendedFlag ) ) == kSharedValueFlags;
+}
+
+inline auto sharedValueDistance( const LinearProbeRecord * record ) -> int64_t
+{
+    int64_t distance = 0;
+    std::memcpy( &distance, record->data + record->keySize, sizeof( distance ) );
+    return distance;
+}
+
+inline auto sharedValue( const LinearProbeRecord * record ) -> std::string_view
+{
+    const auto * owner = reinterpret_cast<const LinearProbeRecord *>( reinterpret_cast<const char *>( record ) + sharedValueDistance( record ) );
+    return { owner->data + owner->keySize, record->valSize };
+}
+
+// Alignment of the values of a cache with HeaderFlag::kAlignedValues8 or kAlignedValues16, 0 for
+// packed records
+inline auto valueAlignment( uint32_t headerFlags ) -> uint64_t
+{
+    const auto isAligned8 = ( headerFlags & Constants::HeaderFlag::kAlignedValues8 ) != 0U;
+    const auto isAligned16 = ( headerFlags & Constants::HeaderFlag::kAlignedValues16 ) != 0U;
+    if ( isAligned8 && isAligned16 )
+    {
+        throw std::runtime_error( "Only one value alignment can be set in header flags " + std::to_string( headerFlags ) );
+    }
+    return isAligned16 ? 16U : ( isAligned8 ? 8U : 0U );
+}
+
+// Setting values: 0, 8 or 16
+inline auto valueAlignmentHeaderFlag( int64_t alignment ) -> uint32_t
+{
+    switch ( alignment )
+    {
+        case 0:
+            return 0U;
+        case 8:
+            return Constants::HeaderFlag::kAlignedValues8;
+        case 16:
+            return Constants::HeaderFlag::kAlignedValues16;
+        default:
+            throw std::runtime_error( "Unknown value alignment " + std::to_string( alignment ) + ", expected one of 0, 8, 16" );
+    }
+}
+
+// Zeroed bytes to put before record, written at fileOffset of the cache file, so that its value
+// starts on an alignment boundary. FloatList values, quantized ones included, get the whole
+// alignment, scalar values, Int64Lists and Bitmaps up to 8 bytes. Other values, and records that
+// hold an index or a distance instead of their value, are not aligned.
+inline auto recordPadding( uint64_t fileOffset, const LinearProbeRecord & record, uint64_t alignment ) -> uint64_t
+{
+    if ( alignment == 0U || ( record.dedupIndex & ( kDedupFlag | kDedupExtendedFlag | kCompressedFlag ) ) != 0U )
+    {
+        return 0U;
+    }
+    switch ( static_cast<CacheValueType>( valueType( &record ) ) )
+    {
+        case CacheValueType::Int64:
+        case CacheValueType::Double:
+        case CacheValueType::Int:
+        case CacheValueType::Float:
+        case CacheValueType::Int64List:
+        case CacheValueType::Bitmap:
+            alignment = std::min<uint64_t>( alignment, sizeof( int64_t ) );
+            break;
+        case CacheValueType::FloatList:
+        case CacheValueType::Float16List:
+        case CacheValueType::BFloat16List:
+        case CacheValueType::Int8List:
+            break;
+        default:
+            return 0U;
+    }
+    const auto valueOffset = fileOffset + sizeof( LinearProbeRecord ) + record.keySize;
+    return ( alignment - valueOffset % alignment ) % alignment;
+}
+
+// A deduplicated record stores the index of its frequent value in place of the value: 1 byte with
+// kDedupFlag, 2 bytes with kDedupExtendedFlag, and a LEB128 varint with both past 65535
+[[maybe_unused]] constexpr uint8_t kDedupVarintFlags = kDedupFlag | kDedupExtendedFlag;
+
+constexpr auto dedupFlags( uint32_t index ) -> uint8_t
+{
+    return index < 256U ? kDedupFlag : ( index < 65536U ? kDedupExtendedFlag : kDedupVarintFlags );
+}
+
+constexpr auto frequentValueIndexSize( uint32_t index ) -> uint32_t
+{
+    if ( index < 65536U )
+    {
+        return index < 256U ? 1U : 2U;
+    }
+    uint32_t size = 1U;
+    for ( ; index >= 0x80U; index >>= 7U )
+    {
+        ++size;
+    }
+    return size;
+}
+
+inline auto writeFrequentValueIndex( uint32_t index, char * out ) -> void
+{
+    if ( index < 65536U )
+    {
+        const auto shortIndex = static_cast<uint16_t>( index );
+        std::memcpy( out, &shortIndex, index < 256U ? 1U : 2U );
+        return;
+    }
+    for ( ; index >= 0x80U; index >>= 7U )
+    {
+        *out++ = static_cast<char>( ( index & 0x7FU ) | 0x80U );
+    }
+    *out = static_cast<char>( index );
+}
+
+// Only for records with one of the kDedupVarintFlags
+inline auto frequentValueIndex( const LinearProbeRecord * record ) -> uint32_t
+{
+    const auto * in = reinterpret_cast<const uint8_t *>( record->data + record->keySize );
+    switch ( record->dedupIndex & kDedupVarintFlags )
+    {
+        case kDedupFlag:
+            return in[0];
+        case kDedupExtendedFlag:
+        {
+            uint16_t index = 0;
+            std::memcpy( &index, in, sizeof( index ) );
+            return index;
+        }
+        default:
+        {
+            uint32_t index = 0;
+            for ( uint32_t shift = 0U;; shift += 7U )
+            {
+                index |= static_cast<uint32_t>( *in & 0x7FU ) << shift;
+                if ( ( *in++ & 0x80U ) == 0U )
+                {
+                    return index;
+                }
+            }
+        }
+    }
+}
 }
 
 template<uint32_t KeyWidth>
@@ -37,7 +217,9 @@ class LinearProbe
         mNumberOfKeySlots( numberOfKeySlots ),
         mKeyspaceSizeOffset( numberOfKeySlots * KeyWidth - 8 ),
         mHashcodeMask( 0UL ),
-        mOffsetMask( 0UL )
+        mOffsetMask( 0UL ),
+        mMaxDisplacement( ~0UL ),
+        mSlotMapping( SlotMapping::MODULO )
     {
         static_assert( KeyWidth == 8, "Only support 8-byte KeyWidth" );
 
@@ -102,13 +284,48 @@ class LinearProbe
         return keySlotToPtrOffset( mNumberOfKeySlots );
     }
 
+    [[nodiscard]] auto slotMapping() const -> SlotMapping
+    {
+        return mSlotMapping;
+    }
+
+    auto setSlotMapping( SlotMapping slotMapping ) -> void
+    {
+        if ( slotMapping == SlotMapping::POW2_MASK && ( mNumberOfKeySlots & ( mNumberOfKeySlots - 1 ) ) != 0UL )
+        {
+            throw std::runtime_error( "number of key slots " + std::to_string( mNumberOfKeySlots ) + " is not a power of two" );
+        }
+        mSlotMapping = slotMapping;
+    }
+
+    [[nodiscard]] auto homeSlotId( uint64_t hashcode ) const -> uint64_t
+    {
+        return homeSlot( mSlotMapping, hashcode, mNumberOfKeySlots );
+    }
+
     // Return the record offset or AXONCACHE_KEY_NOT_FOUND. Optionally return the
     // matched slot so callers can decode its value without loading it again.
     [[nodiscard]] auto findKeySlotOffset( std::string_view key, uint64_t hashcode, const uint8_t * keySpacePtr, uint64_t * foundSlot = nullptr ) const -> int64_t
+    {
+        // One predictable branch per lookup, then a probe loop specialized for the slot mapping
+        switch ( mSlotMapping )
+        {
+            case SlotMapping::FAST_RANGE:
+                return findKeySlotOffset<SlotMapping::FAST_RANGE>( key, hashcode, keySpacePtr, foundSlot );
+            case SlotMapping::POW2_MASK:
+                return findKeySlotOffset<SlotMapping::POW2_MASK>( key, hashcode, keySpacePtr, foundSlot );
+            case SlotMapping::MODULO:
+                break;
+        }
+        return findKeySlotOffset<SlotMapping::MODULO>( key, hashcode, keySpacePtr, foundSlot );
+    }
+
+    template<SlotMapping Mapping>
+    [[nodiscard]] auto findKeySlotOffset( std::string_view key, uint64_t hashcode, const uint8_t * keySpacePtr, uint64_t * foundSlot ) const -> int64_t
     {
         auto cmpHashcode = ( hashcode & mHashcodeMask );
-        auto slotId = ( hashcode % mNumberOfKeySlots );
-        while ( true )
+        auto slotId = homeSlot<Mapping>( hashcode, mNumberOfKeySlots );
+        for ( uint64_t displacement = 0;; ++displacement )
         {
             auto slot = *( reinterpret_cast<const uint64_t *>( keySpacePtr ) + slotId );
             auto slotOffset = ( slot & mOffsetMask );
@@ -130,6 +347,11 @@ class LinearProbe
                 }
             }
 
+            if ( displacement == mMaxDisplacement )
+            {
+                return Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND;
+            }
+
             // Avoid modulo (and its division) in the collision path; key-slot counts
             // are not guaranteed to be powers of two, so wrap explicitly.
             ++slotId;
@@ -144,7 +366,7 @@ class LinearProbe
     [[nodiscard]] auto findFreeKeySlotOffset( std::string_view key, uint64_t hashcode, const uint8_t * keySpacePtr, uint32_t & collisions ) -> int64_t
     {
         auto cmpHashcode = ( hashcode & mHashcodeMask );
-        auto slotId = ( hashcode % mNumberOfKeySlots );
+        auto slotId = homeSlotId( hashcode );
         collisions = 0;
         while ( true )
         {
@@ -176,6 +398,91 @@ class LinearProbe
         }
     }
 
+    // Batched lookups issue these ahead of findKeySlotOffset so the slot and record
+    // cache misses of several keys are in flight at the same time
+    auto prefetchKeySlot( uint64_t hashcode, const uint8_t * keySpacePtr ) const -> void
+    {
+        __builtin_prefetch( reinterpret_cast<const uint64_t *>( keySpacePtr ) + homeSlotId( hashcode ) );
+    }
+
+    // Only the home slot is considered; on a hashcode match its record is the likely hit
+    auto prefetchRecord( uint64_t hashcode, const uint8_t * keySpacePtr ) const -> void
+    {
+        const auto slot = *( reinterpret_cast<const uint64_t *>( keySpacePtr ) + homeSlotId( hashcode ) );
+        const auto slotOffset = ( slot & mOffsetMask );
+        if ( slotOffset != 0UL && ( slot & mHashcodeMask ) == ( hashcode & mHashcodeMask ) )
+        {
+            __builtin_prefetch( keySpacePtr + slotOffset + mKeyspaceSizeOffset );
+        }
+    }
+
+    // Called once the slot at keySlotOffset has been filled; linear probing keeps no per-slot metadata
+    auto commitKeySlot( [[maybe_unused]] int64_t keySlotOffset, [[maybe_unused]] uint64_t hashcode, [[maybe_unused]] uint8_t * keySpacePtr ) const -> void
+    {
+    }
+
+    // No key is further than maxDisplacement slots from its home slot, so lookups stop there
+    // instead of at the next empty slot. Only valid for a keySpace laid out by robinHoodLayout.
+    auto setMaxDisplacement( uint64_t maxDisplacement ) -> void
+    {
+        mMaxDisplacement = maxDisplacement;
+    }
+
+    // Sorts every cluster (run of filled slots) by home slot, the layout Robin Hood insertion
+    // ends up with. Without deletes, linear probing fills the same slots whatever the insertion
+    // order, so the keySpace stays valid for readers that simply scan to the next empty slot.
+    // hashKey gives the hash of a key as stored in its record. Return the longest displacement
+    // of any key from its home slot.
+    template<typename KeyHasher>
+    auto robinHoodLayout( uint8_t * keySpacePtr, KeyHasher && hashKey ) const -> uint32_t
+    {
+        auto * slots = reinterpret_cast<uint64_t *>( keySpacePtr );
+        uint64_t emptySlotId = 0;
+        while ( emptySlotId < mNumberOfKeySlots && ( slots[emptySlotId] & mOffsetMask ) != 0UL )
+        {
+            ++emptySlotId;
+        }
+        if ( emptySlotId == mNumberOfKeySlots )
+        {
+            throw std::runtime_error( "keySpace is full" );
+        }
+
+        // Count positions from the slot after an empty one so that no cluster wraps around
+        const auto start = emptySlotId + 1;
+        auto toSlotId = [&]( uint64_t position )
+        {
+            const auto slotId = start + position;
+            return slotId >= mNumberOfKeySlots ? slotId - mNumberOfKeySlots : slotId;
+        };
+
+        uint64_t maxDisplacement = 0;
+        std::vector<std::pair<uint64_t, uint64_t>> cluster; // { home position, slot }
+        for ( uint64_t position = 0; position < mNumberOfKeySlots; ++position )
+        {
+            const auto slot = slots[toSlotId( position )];
+            if ( ( slot & mOffsetMask ) != 0UL )
+            {
+                const auto * record = reinterpret_cast<const linear::LinearProbeRecord *>( keySpacePtr + ( slot & mOffsetMask ) + mKeyspaceSizeOffset );
+                const auto home = homeSlotId( hashKey( std::string_view{ record->data, record->keySize } ) );
+                cluster.emplace_back( home >= start ? home - start : home + mNumberOfKeySlots - start, slot );
+                continue;
+            }
+
+            // Every key of a cluster has its home inside the cluster, so sorted keys fill it back contiguously
+            std::stable_sort( cluster.begin(), cluster.end(), []( const auto & lhs, const auto & rhs )
+                              { return lhs.first < rhs.first; } );
+            auto target = position - cluster.size();
+            for ( const auto & [home, clusterSlot] : cluster )
+            {
+                slots[toSlotId( target )] = clusterSlot;
+                maxDisplacement = std::max( maxDisplacement, target - home );
+                ++target;
+            }
+            cluster.clear();
+        }
+        return static_cast<uint32_t>( maxDisplacement );
+    }
+
   private:
     uint16_t mLog2OfKeyWidth;
     uint16_t mHashcodeBits;
@@ -186,5 +493,8 @@ class LinearProbe
 
     uint64_t mHashcodeMask;
     uint64_t mOffsetMask;
+
+    uint64_t mMaxDisplacement;
+    SlotMapping mSlotMapping;
 };
 } // namespace axoncache
@@ -0,0 +1,270 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <string_view>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <vector>
+#include "axoncache/Constants.h"
+#include "axoncache/cache/CacheType.h"
+#include "axoncache/cache/probe/LinearProbe.h"
+
+namespace axoncache
+{
+namespace perfect
+{
+
+// PTHash-style minimal perfect hash: keys are split into buckets, and every bucket gets the
+// first 16-bit pilot that sends all of its keys to free positions of a table slightly larger
+// than the key count. The few positions past the key count are remapped to the free ones below.
+struct Function
+{
+    uint64_t seed;
+    std::vector<uint16_t> pilots; // one per bucket
+    std::vector<uint32_t> remap;  // one per table position past the number of keys
+};
+
+// Everything is derived from the number of keys, so a reader only needs numberOfKeySlots from the header
+struct Layout
+{
+    uint64_t numberOfKeys;
+    uint64_t numberOfBuckets;
+    uint64_t tableSize;
+    uint64_t pilotsOffset; // from the metadata start
+    uint64_t remapOffset;  // from the metadata start
+    uint64_t metadataSize; // padded to 8
+};
+
+[[nodiscard]] inline auto layoutFor( uint64_t numberOfKeys ) -> Layout
+{
+    // 5 * n / log2( n ) buckets and a 0.98 load factor, the usual PTHash trade-off: a few bits per key
+    const auto log2OfKeys = std::max<uint64_t>( 1U, 63U - static_cast<uint64_t>( __builtin_clzll( numberOfKeys | 1U ) ) );
+    const auto numberOfBuckets = std::max<uint64_t>( 1U, ( 5U * numberOfKeys + log2OfKeys - 1U ) / log2OfKeys );
+    const auto tableSize = numberOfKeys == 0U ? 0U : numberOfKeys + numberOfKeys / 50U + 1U;
+    const auto remapOffset = sizeof( uint64_t ) + ( ( numberOfBuckets * sizeof( uint16_t ) + 3U ) & ~3UL );
+    const auto metadataSize = ( remapOffset + ( tableSize - numberOfKeys ) * sizeof( uint32_t ) + 7U ) & ~7UL;
+    return { numberOfKeys, numberOfBuckets, tableSize, sizeof( uint64_t ), remapOffset, metadataSize };
+}
+
+// murmur3 finalizer, a bijection on 64 bits
+[[nodiscard]] inline auto mix( uint64_t value ) -> uint64_t
+{
+    value ^= value >> 33U;
+    value *= 0xFF51AFD7ED558CCDULL;
+    value ^= value >> 33U;
+    value *= 0xC4CEB9FE1A85EC53ULL;
+    value ^= value >> 33U;
+    return value;
+}
+
+[[nodiscard]] inline auto reduce( uint64_t value, uint64_t range ) -> uint64_t
+{
+    return static_cast<uint64_t>( ( static_cast<unsigned __int128>( value ) * range ) >> 64U );
+}
+
+[[nodiscard]] inline auto bucketOf( uint64_t hashcode, uint64_t seed, uint64_t numberOfBuckets ) -> uint64_t
+{
+    return reduce( mix( hashcode ^ seed ), numberOfBuckets );
+}
+
+// Distinct hashcodes stay distinct through the xor and the mix, so only the range reduction can collide
+[[nodiscard]] inline auto positionOf( uint64_t hashcode, uint64_t seed, uint16_t pilot, uint64_t tableSize ) -> uint64_t
+{
+    return reduce( mix( hashcode ^ mix( seed + pilot + 1U ) ), tableSize );
+}
+
+// Throws if two hashcodes are equal, no pilot can separate them
+[[nodiscard]] auto build( std::span<const uint64_t> hashcodes ) -> Function;
+}
+
+// Lookups in a finalized keySpace read exactly one slot: the minimal perfect hash of the
+// hashcode gives the slot, which is then verified like a linear probe slot (hashcode bits,
+// then the record key). Slots use the linear probe encoding, so LinearProbeValue reads them.
+//
+// While the cache is built the probe is a plain linear probe over the requested slots.
+// PerfectHashCache::finalize then builds the function, writes one slot per key and loads it.
+//
+// KeySpace layout: [ numberOfKeys * 8 slots ][ seed ][ pilots, padded to 4 ][ remap, padded to 8 ]
+template<uint32_t KeyWidth>
+class PerfectHashProbe
+{
+  public:
+    PerfectHashProbe( uint16_t offsetBits, uint64_t numberOfKeySlots ) :
+        mLinearProbe( offsetBits, numberOfKeySlots ),
+        mLayout( perfect::layoutFor( numberOfKeySlots ) ),
+        mKeyspaceSizeOffset( numberOfKeySlots * KeyWidth - 8 ),
+        mSeed( 0UL ),
+        mIsPerfect( false )
+    {
+    }
+
+    [[nodiscard]] auto log2OfKeyWidth() const -> uint16_t
+    {
+        return mLinearProbe.log2OfKeyWidth();
+    }
+
+    [[nodiscard]] auto cacheType() const -> axoncache::CacheType
+    {
+        return CacheType::PERFECT_HASH;
+    }
+
+    [[nodiscard]] auto hashcodeBits() const -> uint16_t
+    {
+        return mLinearProbe.hashcodeBits();
+    }
+
+    [[nodiscard]] auto offsetBits() const -> uint16_t
+    {
+        return mLinearProbe.offsetBits();
+    }
+
+    [[nodiscard]] auto numberOfKeySlots() const -> uint64_t
+    {
+        return mLinearProbe.numberOfKeySlots();
+    }
+
+    [[nodiscard]] auto keyspaceSize() const -> uint64_t
+    {
+        return mLinearProbe.keyspaceSize() + ( mIsPerfect ? mLayout.metadataSize : 0UL );
+    }
+
+    [[nodiscard]] auto hashcodeMask() const -> uint64_t
+    {
+        return mLinearProbe.hashcodeMask();
+    }
+
+    [[nodiscard]] auto offsetMask() const -> uint64_t
+    {
+        return mLinearProbe.offsetMask();
+    }
+
+    [[nodiscard]] auto keySlotToPtrOffset( uint64_t keySlot ) const -> uint64_t
+    {
+        return mLinearProbe.keySlotToPtrOffset( keySlot );
+    }
+
+    [[nodiscard]] auto calculateKeySpaceSize() const -> uint64_t
+    {
+        return keyspaceSize();
+    }
+
+    [[nodiscard]] auto isPerfect() const -> bool
+    {
+        return mIsPerfect;
+    }
+
+    // Size of the perfect hash metadata that follows the slots once finalized
+    [[nodiscard]] auto metadataSize() const -> uint64_t
+    {
+        return mLayout.metadataSize;
+    }
+
+    [[nodiscard]] auto perfectSlotId( uint64_t hashcode, const uint8_t * keySpacePtr ) const -> uint64_t
+    {
+        const auto * metadata = keySpacePtr + mLinearProbe.keyspaceSize();
+        const auto pilot = reinterpret_cast<const uint16_t *>( metadata + mLayout.pilotsOffset )[perfect::bucketOf( hashcode, mSeed, mLayout.numberOfBuckets )];
+        const auto position = perfect::positionOf( hashcode, mSeed, pilot, mLayout.tableSize );
+        return position < mLayout.numberOfKeys ? position : reinterpret_cast<const uint32_t *>( metadata + mLayout.remapOffset )[position - mLayout.numberOfKeys];
+    }
+
+    [[nodiscard]] auto findKeySlotOffset( std::string_view key, uint64_t hashcode, const uint8_t * keySpacePtr, uint64_t * foundSlot = nullptr ) const -> int64_t
+    {
+        if ( !mIsPerfect )
+        {
+            return mLinearProbe.findKeySlotOffset( key, hashcode, keySpacePtr, foundSlot );
+        }
+        if ( mLayout.numberOfKeys == 0U )
+        {
+            return Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND;
+        }
+
+        // Every key has a slot, so a missing key lands on another key's slot and fails verification
+        const auto slotId = perfectSlotId( hashcode, keySpacePtr );
+        const auto slot = *( reinterpret_cast<const uint64_t *>( keySpacePtr ) + slotId );
+        if ( ( slot & hashcodeMask() ) == ( hashcode & hashcodeMask() ) )
+        {
+            const auto * record = reinterpret_cast<const linear::LinearProbeRecord *>( keySpacePtr + ( slot & offsetMask() ) + mKeyspaceSizeOffset );
+            if ( record->keySize == key.size() && std::memcmp( ( const void * )record->data, key.data(), key.size() ) == 0 )
+            {
+                if ( foundSlot != nullptr )
+                {
+                    *foundSlot = slot;
+                }
+                return keySlotToPtrOffset( slotId );
+            }
+        }
+        return Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND;
+    }
+
+    [[nodiscard]] auto findFreeKeySlotOffset( std::string_view key, uint64_t hashcode, const uint8_t * keySpacePtr, uint32_t & collisions ) -> int64_t
+    {
+        if ( mIsPerfect )
+        {
+            throw std::runtime_error( "PERFECT_HASH keySpace can't be changed once finalized" );
+        }
+        return mLinearProbe.findFreeKeySlotOffset( key, hashcode, keySpacePtr, collisions );
+    }
+
+    // The pilot load comes before the slot load, so the two prefetch stages cover the pilot and the slot
+    auto prefetchKeySlot( uint64_t hashcode, const uint8_t * keySpacePtr ) const -> void
+    {
+        if ( !mIsPerfect )
+        {
+            mLinearProbe.prefetchKeySlot( hashcode, keySpacePtr );
+            return;
+        }
+        const auto * pilots = reinterpret_cast<const uint16_t *>( keySpacePtr + mLinearProbe.keyspaceSize() + mLayout.pilotsOffset );
+        __builtin_prefetch( pilots + perfect::bucketOf( hashcode, mSeed, mLayout.numberOfBuckets ) );
+    }
+
+    auto prefetchRecord( uint64_t hashcode, const uint8_t * keySpacePtr ) const -> void
+    {
+        if ( !mIsPerfect )
+        {
+            mLinearProbe.prefetchRecord( hashcode, keySpacePtr );
+            return;
+        }
+        if ( mLayout.numberOfKeys != 0U )
+        {
+            __builtin_prefetch( reinterpret_cast<const uint64_t *>( keySpacePtr ) + perfectSlotId( hashcode, keySpacePtr ) );
+        }
+    }
+
+    auto commitKeySlot( int64_t keySlotOffset, uint64_t hashcode, uint8_t * keySpacePtr ) const -> void
+    {
+        mLinearProbe.commitKeySlot( keySlotOffset, hashcode, keySpacePtr );
+    }
+
+    // Copy the function after the slots of a probe sized with one slot per key and switch to perfect lookups
+    auto writeFunction( const perfect::Function & function, uint8_t * keySpacePtr ) -> void
+    {
+        if ( function.pilots.size() != mLayout.numberOfBuckets || function.remap.size() != mLayout.tableSize - mLayout.numberOfKeys )
+        {
+            throw std::runtime_error( "perfect hash function does not match " + std::to_string( mLayout.numberOfKeys ) + " keys" );
+        }
+        auto * metadata = keySpacePtr + mLinearProbe.keyspaceSize();
+        std::memcpy( metadata, &function.seed, sizeof( uint64_t ) );
+        std::memcpy( metadata + mLayout.pilotsOffset, function.pilots.data(), function.pilots.size() * sizeof( uint16_t ) );
+        std::memcpy( metadata + mLayout.remapOffset, function.remap.data(), function.remap.size() * sizeof( uint32_t ) );
+        loadFunction( keySpacePtr );
+    }
+
+    auto loadFunction( const uint8_t * keySpacePtr ) -> void
+    {
+        std::memcpy( &mSeed, keySpacePtr + mLinearProbe.keyspaceSize(), sizeof( uint64_t ) );
+        mIsPerfect = true;
+    }
+
+  private:
+    LinearProbe<KeyWidth> mLinearProbe;
+    perfect::Layout mLayout;
+    uint64_t mKeyspaceSizeOffset;
+    uint64_t mSeed;
+    bool mIsPerfect;
+};
+} // namespace axoncache
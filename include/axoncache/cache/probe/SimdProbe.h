@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <string_view>
+#include <cstdint>
+#include "axoncache/cache/CacheType.h"
+#include "axoncache/cache/probe/LinearProbe.h"
+#include "axoncache/cache/probe/SlotMapping.h"
+
+namespace axoncache
+{
+namespace simd
+{
+
+// Extra tag bytes mirrored past the end of the tag array, so a group load that starts
+// near the last slot can read the wrapped-around tags without a bounds check.
+[[maybe_unused]] constexpr uint64_t kMaxGroupWidth = 32;
+
+// A slot tag is 0 for an empty slot, otherwise the top 7 bits of the hash with the high bit set.
+[[maybe_unused]] constexpr uint8_t kEmptyTag = 0;
+
+[[nodiscard]] inline auto tagOf( uint64_t hashcode ) -> uint8_t
+{
+    return static_cast<uint8_t>( 0x80U | ( hashcode >> 57U ) );
+}
+
+struct ProbeLayout
+{
+    uint64_t numberOfKeySlots;
+    uint64_t tagsOffset;         // from keySpacePtr
+    uint64_t keyspaceSizeOffset; // same record base as LinearProbe
+    uint64_t hashcodeMask;
+    uint64_t offsetMask;
+    uint64_t maxDisplacement; // lookups give up past this many slots from home
+};
+
+using FindKeySlotFunc = auto ( * )( const ProbeLayout & layout, std::string_view key, uint64_t hashcode, const uint8_t * keySpacePtr, uint64_t * foundSlot ) -> int64_t;
+
+// Picked once per process from the best instruction set the CPU supports (AVX2, SSE2, NEON or scalar)
+[[nodiscard]] auto findKeySlotFunc( SlotMapping slotMapping ) -> FindKeySlotFunc;
+[[nodiscard]] auto isaName() -> std::string_view;
+}
+
+// Linear probing over the regular 8-byte slot array, plus a dense array of 1-byte tags
+// (one per slot) that lookups scan a whole group at a time with SIMD compares. Only slots
+// whose tag matches are loaded and compared, so a probe sequence touches one cache line
+// of tags instead of one slot per step.
+//
+// KeySpace layout: [ numberOfKeySlots * 8 slots ][ numberOfKeySlots + kMaxGroupWidth tags, padded to 8 ]
+template<uint32_t KeyWidth>
+class SimdProbe
+{
+  public:
+    SimdProbe( uint16_t offsetBits, uint64_t numberOfKeySlots ) :
+        mLinearProbe( offsetBits, numberOfKeySlots ),
+        mTagsSize( ( numberOfKeySlots + simd::kMaxGroupWidth + 7U ) & ~7UL ),
+        mLayout{ numberOfKeySlots, numberOfKeySlots * KeyWidth, numberOfKeySlots * KeyWidth - 8, mLinearProbe.hashcodeMask(), mLinearProbe.offsetMask(), ~0UL },
+        mFindKeySlot( simd::findKeySlotFunc( SlotMapping::MODULO ) )
+    {
+    }
+
+    [[nodiscard]] auto log2OfKeyWidth() const -> uint16_t
+    {
+        return mLinearProbe.log2OfKeyWidth();
+    }
+
+    [[nodiscard]] auto cacheType() const -> axoncache::CacheType
+    {
+        return CacheType::LINEAR_PROBE_SIMD;
+    }
+
+    [[nodiscard]] auto hashcodeBits() const -> uint16_t
+    {
+        return mLinearProbe.hashcodeBits();
+    }
+
+    [[nodiscard]] auto offsetBits() const -> uint16_t
+    {
+        return mLinearProbe.offsetBits();
+    }
+
+    [[nodiscard]] auto numberOfKeySlots() const -> uint64_t
+    {
+        return mLinearProbe.numberOfKeySlots();
+    }
+
+    [[nodiscard]] auto keyspaceSize() const -> uint64_t
+    {
+        return mLinearProbe.keyspaceSize() + mTagsSize;
+    }
+
+    [[nodiscard]] auto hashcodeMask() const -> uint64_t
+    {
+        return mLinearProbe.hashcodeMask();
+    }
+
+    [[nodiscard]] auto offsetMask() const -> uint64_t
+    {
+        return mLinearProbe.offsetMask();
+    }
+
+    [[nodiscard]] auto keySlotToPtrOffset( uint64_t keySlot ) const -> uint64_t
+    {
+        return mLinearProbe.keySlotToPtrOffset( keySlot );
+    }
+
+    [[nodiscard]] auto calculateKeySpaceSize() const -> uint64_t
+    {
+        return keyspaceSize();
+    }
+
+    [[nodiscard]] auto findKeySlotOffset( std::string_view key, uint64_t hashcode, const uint8_t * keySpacePtr, uint64_t * foundSlot = nullptr ) const -> int64_t
+    {
+        return mFindKeySlot( mLayout, key, hashcode, keySpacePtr, foundSlot );
+    }
+
+    // Writes go through the scalar linear probe; the tag is set by commitKeySlot once the slot is filled
+    [[nodiscard]] auto findFreeKeySlotOffset( std::string_view key, uint64_t hashcode, const uint8_t * keySpacePtr, uint32_t & collisions ) -> int64_t
+    {
+        return mLinearProbe.findFreeKeySlotOffset( key, hashcode, keySpacePtr, collisions );
+    }
+
+    auto prefetchKeySlot( uint64_t hashcode, const uint8_t * keySpacePtr ) const -> void
+    {
+        __builtin_prefetch( keySpacePtr + mLayout.tagsOffset + mLinearProbe.homeSlotId( hashcode ) );
+        mLinearProbe.prefetchKeySlot( hashcode, keySpacePtr );
+    }
+
+    auto prefetchRecord( uint64_t hashcode, const uint8_t * keySpacePtr ) const -> void
+    {
+        mLinearProbe.prefetchRecord( hashcode, keySpacePtr );
+    }
+
+    auto commitKeySlot( int64_t keySlotOffset, uint64_t hashcode, uint8_t * keySpacePtr ) const -> void
+    {
+        setTag( static_cast<uint64_t>( keySlotOffset ) >> log2OfKeyWidth(), simd::tagOf( hashcode ), keySpacePtr );
+    }
+
+    [[nodiscard]] auto slotMapping() const -> SlotMapping
+    {
+        return mLinearProbe.slotMapping();
+    }
+
+    auto setSlotMapping( SlotMapping slotMapping ) -> void
+    {
+        mLinearProbe.setSlotMapping( slotMapping );
+        mFindKeySlot = simd::findKeySlotFunc( slotMapping );
+    }
+
+    auto setMaxDisplacement( uint64_t maxDisplacement ) -> void
+    {
+        mLinearProbe.setMaxDisplacement( maxDisplacement );
+        mLayout.maxDisplacement = maxDisplacement;
+    }
+
+    // Reorders the slots like LinearProbe, then rebuilds every tag from the slot it now describes
+    template<typename KeyHasher>
+    auto robinHoodLayout( uint8_t * keySpacePtr, KeyHasher && hashKey ) const -> uint32_t
+    {
+        const auto maxDisplacement = mLinearProbe.robinHoodLayout( keySpacePtr, hashKey );
+        const auto * slots = reinterpret_cast<const uint64_t *>( keySpacePtr );
+        for ( uint64_t slotId = 0; slotId < mLayout.numberOfKeySlots; ++slotId )
+        {
+            // A slot keeps the top hashcode bits, which are all a tag is made of
+            const auto slot = slots[slotId];
+            setTag( slotId, ( slot & mLayout.offsetMask ) == 0UL ? simd::kEmptyTag : simd::tagOf( slot ), keySpacePtr );
+        }
+        return maxDisplacement;
+    }
+
+  private:
+    auto setTag( uint64_t slotId, uint8_t tag, uint8_t * keySpacePtr ) const -> void
+    {
+        auto * tags = keySpacePtr + mLayout.tagsOffset;
+        tags[slotId] = tag;
+
+        // Keep the mirrored tail in sync; with fewer slots than a group, a slot is mirrored more than once
+        for ( auto mirrorId = slotId + mLayout.numberOfKeySlots; mirrorId < mLayout.numberOfKeySlots + simd::kMaxGroupWidth; mirrorId += mLayout.numberOfKeySlots )
+        {
+            tags[mirrorId] = tag;
+        }
+    }
+
+    LinearProbe<KeyWidth> mLinearProbe;
+    uint64_t mTagsSize;
+    simd::ProbeLayout mLayout;
+    simd::FindKeySlotFunc mFindKeySlot;
+};
+} // namespace axoncache
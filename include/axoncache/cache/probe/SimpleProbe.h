@@ -95,6 +95,20 @@ class SimpleProbe
         return findKeySlotOffset( key, hashcode, keySpacePtr );
     }
 
+    auto prefetchKeySlot( uint64_t hashcode, const uint8_t * keySpacePtr ) const -> void
+    {
+        __builtin_prefetch( keySpacePtr + findKeySlotOffset( {}, hashcode, keySpacePtr ) );
+    }
+
+    // Chained records are reached through the bucket list, nothing to prefetch ahead of the walk
+    auto prefetchRecord( [[maybe_unused]] uint64_t hashcode, [[maybe_unused]] const uint8_t * keySpacePtr ) const -> void
+    {
+    }
+
+    auto commitKeySlot( [[maybe_unused]] int64_t keySlotOffset, [[maybe_unused]] uint64_t hashcode, [[maybe_unused]] uint8_t * keySpacePtr ) const -> void
+    {
+    }
+
   private:
     uint16_t mLog2OfKeyWidth;
 
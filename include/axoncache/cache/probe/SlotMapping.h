@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include "axoncache/Constants.h"
+
+namespace axoncache
+{
+
+// How a hashcode picks its home slot. Chosen by the writer and recorded in CacheHeader::flags.
+enum class SlotMapping
+{
+    MODULO = 0,     // hashcode % numberOfKeySlots, a 64-bit division
+    FAST_RANGE = 1, // multiply-shift range reduction
+    POW2_MASK = 2,  // numberOfKeySlots rounded up to a power of two, hashcode & ( numberOfKeySlots - 1 )
+};
+
+template<SlotMapping Mapping>
+[[nodiscard]] inline auto homeSlot( uint64_t hashcode, uint64_t numberOfKeySlots ) -> uint64_t;
+
+template<>
+[[nodiscard]] inline auto homeSlot<SlotMapping::MODULO>( uint64_t hashcode, uint64_t numberOfKeySlots ) -> uint64_t
+{
+    return hashcode % numberOfKeySlots;
+}
+
+// Lemire's reduction takes the high bits of the product, i.e. the top bits of the hashcode. Linear
+// probe slots keep those bits for their hashcode compare (and SimdProbe for its tag), so the
+// hashcode is first remixed by an odd multiplier, a bijection that spreads every bit upwards.
+template<>
+[[nodiscard]] inline auto homeSlot<SlotMapping::FAST_RANGE>( uint64_t hashcode, uint64_t numberOfKeySlots ) -> uint64_t
+{
+    const auto mixed = hashcode * 0x9E3779B97F4A7C15ULL;
+    return static_cast<uint64_t>( ( static_cast<unsigned __int128>( mixed ) * numberOfKeySlots ) >> 64U );
+}
+
+template<>
+[[nodiscard]] inline auto homeSlot<SlotMapping::POW2_MASK>( uint64_t hashcode, uint64_t numberOfKeySlots ) -> uint64_t
+{
+    return hashcode & ( numberOfKeySlots - 1U );
+}
+
+[[nodiscard]] inline auto homeSlot( SlotMapping mapping, uint64_t hashcode, uint64_t numberOfKeySlots ) -> uint64_t
+{
+    switch ( mapping )
+    {
+        case SlotMapping::FAST_RANGE:
+            return homeSlot<SlotMapping::FAST_RANGE>( hashcode, numberOfKeySlots );
+        case SlotMapping::POW2_MASK:
+            return homeSlot<SlotMapping::POW2_MASK>( hashcode, numberOfKeySlots );
+        case SlotMapping::MODULO:
+            break;
+    }
+    return homeSlot<SlotMapping::MODULO>( hashcode, numberOfKeySlots );
+}
+
+[[nodiscard]] inline auto toSlotMapping( uint32_t headerFlags ) -> SlotMapping
+{
+    const auto isFastRange = ( headerFlags & Constants::HeaderFlag::kSlotMappingFastRange ) != 0U;
+    const auto isPow2Mask = ( headerFlags & Constants::HeaderFlag::kSlotMappingPow2Mask ) != 0U;
+    if ( isFastRange && isPow2Mask )
+    {
+        throw std::runtime_error( "Only one slot mapping can be set in header flags " + std::to_string( headerFlags ) );
+    }
+    return isFastRange ? SlotMapping::FAST_RANGE : ( isPow2Mask ? SlotMapping::POW2_MASK : SlotMapping::MODULO );
+}
+
+// Setting values: "modulo", "fastrange" or "pow2"
+[[nodiscard]] inline auto slotMappingHeaderFlag( std::string_view name ) -> uint32_t
+{
+    if ( name.empty() || name == "modulo" )
+    {
+        return 0U;
+    }
+    if ( name == "fastrange" )
+    {
+        return Constants::HeaderFlag::kSlotMappingFastRange;
+    }
+    if ( name == "pow2" )
+    {
+        return Constants::HeaderFlag::kSlotMappingPow2Mask;
+    }
+    throw std::runtime_error( "Unknown slot mapping " + std::string{ name } + ", expected one of modulo, fastrange, pow2" );
+}
+
+}
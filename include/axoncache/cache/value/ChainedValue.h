@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <string>
 #include <string_view>
 #include <utility>
 #include <stdint.h>
@@ -26,11 +27,12 @@ class ChainedValue
     auto add( int64_t keySpaceOffset, std::string_view key, [[maybe_unused]] uint64_t hashcode, uint8_t type, std::string_view value, MemoryHandler * memory ) -> uint32_t;
 
     // return empty string if not found
-    auto get( const uint8_t * dataSpace, int64_t keySpaceOffset, std::string_view key, uint8_t type, bool * isExist ) const -> std::string_view;
+    // Values are never compressed, buffer is unused
+    auto get( const uint8_t * dataSpace, int64_t keySpaceOffset, std::string_view key, uint8_t type, bool * isExist, [[maybe_unused]] std::string * buffer = nullptr ) const -> std::string_view;
 
     auto get( const uint8_t * dataSpace, int64_t keySpaceOffset, std::string_view key, uint8_t type, [[maybe_unused]] const std::vector<std::string_view> & frequentValues ) const -> std::string_view;
 
-    auto getWithType( const uint8_t * dataSpace, int64_t keySpaceOffset, [[maybe_unused]] const std::vector<std::string_view> & frequentValues ) const -> std::pair<std::string_view, CacheValueType>;
+    auto getWithType( const uint8_t * dataSpace, int64_t keySpaceOffset, [[maybe_unused]] const std::vector<std::string_view> & frequentValues, [[maybe_unused]] std::string * buffer = nullptr ) const -> std::pair<std::string_view, CacheValueType>;
 
     auto contains( const uint8_t * dataSpace, int64_t keySpaceOffset, std::string_view key ) const -> bool;
 
@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace axoncache
+{
+// Heavy hitters of a stream of values, weighted by their size since the bytes a frequent value
+// saves grow with it. A Space-Saving sketch: it tracks at most 2 * capacity values, and when full
+// keeps the capacity heaviest. A value seen again after it was dropped starts from the heaviest
+// weight dropped so far, so a weight never underestimates and overestimates by at most that much.
+// Memory stays bounded by the capacity whatever the number of distinct values.
+class FrequentValueSketch
+{
+  public:
+    // Values shorter than this can't save more than the index that would replace them
+    static constexpr size_t kMinValueSize = 4U;
+
+    explicit FrequentValueSketch( size_t capacity ) :
+        mCapacity( capacity )
+    {
+        mWeights.reserve( 2U * capacity );
+    }
+
+    auto add( std::string_view value ) -> void;
+
+    // At most capacity values, heaviest first
+    [[nodiscard]] auto candidates() const -> std::vector<std::string>;
+
+  private:
+    auto evict() -> void;
+
+    size_t mCapacity;
+    uint64_t mDroppedWeight{ 0U };
+    std::unordered_map<std::string, uint64_t> mWeights;
+};
+}
@@ -3,12 +3,15 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <cstdint>
 #include <vector>
 #include "axoncache/cache/probe/LinearProbe.h"
+#include "axoncache/cache/value/ValueDictionary.h"
 #include "axoncache/domain/CacheValue.h"
 namespace axoncache
 {
@@ -31,51 +34,137 @@ class LinearProbeValue
     // return the collisions in DataSpace
     // For linear probe, collisions happen in KeySpace, so this function always returns 0
     auto add( int64_t keySpaceOffset, std::string_view key, uint64_t hashcode, uint8_t type, std::string_view value, MemoryHandler * memory ) -> uint32_t;
-    auto add( int64_t keySpaceOffset, std::string_view key, uint64_t hashcode, uint8_t type, uint32_t valueSize, uint16_t index, MemoryHandler * memory ) -> uint32_t;
+    auto add( int64_t keySpaceOffset, std::string_view key, uint64_t hashcode, uint8_t type, uint32_t valueSize, uint32_t index, MemoryHandler * memory ) -> uint32_t;
 
-    // return empty string if not found
-    auto get( const uint8_t * dataSpace, int64_t keySpaceOffset, std::string_view key, uint8_t type, bool * isExist ) const -> std::string_view;
+    // return empty string if not found. A compressed value is decompressed into buffer, without
+    // one into a buffer of the calling thread.
+    auto get( const uint8_t * dataSpace, int64_t keySpaceOffset, std::string_view key, uint8_t type, bool * isExist, std::string * buffer = nullptr ) const -> std::string_view;
 
     auto get( const uint8_t * dataSpace, int64_t keySpaceOffset, std::string_view key, uint8_t type, [[maybe_unused]] const std::vector<std::string_view> & frequentValues ) const -> std::string_view;
 
     // This follows every successful dedup string probe. Keep it inline and
     // consume the slot the probe already loaded to avoid another call and load.
-    auto getFromSlot( const uint8_t * dataSpace, uint64_t slot, uint8_t type, const std::vector<std::string_view> & frequentValues ) const -> std::string_view
+    auto getFromSlot( const uint8_t * dataSpace, uint64_t slot, uint8_t type, const std::vector<std::string_view> & frequentValues, std::string * buffer = nullptr ) const -> std::string_view
     {
         const uint64_t slotOffset = ( slot & mOffsetMask ) + mKeyspaceSizeOffset;
         const auto * record = reinterpret_cast<const linear::LinearProbeRecord *>( dataSpace + slotOffset );
         const auto * dataPtr = reinterpret_cast<const char *>( dataSpace + slotOffset + sizeof( linear::LinearProbeRecord ) );
 
-        if ( static_cast<uint8_t>( record->type ) != type )
+        if ( linear::valueType( record ) != type )
         {
             return typeMismatch( record, type );
         }
-        if ( ( record->dedupIndex & linear::kDedupFlag ) && !frequentValues.empty() )
+        if ( record->dedupIndex & linear::kCompressedFlag )
         {
-            return frequentValues[*( reinterpret_cast<const uint8_t *>( dataPtr + record->keySize ) )];
+            return linear::isSharedValue( record ) ? linear::sharedValue( record ) : decompress( record, buffer );
         }
-        if ( ( record->dedupIndex & linear::kDedupExtendedFlag ) && !frequentValues.empty() )
+        if ( ( record->dedupIndex & linear::kDedupVarintFlags ) && !frequentValues.empty() )
         {
-            return frequentValues[*( reinterpret_cast<const uint16_t *>( dataPtr + record->keySize ) )];
+            return frequentValues[linear::frequentValueIndex( record )];
         }
         return { dataPtr + record->keySize, record->valSize };
     }
 
-    auto getWithType( const uint8_t * dataSpace, int64_t keySpaceOffset, [[maybe_unused]] const std::vector<std::string_view> & frequentValues ) const -> std::pair<std::string_view, CacheValueType>;
+    auto getWithType( const uint8_t * dataSpace, int64_t keySpaceOffset, [[maybe_unused]] const std::vector<std::string_view> & frequentValues, std::string * buffer = nullptr ) const -> std::pair<std::string_view, CacheValueType>;
     // Typed lookups also reuse the probe's slot, but remain out of line because
     // they are outside the common string-only hot path.
-    auto getWithTypeFromSlot( const uint8_t * dataSpace, uint64_t slot, const std::vector<std::string_view> & frequentValues ) const -> std::pair<std::string_view, CacheValueType>;
+    auto getWithTypeFromSlot( const uint8_t * dataSpace, uint64_t slot, const std::vector<std::string_view> & frequentValues, std::string * buffer = nullptr ) const -> std::pair<std::string_view, CacheValueType>;
 
     auto contains( const uint8_t * dataSpace, int64_t keySpaceOffset, std::string_view key ) const -> bool;
 
+    // Open size zeroed bytes between a keySpace of keyspaceSize bytes and the records. The records
+    // move up and every slot offset grows by size, so readers unaware of the gap still find them.
+    auto reserveAfterKeySpace( uint64_t numberOfKeySlots, uint64_t keyspaceSize, uint64_t size, MemoryHandler * memory ) const -> void;
+
+    // Train mDictionary on a sample of the string values that follow a keySpace of keyspaceSize
+    // bytes, then compress each of them that gets smaller. The records keep their order and the
+    // data space shrinks.
+    auto compressValues( uint64_t numberOfKeySlots, uint64_t keyspaceSize, MemoryHandler * memory ) -> void;
+
+    // Replace the value of every record that holds one of indexes by its index into the frequent
+    // values, for the records that follow a keySpace of keyspaceSize bytes. The records keep their
+    // order and the data space shrinks.
+    auto dedupValues( uint64_t numberOfKeySlots, uint64_t keyspaceSize, const std::unordered_map<std::string_view, uint32_t> & indexes, MemoryHandler * memory ) const -> void;
+
+    // Values held by the records that follow a keySpace of numberOfKeySlots slots, in record order.
+    // Deduplicated and compressed records are skipped.
+    auto forEachPlainValue( uint64_t numberOfKeySlots, const MemoryHandler * memory, const std::function<void( std::string_view )> & visitor ) const -> void;
+
+    // While enabled, a value already added with another key is not written again, the record
+    // points to the first copy instead. Disabling frees the index of the values added.
+    auto shareValues( bool isEnabled ) -> void
+    {
+        mIsSharingValues = isEnabled;
+        mSharedValues = {};
+    }
+
+    // Records added or moved from then on are padded so that their value is aligned, see
+    // linear::recordPadding. 0 packs them.
+    auto alignValues( uint64_t alignment ) -> void
+    {
+        mValueAlignment = alignment;
+    }
+
+    [[nodiscard]] auto dictionary() const -> const ValueDictionary &
+    {
+        return mDictionary;
+    }
+
+    [[nodiscard]] auto dictionary() -> ValueDictionary &
+    {
+        return mDictionary;
+    }
+
+    template<typename Visitor>
+    auto forEachKey( const uint8_t * keySpacePtr, uint64_t numberOfKeySlots, Visitor && visitor ) const -> void
+    {
+        const auto * slots = reinterpret_cast<const uint64_t *>( keySpacePtr );
+        for ( uint64_t slotId = 0; slotId < numberOfKeySlots; ++slotId )
+        {
+            if ( ( slots[slotId] & mOffsetMask ) != 0UL )
+            {
+                const auto * record = reinterpret_cast<const linear::LinearProbeRecord *>( keySpacePtr + ( slots[slotId] & mOffsetMask ) + mKeyspaceSizeOffset );
+                visitor( std::string_view{ record->data, record->keySize } );
+            }
+        }
+    }
+
+    [[nodiscard]] static auto recordSize( const linear::LinearProbeRecord * record ) -> uint64_t;
+
   protected:
     auto typeMismatch( const linear::LinearProbeRecord * record, uint8_t expectedType ) const -> std::string_view;
 
+    // Value of a kCompressedFlag record, decompressed into buffer. Views of the cache can't hold it,
+    // so without a buffer it goes to one of the calling thread, valid until its next such lookup.
+    auto decompress( const linear::LinearProbeRecord * record, std::string * buffer ) const -> std::string_view;
+
+    // Point every slot at the new offset of its record, newOffsets pairs old and new offsets in
+    // increasing order
+    auto remapSlots( uint64_t numberOfKeySlots, const std::vector<std::pair<uint64_t, uint64_t>> & newOffsets, MemoryHandler * memory ) const -> void;
+
+    // While records move, a kSharedValueFlags record holds the old offset of the record with its
+    // value. This turns it back into a distance once the new offsets are known.
+    auto fixSharedValues( std::vector<uint8_t> & records, uint64_t keyspaceSize, const std::vector<std::pair<uint64_t, uint64_t>> & newOffsets ) const -> void;
+
+    // Offsets of the records pointed to by the numberOfKeySlots slots, in increasing order. Unlike a
+    // walk from record to record, this skips the padding of aligned values.
+    auto recordOffsets( uint64_t numberOfKeySlots, const MemoryHandler * memory ) const -> std::vector<uint64_t>;
+
+    // Padding of a record written at offset of the data space
+    [[nodiscard]] auto recordPadding( uint64_t offset, const linear::LinearProbeRecord & record ) const -> uint64_t;
+
+    // Pads records, which start at offset keyspaceSize of the data space, for record to go next
+    auto appendPadding( std::vector<uint8_t> & records, uint64_t keyspaceSize, const linear::LinearProbeRecord & record ) const -> void;
+
+    // Offset of a record already holding value, or 0
+    auto findSharedValue( std::string_view value, uint64_t valueHash, const MemoryHandler * memory ) const -> uint64_t;
+
     auto addToEnd( std::string_view key, uint8_t type, std::string_view value, MemoryHandler * memory ) -> uint64_t;
-    auto addToEnd( std::string_view key, uint8_t type, uint32_t valueSize, uint16_t index, MemoryHandler * memory ) -> uint64_t;
+    auto addToEnd( std::string_view key, uint8_t type, uint32_t valueSize, uint32_t index, MemoryHandler * memory ) -> uint64_t;
+    auto addSharedToEnd( std::string_view key, uint8_t type, uint32_t valueSize, uint64_t ownerOffset, MemoryHandler * memory ) -> uint64_t;
 
     auto calculateSize( std::string_view key, std::string_view value ) -> uint64_t;
-    auto calculateSize( std::string_view key, uint16_t index ) -> uint64_t;
+    auto calculateSize( std::string_view key, uint32_t index ) -> uint64_t;
 
     uint64_t mKeyspaceSizeOffset;
 
@@ -84,5 +173,14 @@ class LinearProbeValue
     uint64_t mOffsetMask;
 
     std::string mOffsetBitsStr;
+
+    ValueDictionary mDictionary;
+
+    bool mIsSharingValues{ false };
+
+    uint64_t mValueAlignment{ 0U };
+
+    // Offsets of the records holding the values added, by value hash, while sharing values
+    std::unordered_map<uint64_t, uint64_t> mSharedValues;
 };
 } // namespace axoncache
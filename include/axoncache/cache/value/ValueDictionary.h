@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace axoncache
+{
+// Shared dictionary of a cache in compressed values mode (HeaderFlag::kCompressedValues). It is
+// trained on a sample of the string values, then every value is compressed on its own against it,
+// so a lookup decompresses one value and nothing else. Values whose redundancy is across records,
+// the same JSON field names and enum strings over and over, shrink as much as with a large block.
+// zstd with a trained dictionary spends a frame header on every value and decodes these short
+// values about 2x slower: on 122-byte JSON values it stores 34.5 bytes a value to 26.7 here.
+//
+// A compressed value is [ varint raw size ] then sequences of [ varint literal length ][ literals ]
+// [ varint match length - kMinMatch ][ varint distance ], the last sequence stops after its
+// literals. A match copies from distance bytes back in the dictionary followed by the output.
+//
+// Section layout: [ uint64_t size ][ uint32_t length ][ uint32_t 0 ][ dictionary bytes ]
+//                 [ zeros up to a multiple of 8 ]
+class ValueDictionary
+{
+  public:
+    static constexpr size_t kMaxSize = 64U * 1024U;
+    static constexpr size_t kMinMatch = 4U;
+
+    ValueDictionary() = default;
+    ValueDictionary( const ValueDictionary & ) = delete;
+    auto operator=( const ValueDictionary & ) -> ValueDictionary & = delete;
+    ValueDictionary( ValueDictionary && ) = default;
+    auto operator=( ValueDictionary && ) -> ValueDictionary & = default;
+
+    // Dictionary of at most maxSize bytes made of the segments most shared across samples
+    [[nodiscard]] static auto train( const std::vector<std::string_view> & samples, size_t maxSize = kMaxSize ) -> std::string;
+
+    [[nodiscard]] auto isEnabled() const -> bool
+    {
+        return mIsEnabled;
+    }
+
+    [[nodiscard]] auto bytes() const -> std::string_view
+    {
+        return mBytes;
+    }
+
+    // Size in bytes of the section, a multiple of 8
+    [[nodiscard]] auto size() const -> uint64_t
+    {
+        return mSize;
+    }
+
+    // Use dictionary to compress values, it is copied
+    auto set( std::string_view dictionary ) -> void;
+
+    // False when value does not get smaller, out then holds nothing useful
+    auto compress( std::string_view value, std::string & out ) const -> bool;
+
+    // Decompress into out and return its content
+    auto decompress( std::string_view compressed, std::string & out ) const -> std::string_view;
+
+    // Serialized size of the dictionary
+    [[nodiscard]] auto serializedSize() const -> uint64_t;
+
+    // Write the section to data, serializedSize() bytes
+    auto write( uint8_t * data ) -> void;
+
+    // Dictionary of a section written by write, data must outlive it
+    auto load( const uint8_t * data ) -> void;
+
+  private:
+    bool mIsEnabled{ false };
+    uint64_t mSize{ 0U };
+    std::string_view mBytes;
+    std::vector<char> mOwned; // unlike a string, its bytes don't move with it
+    // Hash chains over the dictionary positions, only built by set
+    std::vector<int32_t> mHead;
+    std::vector<int32_t> mPrev;
+};
+} // namespace axoncache
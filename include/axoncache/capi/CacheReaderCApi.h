@@ -26,9 +26,20 @@ extern "C"
     // This struct is a placeholder to be cast to the C++ object type we use internally.
     typedef struct _CacheReaderHandle CacheReaderHandle;
 
+// Bits of the CacheReader_Initialize loadOptions, 1 keeps meaning "preload memory"
+#define CACHE_READER_PRELOAD_MEMORY 1
+// Copy the cache into huge page backed memory, falls back to a regular mmap if that fails
+#define CACHE_READER_HUGE_PAGES 2
+// Serve ContainsKey, GetKey and the scalar getters of hot keys from a small per-thread cache
+#define CACHE_READER_HOT_KEY_CACHE 4
+
+// Metrics of CacheReader_ScoreMany and CacheReader_TopK
+#define CACHE_READER_SCORE_DOT_PRODUCT 0
+#define CACHE_READER_SCORE_COSINE 1
+
     // Creation/Init/Deletion
     CacheReaderHandle * NewCacheReaderHandle();
-    int CacheReader_Initialize( CacheReaderHandle * handle, const char * taskName, const char * destinationFolder, const char * timestamp, int isPreloadMemoryEnabled );
+    int CacheReader_Initialize( CacheReaderHandle * handle, const char * taskName, const char * destinationFolder, const char * timestamp, int loadOptions );
     void CacheReader_Finalize( CacheReaderHandle * handle );
     void CacheReader_DeleteCppObject( CacheReaderHandle * handle );
 
@@ -45,11 +56,50 @@ extern "C"
     // Caller need to free return ptr and valueSizes ptr
     char ** CacheReader_GetVector( CacheReaderHandle * handle, char * key, size_t keySize, int * vectorSize, int ** valueSizes );
     float * CacheReader_GetFloatVector( CacheReaderHandle * handle, char * key, size_t keySize, int * vectorSize );
+    int64_t * CacheReader_GetInt64List( CacheReaderHandle * handle, char * key, size_t keySize, int * listSize );
 
     char * CacheReader_GetKey( CacheReaderHandle * handle, char * key, size_t keySize, int * isExist, int * valueSize );
     char * CacheReader_GetVectorKey( CacheReaderHandle * handle, char * key, size_t keySize, int32_t index, int * valueSize );
     char * CacheReader_GetKeyType( CacheReaderHandle * handle, char * key, size_t keySize, int * valueSize );
 
+    // Whether the Int64List value of key holds id, decoded in place
+    int CacheReader_ContainsInt64( CacheReaderHandle * handle, char * key, size_t keySize, int64_t id );
+
+    // Bitmap values tested and intersected on the cache memory, a missing key is an empty set.
+    // ContainsMany takes keys like CacheReader_ScoreMany, writes keyCount 0 or 1 to found and
+    // returns the number of keys whose Bitmap holds value.
+    int CacheReader_BitmapContains( CacheReaderHandle * handle, char * key, size_t keySize, uint32_t value );
+    int64_t CacheReader_BitmapIntersectCount( CacheReaderHandle * handle, char * leftKey, size_t leftKeySize, char * rightKey, size_t rightKeySize );
+    int CacheReader_BitmapContainsMany( CacheReaderHandle * handle, char * keys, const size_t * keySizes, size_t keyCount, uint32_t value, int * found );
+
+    // Hash a key once and look it up in several readers. The hash is valid for every reader
+    // whose cache has the same hashFuncId. Free the CacheReader_GetKeyWithHash result like CacheReader_GetKey's.
+    uint64_t CacheReader_HashKey( CacheReaderHandle * handle, char * key, size_t keySize );
+    int CacheReader_ContainsKeyWithHash( CacheReaderHandle * handle, char * key, size_t keySize, uint64_t hash );
+    char * CacheReader_GetKeyWithHash( CacheReaderHandle * handle, char * key, size_t keySize, uint64_t hash, int * isExist, int * valueSize );
+    int64_t CacheReader_GetLongWithHash( CacheReaderHandle * handle, char * key, size_t keySize, uint64_t hash, int * isExist, int64_t defaultValue );
+    int CacheReader_GetIntegerWithHash( CacheReaderHandle * handle, char * key, size_t keySize, uint64_t hash, int * isExist, int defaultValue );
+    double CacheReader_GetDoubleWithHash( CacheReaderHandle * handle, char * key, size_t keySize, uint64_t hash, int * isExist, double defaultValue );
+    int CacheReader_GetBoolWithHash( CacheReaderHandle * handle, char * key, size_t keySize, uint64_t hash, int * isExist, int defaultValue );
+
+    // Scores of FloatList values, quantized ones included, against a query of querySize floats,
+    // computed on the cache memory. A key scores when it has a FloatList value of querySize floats.
+    // Batches take keyCount keys back to back in keys, with their sizes in keySizes.
+    float CacheReader_DotProduct( CacheReaderHandle * handle, char * key, size_t keySize, const float * query, size_t querySize, int * isExist );
+    float CacheReader_CosineSimilarity( CacheReaderHandle * handle, char * key, size_t keySize, const float * query, size_t querySize, int * isExist );
+    // Writes keyCount scores, defaultScore for keys that don't score. Returns the number of keys
+    // that scored, or -1 for an unknown metric.
+    int CacheReader_ScoreMany( CacheReaderHandle * handle, char * keys, const size_t * keySizes, size_t keyCount, const float * query, size_t querySize, int metric, float defaultScore, float * scores );
+    // Writes the indexes in keys and the scores of the k best scoring keys, best first, to indexes
+    // and scores of k entries each. Returns the number written, or -1 for an unknown metric.
+    int CacheReader_TopK( CacheReaderHandle * handle, char * keys, const size_t * keySizes, size_t keyCount, const float * query, size_t querySize, int metric, size_t k, int32_t * indexes, float * scores );
+
+    // Rows of an EMBEDDING cache. GatherRows writes keyCount rows of dimension floats to out, zeros
+    // for missing keys, and returns the number of keys found, or -1 unless an EMBEDDING cache with
+    // rows of dimension floats is loaded. GetEmbeddingDimension is 0 unless one is loaded.
+    int CacheReader_GetEmbeddingDimension( CacheReaderHandle * handle );
+    int CacheReader_GatherRows( CacheReaderHandle * handle, char * keys, const size_t * keySizes, size_t keyCount, float * out, size_t dimension );
+
 #ifdef __cplusplus
 }
 #endif
@@ -25,7 +25,7 @@ struct CacheHeader_s
     uint16_t offsetBits;   // for linear probe
     uint16_t hashFuncId;
 
-    uint32_t reserved;
+    uint32_t flags; // Constants::HeaderFlag bits, 0 in files written before flags existed
     uint32_t maxCollisions;
 
     double maxLoadFactor;
@@ -97,6 +97,7 @@ using CacheHeader = CacheHeader_s;
     vec.push_back( { "offset_bits", std::to_string( header.offsetBits ) } );
     vec.push_back( { "hash_func_id", std::to_string( header.hashFuncId ) } );
 
+    vec.push_back( { "flags", std::to_string( header.flags ) } );
     vec.push_back( { "max_collisions", std::to_string( header.maxCollisions ) } );
 
     vec.push_back( { "max_load_factor", std::to_string( header.maxLoadFactor ) } );
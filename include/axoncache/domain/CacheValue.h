@@ -23,10 +23,18 @@ enum class CacheValueType : uint8_t
     Double = 4,
     Int = 5,
     Float = 6,
-    FloatList = 7
+    FloatList = 7,
+    // FloatLists stored quantized, see FloatListQuantizer
+    Float16List = 8,
+    BFloat16List = 9,
+    Int8List = 10,
+    // Delta encoded int64_t values, see Int64ListCodec
+    Int64List = 11,
+    // Set of uint32_t values, see RoaringBitmap
+    Bitmap = 12
 };
 
-using VariantType = std::variant<std::string_view, std::vector<std::string_view>, bool, int32_t, float, double, int64_t, std::vector<float>>;
+using VariantType = std::variant<std::string_view, std::vector<std::string_view>, bool, int32_t, float, double, int64_t, std::vector<float>, std::vector<int64_t>>;
 
 class CacheValue
 {
@@ -38,6 +46,11 @@ class CacheValue
     explicit CacheValue( int64_t & value );
     explicit CacheValue( double & value );
     explicit CacheValue( std::vector<float> value );
+    // listType is FloatList or one of the quantized list types
+    CacheValue( std::vector<float> value, CacheValueType listType );
+    explicit CacheValue( std::vector<int64_t> value );
+    // listType is Int64List or Bitmap
+    CacheValue( std::vector<int64_t> value, CacheValueType listType );
 
     [[nodiscard]] auto type() const -> CacheValueType;
 
@@ -51,6 +64,7 @@ class CacheValue
     [[nodiscard]] auto asDouble() const -> const double &;
     [[nodiscard]] auto asInt64() const -> const int64_t &;
     [[nodiscard]] auto asFloatList() const -> const std::vector<float> &;
+    [[nodiscard]] auto asInt64List() const -> const std::vector<int64_t> &;
 
     [[nodiscard]] auto operator==( const CacheValue & rhs ) const -> bool;
 
@@ -90,6 +104,16 @@ using CacheKeyValue = std::pair<std::string_view, CacheValue>;
             return "Int64";
         case axoncache::CacheValueType::FloatList:
             return "FloatList";
+        case axoncache::CacheValueType::Float16List:
+            return "Float16List";
+        case axoncache::CacheValueType::BFloat16List:
+            return "BFloat16List";
+        case axoncache::CacheValueType::Int8List:
+            return "Int8List";
+        case axoncache::CacheValueType::Int64List:
+            return "Int64List";
+        case axoncache::CacheValueType::Bitmap:
+            return "Bitmap";
     }
     return "None";
 }
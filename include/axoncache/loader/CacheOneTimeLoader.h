@@ -10,7 +10,12 @@
 #include <stdexcept>
 #include "axoncache/logger/Logger.h"
 #include "axoncache/cache/CacheType.h"
+#include "axoncache/cache/CuckooCache.h"
+#include "axoncache/cache/EmbeddingCache.h"
 #include "axoncache/cache/LinearProbeCache.h"
+#include "axoncache/cache/LinearProbeSimdCache.h"
+#include "axoncache/cache/NumericCache.h"
+#include "axoncache/cache/PerfectHashCache.h"
 #include "axoncache/domain/CacheHeader.h"
 #include "axoncache/memory/MmapMemoryHandler.h"
 namespace axoncache
@@ -29,21 +34,22 @@ class CacheOneTimeLoader
     }
 
     template<typename Cache>
-    auto load( const std::string & cacheName, bool isPreloadMemoryEnabled = false ) -> std::shared_ptr<Cache>
+    auto load( const std::string & cacheName, bool isPreloadMemoryEnabled = false, bool isHugePagesEnabled = false ) -> std::shared_ptr<Cache>
     {
         auto cacheFileName = getFullCacheFileName( cacheName );
-        return loadAbsolutePath<Cache>( cacheName, cacheFileName, isPreloadMemoryEnabled );
+        return loadAbsolutePath<Cache>( cacheName, cacheFileName, isPreloadMemoryEnabled, isHugePagesEnabled );
     }
 
     template<typename Cache>
-    auto loadLatest( const std::string & cacheName, bool isPreloadMemoryEnabled = false ) -> std::shared_ptr<Cache>
+    auto loadLatest( const std::string & cacheName, bool isPreloadMemoryEnabled = false, bool isHugePagesEnabled = false ) -> std::shared_ptr<Cache>
     {
         auto cacheFileName = getLatestTimestampFullCacheFileName( cacheName );
-        return loadAbsolutePath<Cache>( cacheName, cacheFileName, isPreloadMemoryEnabled );
+        return loadAbsolutePath<Cache>( cacheName, cacheFileName, isPreloadMemoryEnabled, isHugePagesEnabled );
     }
 
+    // isHugePagesEnabled copies the file into huge page backed memory, see MmapMemoryHandler
     template<typename Cache>
-    auto loadAbsolutePath( const std::string & cacheName, const std::string & cacheFileName, bool isPreloadMemoryEnabled ) -> std::shared_ptr<Cache>
+    auto loadAbsolutePath( const std::string & cacheName, const std::string & cacheFileName, bool isPreloadMemoryEnabled, bool isHugePagesEnabled = false ) -> std::shared_ptr<Cache>
     {
         const auto [name, header] = loadHeader( cacheFileName );
         AL_LOG_INFO( "opened axoncache " + cacheFileName );
@@ -52,20 +58,60 @@ class CacheOneTimeLoader
             AL_LOG_WARN( "Loading cache name does not match the name in the header" );
         }
 
-        if constexpr ( std::is_same_v<Cache, axoncache::LinearProbeCache> )
+        if constexpr ( std::is_same_v<Cache, axoncache::LinearProbeCache> || std::is_same_v<Cache, axoncache::LinearProbeWyhashCache> )
         {
             if ( header.cacheType == static_cast<uint16_t>( CacheType::LINEAR_PROBE_DEDUP ) || header.cacheType == static_cast<uint16_t>( CacheType::LINEAR_PROBE_DEDUP_TYPED ) )
             {
                 throw std::runtime_error( "LINEAR_PROBE cache can't load LINEAR_PROBE_DEDUP or LINEAR_PROBE_DEDUP_TYPED cache data" );
             }
         }
+        else if constexpr ( std::is_same_v<Cache, axoncache::LinearProbeSimdCache> )
+        {
+            // The SIMD probe needs the tag array that only LINEAR_PROBE_SIMD files carry
+            if ( header.cacheType != static_cast<uint16_t>( CacheType::LINEAR_PROBE_SIMD ) )
+            {
+                throw std::runtime_error( "LINEAR_PROBE_SIMD cache can only load LINEAR_PROBE_SIMD cache data" );
+            }
+        }
+        else if constexpr ( std::is_same_v<Cache, axoncache::PerfectHashCache> )
+        {
+            if ( header.cacheType != static_cast<uint16_t>( CacheType::PERFECT_HASH ) )
+            {
+                throw std::runtime_error( "PERFECT_HASH cache can only load PERFECT_HASH cache data" );
+            }
+        }
+        else if constexpr ( std::is_same_v<Cache, axoncache::CuckooCache> )
+        {
+            if ( header.cacheType != static_cast<uint16_t>( CacheType::CUCKOO ) )
+            {
+                throw std::runtime_error( "CUCKOO cache can only load CUCKOO cache data" );
+            }
+        }
+        else if constexpr ( std::is_same_v<Cache, axoncache::NumericCache> )
+        {
+            if ( header.cacheType != static_cast<uint16_t>( CacheType::NUMERIC ) )
+            {
+                throw std::runtime_error( "NUMERIC cache can only load NUMERIC cache data" );
+            }
+        }
+        else if constexpr ( std::is_same_v<Cache, axoncache::EmbeddingCache> )
+        {
+            if ( header.cacheType != static_cast<uint16_t>( CacheType::EMBEDDING ) )
+            {
+                throw std::runtime_error( "EMBEDDING cache can only load EMBEDDING cache data" );
+            }
+        }
 
-        auto cache = std::make_shared<Cache>( header, std::make_unique<axoncache::MmapMemoryHandler>( header, cacheFileName, isPreloadMemoryEnabled ) );
-
-        if ( header.version != cache->version() )
+        if ( header.version < Constants::kBaseFormatVersion || header.version > CacheBase::runtimeVersion() )
         {
-            throw std::runtime_error( "trying to load file version " + std::to_string( header.version ) + " with a runtime version " + std::to_string( cache->version() ) );
+            throw std::runtime_error( "trying to load file version " + std::to_string( header.version ) + " with a runtime version " + std::to_string( CacheBase::runtimeVersion() ) );
         }
+        if ( ( header.flags & ~Constants::HeaderFlag::kKnownFlags ) != 0U )
+        {
+            throw std::runtime_error( "trying to load file with unknown header flags " + std::to_string( header.flags & ~Constants::HeaderFlag::kKnownFlags ) );
+        }
+
+        auto cache = std::make_shared<Cache>( header, std::make_unique<axoncache::MmapMemoryHandler>( header, cacheFileName, isPreloadMemoryEnabled, isHugePagesEnabled ) );
 
         mTimestamp = cacheFileName.substr( 0, cacheFileName.length() - Constants::kCacheFileNameSuffix.size() );
         mTimestamp = mTimestamp.substr( mTimestamp.find_last_not_of( "0123456789" ) + 1 );
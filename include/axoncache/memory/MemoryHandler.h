@@ -33,6 +33,9 @@ class MemoryHandler
     virtual auto allocate( uint64_t newSize ) -> void = 0;
     virtual auto grow( uint64_t growByBytes ) -> uint8_t *;
 
+    // Drop the bytes past newSize, the allocation itself is kept
+    auto truncate( uint64_t newSize ) -> void;
+
   protected:
     auto setData( uint8_t * data ) -> void;
 
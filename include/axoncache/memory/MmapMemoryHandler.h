@@ -4,7 +4,6 @@
 #pragma once
 
 #include <string>
-#include <utility>
 #include <stddef.h>
 #include <stdint.h>
 #include "axoncache/domain/CacheHeader.h"
@@ -15,7 +14,10 @@ namespace axoncache
 class MmapMemoryHandler : public MemoryHandler
 {
   public:
-    MmapMemoryHandler( const CacheHeader & header, const std::string & cacheFile, bool isPreloadMemoryEnabled = false );
+    // With isHugePagesEnabled the file is copied into anonymous huge page backed memory (MAP_HUGETLB, or
+    // MADV_HUGEPAGE when the huge page pool is empty) to cut TLB misses on large caches. The copy is
+    // private RSS; if it can't be made the file is mapped as usual.
+    MmapMemoryHandler( const CacheHeader & header, const std::string & cacheFile, bool isPreloadMemoryEnabled = false, bool isHugePagesEnabled = false );
     ~MmapMemoryHandler() override;
 
     MmapMemoryHandler( const MmapMemoryHandler & ) = delete;
@@ -27,14 +29,29 @@ class MmapMemoryHandler : public MemoryHandler
 
     auto allocate( uint64_t newSize ) -> void override;
 
+    [[nodiscard]] auto isHugePageBacked() const -> bool
+    {
+        return mIsHugePageBacked;
+    }
+
   protected:
     auto resizeToFit( uint64_t newSize ) -> void override;
 
   private:
-    static auto loadMmap( const CacheHeader & header, const std::string & cacheFile, bool isPreloadMemoryEnabled ) -> std::pair<uint8_t *, size_t>;
+    struct Mapping
+    {
+        uint8_t * basePointer;
+        uint64_t fileSize;
+        uint64_t mappedSize; // rounded up to the huge page size for a huge page copy
+        bool isHugePageBacked;
+    };
+
+    static auto loadMmap( const CacheHeader & header, const std::string & cacheFile, bool isPreloadMemoryEnabled, bool isHugePagesEnabled ) -> Mapping;
 
     uint8_t * mBasePointer{};
     uint64_t mBaseSize{};
+    uint64_t mMappedSize{};
     uint64_t mHeaderSize{};
+    bool mIsHugePageBacked{};
 };
 }
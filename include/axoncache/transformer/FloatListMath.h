@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <utility>
+#include "axoncache/domain/CacheValue.h"
+#include "axoncache/transformer/FloatListQuantizer.h"
+
+namespace axoncache
+{
+enum class FloatListScore : int
+{
+    DotProduct = 0,
+    Cosine = 1,
+};
+
+// Scores a FloatList value, or a quantized one (see FloatListQuantizer), against a query vector
+// straight from its bytes in the cache: quantized floats are widened in registers and never
+// written out. Like dequantize, it picks the best instruction set of the CPU (AVX2 with FMA and
+// F16C, NEON or scalar). The SIMD paths sum in another order than the scalar one, so scores may
+// differ in the last bits between CPUs.
+class FloatListMath
+{
+  public:
+    [[nodiscard]] static auto isFloatList( CacheValueType type ) -> bool
+    {
+        return type == CacheValueType::FloatList || FloatListQuantizer::isQuantized( type );
+    }
+
+    // Number of floats in bytes, for a type isFloatList accepts
+    [[nodiscard]] static auto size( std::string_view bytes, CacheValueType type ) -> size_t
+    {
+        return type == CacheValueType::FloatList ? bytes.size() / sizeof( float ) : FloatListQuantizer::size( bytes, type );
+    }
+
+    // Dot product of the size( bytes, type ) floats of bytes with as many floats of query
+    [[nodiscard]] static auto dot( std::string_view bytes, CacheValueType type, const float * query ) -> float;
+
+    [[nodiscard]] static auto squaredNorm( std::span<const float> values ) -> float;
+
+    // Score of the value of key against query, not found when the value is not a FloatList or
+    // its size is not the query size. querySquaredNorm is only used by Cosine, a zero vector
+    // scores 0. The key is only used in the error logs.
+    [[nodiscard]] static auto score( std::string_view key, std::pair<std::string_view, CacheValueType> valueAndType, std::span<const float> query, FloatListScore metric, float querySquaredNorm ) -> std::pair<float, bool>;
+
+    // Instruction set the scores run with: "avx2", "neon" or "scalar"
+    [[nodiscard]] static auto isaName() -> std::string_view;
+};
+}
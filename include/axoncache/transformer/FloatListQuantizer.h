@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "axoncache/domain/CacheValue.h"
+
+namespace axoncache
+{
+// Bytes of a FloatList stored with fewer bits per float, for the quantized list types:
+//   Float16List  [ IEEE half ] * n, 2x smaller, about 3 significant digits
+//   BFloat16List [ upper half of the float bits ] * n, 2x smaller, the float range with 2 to 3 digits
+//   Int8List     [ float scale ][ int8_t ] * n, 4x smaller for long lists, value = int8 * scale
+//                where scale = max |value| / 127, so the error is at most scale / 2
+//
+// Reads dequantize with the best instruction set of the CPU (F16C/AVX2, NEON or scalar), the
+// same floats whichever is picked. getWithType returns the quantized bytes for callers that
+// work on them directly.
+class FloatListQuantizer
+{
+  public:
+    [[nodiscard]] static auto isQuantized( CacheValueType type ) -> bool
+    {
+        return type == CacheValueType::Float16List || type == CacheValueType::BFloat16List || type == CacheValueType::Int8List;
+    }
+
+    // Int8List values must be finite
+    [[nodiscard]] static auto quantize( const std::vector<float> & values, CacheValueType type ) -> std::string;
+
+    // Number of floats in bytes
+    [[nodiscard]] static auto size( std::string_view bytes, CacheValueType type ) -> size_t;
+
+    // Writes the size( bytes, type ) floats of bytes to out
+    static auto dequantize( std::string_view bytes, CacheValueType type, float * out ) -> void;
+
+    [[nodiscard]] static auto dequantize( std::string_view bytes, CacheValueType type ) -> std::vector<float>
+    {
+        std::vector<float> values( size( bytes, type ) );
+        dequantize( bytes, type, values.data() );
+        return values;
+    }
+
+    // Float at index, which must be less than size( bytes, type )
+    [[nodiscard]] static auto at( std::string_view bytes, CacheValueType type, size_t index ) -> float;
+
+    // Instruction set dequantize picked: "avx2", "neon" or "scalar"
+    [[nodiscard]] static auto isaName() -> std::string_view;
+
+    [[nodiscard]] static auto toHalf( float value ) -> uint16_t;
+    [[nodiscard]] static auto fromHalf( uint16_t half ) -> float;
+    [[nodiscard]] static auto toBFloat16( float value ) -> uint16_t;
+    [[nodiscard]] static auto fromBFloat16( uint16_t bfloat16 ) -> float;
+};
+}
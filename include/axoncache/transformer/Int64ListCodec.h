@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace axoncache
+{
+// Bytes of an Int64List value, the values as deltas in blocks of kBlockSize:
+//   [ uint32_t count ][ uint32_t flags ]
+//   [ int64_t first ] * blocks   first value of each block, binary searched when kSorted
+//   [ uint32_t offset ] * blocks start of each block after the offsets
+//   blocks of [ uint8_t format ] then the deltas from each value to the next in the block:
+//     kStreamVByte [ 2 bits per delta, its size - 1 ][ 1 to 4 bytes per delta ]
+//     kRaw         [ uint64_t ] * deltas, when a delta doesn't fit 32 bits
+//
+// Deltas of a sorted list (non decreasing) are plain differences, otherwise zigzag encoded so
+// small negative steps stay small. Sorted ids a few hundred apart take 1 to 2 bytes each against
+// 10 and more for the decimal strings of a StringList. Blocks decode with the best instruction
+// set of the CPU (SSSE3, NEON or scalar), the same values whichever is picked.
+class Int64ListCodec
+{
+  public:
+    static constexpr size_t kBlockSize = 128U;
+    static constexpr uint32_t kSorted = 1U;
+    static constexpr uint8_t kStreamVByte = 0U;
+    static constexpr uint8_t kRaw = 1U;
+
+    [[nodiscard]] static auto encode( const std::vector<int64_t> & values ) -> std::string;
+
+    // Number of values in bytes, 0 for empty bytes
+    [[nodiscard]] static auto size( std::string_view bytes ) -> size_t;
+
+    [[nodiscard]] static auto isSorted( std::string_view bytes ) -> bool;
+
+    // Writes the values of block, up to kBlockSize, to out and returns how many
+    static auto decodeBlock( std::string_view bytes, size_t block, int64_t * out ) -> size_t;
+
+    // Writes the size( bytes ) values of bytes to out
+    static auto decode( std::string_view bytes, int64_t * out ) -> void;
+
+    [[nodiscard]] static auto decode( std::string_view bytes ) -> std::vector<int64_t>
+    {
+        std::vector<int64_t> values( size( bytes ) );
+        decode( bytes, values.data() );
+        return values;
+    }
+
+    // A sorted list decodes the one block whose range holds value, found by binary search over
+    // the block first values, other lists decode block by block until value shows up
+    [[nodiscard]] static auto contains( std::string_view bytes, int64_t value ) -> bool;
+
+    // Instruction set decodeBlock picked: "ssse3", "neon" or "scalar"
+    [[nodiscard]] static auto isaName() -> std::string_view;
+};
+
+// Values of an Int64List read in place, one block decoded at a time into the iterator, so a
+// walk over the list allocates nothing. The view points into the cache like getWithType
+// results do.
+class Int64ListView
+{
+  public:
+    class Iterator
+    {
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = int64_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const int64_t *;
+        using reference = const int64_t &;
+
+        Iterator() = default;
+
+        explicit Iterator( std::string_view bytes ) :
+            mBytes( bytes ), mCount( Int64ListCodec::size( bytes ) )
+        {
+            if ( mCount != 0U )
+            {
+                Int64ListCodec::decodeBlock( mBytes, 0U, mValues.data() );
+            }
+        }
+
+        auto operator*() const -> reference
+        {
+            return mValues[mIndex % Int64ListCodec::kBlockSize];
+        }
+
+        auto operator++() -> Iterator &
+        {
+            ++mIndex;
+            if ( mIndex < mCount && mIndex % Int64ListCodec::kBlockSize == 0U )
+            {
+                Int64ListCodec::decodeBlock( mBytes, mIndex / Int64ListCodec::kBlockSize, mValues.data() );
+            }
+            return *this;
+        }
+
+        auto operator++( int ) -> void
+        {
+            ++*this;
+        }
+
+        auto operator==( std::default_sentinel_t /* end */ ) const -> bool
+        {
+            return mIndex >= mCount;
+        }
+
+      private:
+        std::string_view mBytes;
+        size_t mCount{ 0U };
+        size_t mIndex{ 0U };
+        std::array<int64_t, Int64ListCodec::kBlockSize> mValues{};
+    };
+
+    Int64ListView() = default;
+
+    explicit Int64ListView( std::string_view bytes ) :
+        mBytes( bytes )
+    {
+    }
+
+    [[nodiscard]] auto begin() const -> Iterator
+    {
+        return Iterator( mBytes );
+    }
+
+    [[nodiscard]] auto end() const -> std::default_sentinel_t
+    {
+        return std::default_sentinel;
+    }
+
+    [[nodiscard]] auto size() const -> size_t
+    {
+        return Int64ListCodec::size( mBytes );
+    }
+
+    [[nodiscard]] auto empty() const -> bool
+    {
+        return size() == 0U;
+    }
+
+    [[nodiscard]] auto isSorted() const -> bool
+    {
+        return Int64ListCodec::isSorted( mBytes );
+    }
+
+    [[nodiscard]] auto contains( int64_t value ) const -> bool
+    {
+        return Int64ListCodec::contains( mBytes, value );
+    }
+
+    [[nodiscard]] auto toVector() const -> std::vector<int64_t>
+    {
+        return Int64ListCodec::decode( mBytes );
+    }
+
+    // The encoded bytes
+    [[nodiscard]] auto bytes() const -> std::string_view
+    {
+        return mBytes;
+    }
+
+  private:
+    std::string_view mBytes;
+};
+}
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace axoncache
+{
+// Bytes of a Bitmap value, a set of uint32_t in the frozen layout of a roaring bitmap, read in
+// place from the cache memory:
+//   [ uint32_t cardinality ][ uint32_t containers ]
+//   [ uint16_t key ] * containers                high 16 bits of the values, ascending
+//   [ uint16_t cardinality - 1 ] * containers
+//   [ uint32_t offset ] * containers             from the start of the bytes
+//   containers of the low 16 bits of the values with one key:
+//     array  [ uint16_t ] * cardinality ascending, up to kArrayMaxCardinality values
+//     bitset [ uint64_t ] * 1024, 8-byte aligned in the bytes
+//
+// A lookup binary searches the keys then its container, an intersection walks the keys of both
+// sets and counts container pairs: merged arrays, array values tested in a bitset, or bitsets
+// ANDed and counted with the best instruction set of the CPU (AVX2, NEON or scalar).
+class RoaringBitmap
+{
+  public:
+    static constexpr size_t kArrayMaxCardinality = 4096U;
+    static constexpr size_t kBitsetWords = 1024U;
+
+    // Values must be within the uint32_t range, duplicates are dropped
+    [[nodiscard]] static auto encode( const std::vector<int64_t> & values ) -> std::string;
+
+    // Number of values in bytes, 0 for empty bytes
+    [[nodiscard]] static auto cardinality( std::string_view bytes ) -> size_t;
+
+    [[nodiscard]] static auto contains( std::string_view bytes, uint32_t value ) -> bool;
+
+    // Number of values in both sets, without materializing them
+    [[nodiscard]] static auto intersectCount( std::string_view left, std::string_view right ) -> uint64_t;
+
+    // Values in ascending order
+    [[nodiscard]] static auto decode( std::string_view bytes ) -> std::vector<uint32_t>;
+
+    // Instruction set of the bitset intersections: "avx2", "neon" or "scalar"
+    [[nodiscard]] static auto isaName() -> std::string_view;
+};
+
+// Bitmap value read in place, it points into the cache like getWithType results do
+class BitmapView
+{
+  public:
+    BitmapView() = default;
+
+    explicit BitmapView( std::string_view bytes ) :
+        mBytes( bytes )
+    {
+    }
+
+    [[nodiscard]] auto cardinality() const -> size_t
+    {
+        return RoaringBitmap::cardinality( mBytes );
+    }
+
+    [[nodiscard]] auto empty() const -> bool
+    {
+        return cardinality() == 0U;
+    }
+
+    [[nodiscard]] auto contains( uint32_t value ) const -> bool
+    {
+        return RoaringBitmap::contains( mBytes, value );
+    }
+
+    [[nodiscard]] auto intersectCount( const BitmapView & other ) const -> uint64_t
+    {
+        return RoaringBitmap::intersectCount( mBytes, other.mBytes );
+    }
+
+    [[nodiscard]] auto toVector() const -> std::vector<uint32_t>
+    {
+        return RoaringBitmap::decode( mBytes );
+    }
+
+    // The encoded bytes
+    [[nodiscard]] auto bytes() const -> std::string_view
+    {
+        return mBytes;
+    }
+
+  private:
+    std::string_view mBytes;
+};
+}
@@ -9,11 +9,25 @@
 
 namespace axoncache
 {
+// StringList values are encoded either as
+//   [ uint16_t count ]( [ uint16_t length ][ element ][ '\0' ] ) * count
+// or, indexed, so that element i is found without walking the elements before it, as
+//   [ uint16_t 0 ][ uint32_t count ][ uint32_t end ] * count ( [ element ][ '\0' ] ) * count
+// where end is the offset just past the '\0' of the element from the start of the elements. A
+// leading 0 followed by more bytes can't be a plain empty list, so the decoders read both.
 class StringListToString
 {
   public:
     static auto transform( const std::vector<std::string_view> & input ) -> std::string;
 
+    // An empty list keeps the plain encoding
+    static auto transformIndexed( const std::vector<std::string_view> & input ) -> std::string;
+
     static auto transform( std::string_view input ) -> std::vector<std::string_view>;
+
+    // Neither allocates. at walks the elements before index of a plain encoding, index must be
+    // less than size( input )
+    static auto size( std::string_view input ) -> size_t;
+    static auto at( std::string_view input, size_t index ) -> std::string_view;
 };
 }
@@ -3,8 +3,8 @@
 
 #pragma once
 
-#define AXONCACHE_VERSION "2.5"
+#define AXONCACHE_VERSION "2.6"
 
 #define AXONCACHE_VERSION_MAJOR 2
-#define AXONCACHE_VERSION_MINOR 5
+#define AXONCACHE_VERSION_MINOR 6
 #define AXONCACHE_VERSION_PATCH 0
@@ -4,6 +4,7 @@
 #include <jni.h>
 #include <string>
 #include <cstring>
+#include <vector>
 #include "axoncache/capi/CacheReaderCApi.h"
 #include "JniHelpers.h"
 
@@ -245,6 +246,102 @@ extern "C" JNIEXPORT jfloatArray JNICALL Java_com_applovin_axoncache_CacheReader
     return nullptr;
 }
 
+namespace
+{
+// Keys back to back with their sizes, the layout of the batched C calls
+void concatKeys( JNIEnv * env, jobjectArray keys, std::string & concatenated, std::vector<size_t> & sizes )
+{
+    const jsize count = env->GetArrayLength( keys );
+    sizes.reserve( count );
+    for ( jsize i = 0; i < count; ++i )
+    {
+        jstring key = static_cast<jstring>( env->GetObjectArrayElement( keys, i ) );
+        std::string keyStr = key == nullptr ? std::string{} : convertToUtf8( env, key );
+        env->DeleteLocalRef( key );
+        concatenated += keyStr;
+        sizes.push_back( keyStr.size() );
+    }
+}
+}
+
+extern "C" JNIEXPORT jobject JNICALL Java_com_applovin_axoncache_CacheReader_nativeScore( JNIEnv * env, jobject obj, jlong handle, jstring key, jfloatArray query, jint metric )
+{
+    CacheReaderHandle * readerHandle = reinterpret_cast<CacheReaderHandle *>( handle );
+    std::string keyStr = convertToUtf8( env, key );
+
+    const jsize querySize = env->GetArrayLength( query );
+    std::vector<float> queryValues( querySize );
+    env->GetFloatArrayRegion( query, 0, querySize, queryValues.data() );
+
+    int isExist = 0;
+    float result = metric == CACHE_READER_SCORE_COSINE ? CacheReader_CosineSimilarity( readerHandle, const_cast<char *>( keyStr.c_str() ), keyStr.size(), queryValues.data(), queryValues.size(), &isExist )
+                                                        : CacheReader_DotProduct( readerHandle, const_cast<char *>( keyStr.c_str() ), keyStr.size(), queryValues.data(), queryValues.size(), &isExist );
+
+    if ( isExist == 0 )
+    {
+        return nullptr;
+    }
+
+    jclass floatClass = env->FindClass( "java/lang/Float" );
+    if ( floatClass == nullptr )
+    {
+        return nullptr;
+    }
+
+    jmethodID floatConstructor = env->GetMethodID( floatClass, "<init>", "(F)V" );
+    if ( floatConstructor == nullptr )
+    {
+        return nullptr;
+    }
+
+    return env->NewObject( floatClass, floatConstructor, result );
+}
+
+extern "C" JNIEXPORT jfloatArray JNICALL Java_com_applovin_axoncache_CacheReader_nativeScoreMany( JNIEnv * env, jobject obj, jlong handle, jobjectArray keys, jfloatArray query, jint metric, jfloat defaultScore )
+{
+    CacheReaderHandle * readerHandle = reinterpret_cast<CacheReaderHandle *>( handle );
+    std::string concatenated;
+    std::vector<size_t> sizes;
+    concatKeys( env, keys, concatenated, sizes );
+
+    const jsize querySize = env->GetArrayLength( query );
+    std::vector<float> queryValues( querySize );
+    env->GetFloatArrayRegion( query, 0, querySize, queryValues.data() );
+
+    std::vector<float> scores( sizes.size() );
+    if ( CacheReader_ScoreMany( readerHandle, concatenated.data(), sizes.data(), sizes.size(), queryValues.data(), queryValues.size(), metric, defaultScore, scores.data() ) < 0 )
+    {
+        return nullptr;
+    }
+
+    jfloatArray result = env->NewFloatArray( static_cast<jsize>( scores.size() ) );
+    env->SetFloatArrayRegion( result, 0, static_cast<jsize>( scores.size() ), scores.data() );
+    return result;
+}
+
+extern "C" JNIEXPORT jint JNICALL Java_com_applovin_axoncache_CacheReader_nativeTopK( JNIEnv * env, jobject obj, jlong handle, jobjectArray keys, jfloatArray query, jint metric, jint k, jintArray indexes, jfloatArray scores )
+{
+    CacheReaderHandle * readerHandle = reinterpret_cast<CacheReaderHandle *>( handle );
+    std::string concatenated;
+    std::vector<size_t> sizes;
+    concatKeys( env, keys, concatenated, sizes );
+
+    const jsize querySize = env->GetArrayLength( query );
+    std::vector<float> queryValues( querySize );
+    env->GetFloatArrayRegion( query, 0, querySize, queryValues.data() );
+
+    const size_t count = k > 0 ? static_cast<size_t>( k ) : 0U;
+    std::vector<int32_t> bestIndexes( count );
+    std::vector<float> bestScores( count );
+    const int written = CacheReader_TopK( readerHandle, concatenated.data(), sizes.data(), sizes.size(), queryValues.data(), queryValues.size(), metric, count, bestIndexes.data(), bestScores.data() );
+    if ( written > 0 )
+    {
+        env->SetIntArrayRegion( indexes, 0, written, reinterpret_cast<const jint *>( bestIndexes.data() ) );
+        env->SetFloatArrayRegion( scores, 0, written, bestScores.data() );
+    }
+    return written;
+}
+
 extern "C" JNIEXPORT jint JNICALL Java_com_applovin_axoncache_CacheReader_nativeGetVectorKeySize( JNIEnv * env, jobject obj, jlong handle, jstring key )
 {
     CacheReaderHandle * readerHandle = reinterpret_cast<CacheReaderHandle *>( handle );
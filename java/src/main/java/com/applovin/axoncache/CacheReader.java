@@ -13,6 +13,9 @@ public class CacheReader implements AutoCloseable {
         NativeLibraryLoader.load();
     }
 
+    public static final int SCORE_DOT_PRODUCT = 0;
+    public static final int SCORE_COSINE = 1;
+
     private long nativeHandle;
 
     /**
@@ -151,6 +154,70 @@ public class CacheReader implements AutoCloseable {
         return nativeGetFloatVector(nativeHandle, key);
     }
 
+    /**
+     * Dot product of the float vector of a key with a query, computed on the cache memory
+     * 
+     * @param key The key to look up
+     * @param query The query vector
+     * @return The score, or null if not found or the sizes differ
+     */
+    public Float dotProduct(String key, float[] query) {
+        if (nativeHandle == 0) {
+            throw new IllegalStateException("CacheReader has been closed");
+        }
+        return nativeScore(nativeHandle, key, query, SCORE_DOT_PRODUCT);
+    }
+
+    /**
+     * Cosine similarity of the float vector of a key with a query, computed on the cache memory
+     * 
+     * @param key The key to look up
+     * @param query The query vector
+     * @return The score, or null if not found or the sizes differ
+     */
+    public Float cosineSimilarity(String key, float[] query) {
+        if (nativeHandle == 0) {
+            throw new IllegalStateException("CacheReader has been closed");
+        }
+        return nativeScore(nativeHandle, key, query, SCORE_COSINE);
+    }
+
+    /**
+     * Scores the float vectors of many keys against a query
+     * 
+     * @param keys The keys to look up
+     * @param query The query vector
+     * @param metric SCORE_DOT_PRODUCT or SCORE_COSINE
+     * @param defaultScore The score of the keys that are not found
+     * @return One score per key
+     */
+    public float[] scoreMany(String[] keys, float[] query, int metric, float defaultScore) {
+        if (nativeHandle == 0) {
+            throw new IllegalStateException("CacheReader has been closed");
+        }
+        return nativeScoreMany(nativeHandle, keys, query, metric, defaultScore);
+    }
+
+    /**
+     * Finds the k best scoring keys against a query, best first
+     * 
+     * @param keys The keys to look up
+     * @param query The query vector
+     * @param metric SCORE_DOT_PRODUCT or SCORE_COSINE
+     * @param indexes Receives the indexes in keys of the best keys, at least k entries
+     * @param scores Receives their scores, at least k entries
+     * @return The number of keys written, at most k
+     */
+    public int topK(String[] keys, float[] query, int metric, int k, int[] indexes, float[] scores) {
+        if (nativeHandle == 0) {
+            throw new IllegalStateException("CacheReader has been closed");
+        }
+        if (indexes.length < k || scores.length < k) {
+            throw new IllegalArgumentException("indexes and scores need at least k entries");
+        }
+        return nativeTopK(nativeHandle, keys, query, metric, k, indexes, scores);
+    }
+
     /**
      * Gets the size of a vector for a key
      * 
@@ -213,6 +280,9 @@ public class CacheReader implements AutoCloseable {
     private native Boolean nativeGetBool(long handle, String key);
     private native String[] nativeGetVector(long handle, String key);
     private native float[] nativeGetFloatVector(long handle, String key);
+    private native Float nativeScore(long handle, String key, float[] query, int metric);
+    private native float[] nativeScoreMany(long handle, String[] keys, float[] query, int metric, float defaultScore);
+    private native int nativeTopK(long handle, String[] keys, float[] query, int metric, int k, int[] indexes, float[] scores);
     private native int nativeGetVectorKeySize(long handle, String key);
     private native String nativeGetVectorKey(long handle, String key, int index);
     private native String nativeGetKeyType(long handle, String key);
@@ -269,10 +269,11 @@ auto benchModeAxonCacheCppApi(
         // file was being charged to them here, which the C api bench does not do.
         auto start = clock::now();
 
+        std::string buffer;
         for ( int idx = 0; idx < numKeys; ++idx )
         {
             const auto & key = keys[idx];
-            auto result = cache->getString( std::string_view{ key.data(), key.size() } );
+            auto result = cache->getString( std::string_view{ key.data(), key.size() }, buffer );
             if ( !result.second )
             {
                 throw std::runtime_error( "Error looking up value" );
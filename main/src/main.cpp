@@ -49,7 +49,8 @@ void handleGet(
     const std::string & key,
     bool quiet )
 {
-    const auto value = cache->get( key );
+    std::string buffer;
+    const auto value = cache->getString( key, buffer ).first;
     if ( !quiet )
     {
         std::cout << value << "\n";
@@ -566,6 +567,22 @@ auto createMode( axoncache::SharedSettingsProvider * settings, const cxxopts::Pa
                 auto values = axoncache::stringViewToVector<float>( value, ':', value.size() );
                 cache->put( key, values );
             }
+            else if ( type == "Float16List" || type == "BFloat16List" || type == "Int8List" )
+            {
+                auto values = axoncache::stringViewToVector<float>( value, ':', value.size() );
+                const auto listType = type == "Float16List" ? axoncache::CacheValueType::Float16List : ( type == "BFloat16List" ? axoncache::CacheValueType::BFloat16List : axoncache::CacheValueType::Int8List );
+                cache->put( key, values, listType );
+            }
+            else if ( type == "Int64List" )
+            {
+                const auto values = value.empty() ? std::vector<int64_t>{} : axoncache::stringViewToVector<int64_t>( value, ':', value.size() );
+                cache->put( key, values );
+            }
+            else if ( type == "Bitmap" )
+            {
+                const auto values = value.empty() ? std::vector<int64_t>{} : axoncache::stringViewToVector<int64_t>( value, ':', value.size() );
+                cache->put( key, values, axoncache::CacheValueType::Bitmap );
+            }
             else
             {
                 std::cerr << "Unknown type (" << type << ") in " << lineNumber << "th line, skipping\n";
@@ -13,6 +13,9 @@
 #include "axoncache/builder/CacheFileBuilder.h"
 #include "axoncache/cache/CacheType.h"
 #include "axoncache/cache/factory/CacheFactory.h"
+#include "axoncache/cache/hasher/HashFunc.h"
+#include "axoncache/cache/probe/LinearProbe.h"
+#include "axoncache/cache/probe/SlotMapping.h"
 #include "axoncache/logger/Logger.h"
 
 using namespace axoncache;
@@ -44,7 +47,7 @@ CacheGenerator::CacheGenerator( const SharedSettingsProvider * settings ) :
         {
             args.offsetBits = settings->getInt( std::string{ Constants::ConfKey::kOffsetBits } + "." + cacheName, Constants::ConfDefault::kBucketChainOffsetBits );
         }
-        else if ( args.cacheType == CacheType::LINEAR_PROBE )
+        else if ( args.cacheType == CacheType::LINEAR_PROBE || args.cacheType == CacheType::LINEAR_PROBE_SIMD || args.cacheType == CacheType::PERFECT_HASH || args.cacheType == CacheType::CUCKOO || args.cacheType == CacheType::NUMERIC || args.cacheType == CacheType::EMBEDDING )
         {
             args.offsetBits = settings->getInt( std::string{ Constants::ConfKey::kOffsetBits } + "." + cacheName, Constants::ConfDefault::kLinearProbeOffsetBits );
         }
@@ -55,6 +58,17 @@ CacheGenerator::CacheGenerator( const SharedSettingsProvider * settings ) :
 
         args.numberOfKeySlots = settings->getInt( std::string{ Constants::ConfKey::kKeySlots } + "." + cacheName, Constants::ConfDefault::kKeySlots );
         args.maxLoadFactor = settings->getDouble( std::string{ Constants::ConfKey::kMaxLoadFactor.data() } + "." + cacheName, Constants::ConfDefault::kMaxLoadFactor );
+        args.headerFlags = settings->getBool( std::string{ Constants::ConfKey::kRobinHood } + "." + cacheName, false ) ? Constants::HeaderFlag::kRobinHood : 0U;
+        args.headerFlags |= settings->getBool( std::string{ Constants::ConfKey::kNegativeLookupFilter } + "." + cacheName, false ) ? Constants::HeaderFlag::kNegativeLookupFilter : 0U;
+        args.headerFlags |= settings->getBool( std::string{ Constants::ConfKey::kNamespacePrefix } + "." + cacheName, false ) ? Constants::HeaderFlag::kNamespacePrefix : 0U;
+        args.headerFlags |= settings->getBool( std::string{ Constants::ConfKey::kKeyFingerprint } + "." + cacheName, false ) ? Constants::HeaderFlag::kKeyFingerprint : 0U;
+        args.headerFlags |= settings->getBool( std::string{ Constants::ConfKey::kCompressedValues } + "." + cacheName, false ) ? Constants::HeaderFlag::kCompressedValues : 0U;
+        args.headerFlags |= settings->getBool( std::string{ Constants::ConfKey::kIndexedStringLists } + "." + cacheName, false ) ? Constants::HeaderFlag::kIndexedStringLists : 0U;
+        args.headerFlags |= settings->getBool( std::string{ Constants::ConfKey::kSharedValues } + "." + cacheName, false ) ? Constants::HeaderFlag::kSharedValues : 0U;
+        args.headerFlags |= slotMappingHeaderFlag( settings->getString( std::string{ Constants::ConfKey::kSlotMapping } + "." + cacheName, "modulo" ) );
+        args.headerFlags |= linear::valueAlignmentHeaderFlag( settings->getInt( std::string{ Constants::ConfKey::kValueAlignment } + "." + cacheName, 0 ) );
+        args.frequentValues = settings->getInt( std::string{ Constants::ConfKey::kFrequentValues } + "." + cacheName, 0 );
+        args.hashFuncId = hashFuncIdFromName( settings->getString( std::string{ Constants::ConfKey::kHashFunc } + "." + cacheName, "xxh3" ) );
 
         args.cacheName = cacheName;
         args.outputDirectory = settings->getString( std::string{ Constants::ConfKey::kOutputDir } + "." + cacheName, Constants::ConfDefault::kOutputDir.data() );
@@ -84,11 +98,15 @@ auto CacheGenerator::start( const std::vector<std::string> & values ) const -> v
 
         AL_LOG_INFO( oss.str() );
 
-        auto cache = CacheFactory::createCache( cacheArg.offsetBits, cacheArg.numberOfKeySlots, cacheArg.maxLoadFactor, cacheArg.cacheType );
+        auto cache = CacheFactory::createCache( cacheArg.offsetBits, cacheArg.numberOfKeySlots, cacheArg.maxLoadFactor, cacheArg.cacheType, cacheArg.headerFlags, cacheArg.hashFuncId );
         if ( !values.empty() && ( cacheArg.cacheType == CacheType::LINEAR_PROBE_DEDUP || cacheArg.cacheType == CacheType::LINEAR_PROBE_DEDUP_TYPED ) )
         {
             ( ( LinearProbeDedupCache * )cache.get() )->setDuplicatedValues( values );
         }
+        else if ( cacheArg.frequentValues != 0U && ( cacheArg.cacheType == CacheType::LINEAR_PROBE_DEDUP || cacheArg.cacheType == CacheType::LINEAR_PROBE_DEDUP_TYPED ) )
+        {
+            ( ( LinearProbeDedupCache * )cache.get() )->detectFrequentValues( cacheArg.frequentValues );
+        }
         CacheFileBuilder cacheFileBuilder( settings(), cacheArg.outputDirectory, cacheArg.cacheName, cacheArg.inputFiles, std::move( cache ) );
         cacheFileBuilder.build();
     }
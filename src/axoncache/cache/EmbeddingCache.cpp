@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include "axoncache/cache/EmbeddingCache.h"
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include "axoncache/logger/Logger.h"
+
+using namespace axoncache;
+
+namespace
+{
+constexpr uint32_t kEmbeddingHeaderFlags = Constants::HeaderFlag::kSlotMappingFastRange | Constants::HeaderFlag::kSlotMappingPow2Mask;
+
+auto checkEmbeddingHeaderFlags( uint32_t headerFlags ) -> void
+{
+    if ( ( headerFlags & ~kEmbeddingHeaderFlags ) != 0U )
+    {
+        throw std::runtime_error( "Only slot mapping header flags are supported by EMBEDDING caches" );
+    }
+}
+}
+
+EmbeddingCache::EmbeddingCache( uint16_t offsetBits, uint64_t numberOfKeySlots, double maxLoadFactor, std::unique_ptr<MemoryHandler> memoryHandler, uint32_t headerFlags ) :
+    EmbeddingCacheBase( offsetBits, numberOfKeySlots, maxLoadFactor, std::move( memoryHandler ), headerFlags )
+{
+    checkEmbeddingHeaderFlags( headerFlags );
+    // The keySpace allocated by the base class becomes the start of the entries, the matrix
+    // header and the padding before row 0 follow
+    const auto extraSize = rowsOffset( mProbe.numberOfKeySlots() ) - mProbe.keyspaceSize();
+    std::memset( mutableMemoryHandler()->grow( extraSize ), 0, extraSize );
+    updateKeySpacePtr();
+}
+
+EmbeddingCache::EmbeddingCache( const CacheHeader & header, std::unique_ptr<MemoryHandler> memoryHandler ) :
+    EmbeddingCacheBase( header, std::move( memoryHandler ) )
+{
+    checkEmbeddingHeaderFlags( header.flags );
+    const auto offset = rowsOffset( mProbe.numberOfKeySlots() );
+    if ( this->memoryHandler()->dataSize() < offset || this->memoryHandler()->dataSize() != offset + matrixHeader().numberOfRows * matrixHeader().rowStride * sizeof( float ) )
+    {
+        throw std::runtime_error( "EMBEDDING cache data size doesn't match its number of key slots and rows" );
+    }
+}
+
+auto EmbeddingCache::putInternal( std::string_view key, CacheValueType type, std::string_view value ) -> std::pair<bool, uint32_t>
+{
+    if ( type != CacheValueType::FloatList || value.empty() )
+    {
+        std::ostringstream oss;
+        oss << "EMBEDDING caches only store non empty FloatList values, key " << key << " has a " << to_string( type ) << " value";
+        AL_LOG_ERROR( oss.str() );
+
+        throw std::runtime_error( oss.str() );
+    }
+    const auto numberOfKeySlots = mProbe.numberOfKeySlots();
+    auto * header = reinterpret_cast<embedding::MatrixHeader *>( mKeySpacePtr + numberOfKeySlots * sizeof( embedding::Entry ) );
+    const auto valueDimension = value.size() / sizeof( float );
+    if ( header->dimension != 0U && valueDimension != header->dimension )
+    {
+        std::ostringstream oss;
+        oss << "EMBEDDING cache rows have " << header->dimension << " floats, key " << key << " has " << valueDimension;
+        AL_LOG_ERROR( oss.str() );
+
+        throw std::runtime_error( oss.str() );
+    }
+    if ( mHeader.numberOfEntries >= mMaxNumberOfEntries || header->numberOfRows >= std::numeric_limits<uint32_t>::max() )
+    {
+        std::ostringstream oss;
+        oss << "keySpace is full, numOfEntries=" << mHeader.numberOfEntries
+            << " numberOfKeySlots=" << numberOfKeySlots
+            << " maxLoadFactor=" << mHeader.maxLoadFactor;
+        AL_LOG_ERROR( oss.str() );
+
+        throw std::runtime_error( "keySpace is full" );
+    }
+
+    const auto hash = Xxh3Hasher::hash( key );
+    const auto tag = tagOf( hash );
+    const auto check = checkOf( key );
+    const auto * slotEntries = entries();
+
+    // The load factor keeps an empty slot, so the probe ends
+    uint32_t collisions = 0;
+    auto slotId = homeSlot( mProbe.slotMapping(), hash, numberOfKeySlots );
+    while ( slotEntries[slotId].tag != 0U )
+    {
+        if ( slotEntries[slotId].tag == tag && slotEntries[slotId].check == check )
+        {
+            return std::make_pair( false, collisions );
+        }
+        slotId = slotId + 1U == numberOfKeySlots ? 0U : slotId + 1U;
+        ++collisions;
+    }
+
+    if ( header->dimension == 0U )
+    {
+        constexpr auto kFloatsPerAlignment = embedding::kRowAlignment / sizeof( float );
+        header->dimension = static_cast<uint32_t>( valueDimension );
+        header->rowStride = static_cast<uint32_t>( ( valueDimension + kFloatsPerAlignment - 1U ) / kFloatsPerAlignment * kFloatsPerAlignment );
+    }
+    const auto rowBytes = static_cast<uint64_t>( header->rowStride ) * sizeof( float );
+    auto * row = mutableMemoryHandler()->grow( rowBytes );
+    std::memcpy( row, value.data(), value.size() );
+    std::memset( row + value.size(), 0, rowBytes - value.size() );
+    updateKeySpacePtr();
+
+    auto * entry = reinterpret_cast<embedding::Entry *>( mKeySpacePtr ) + slotId;
+    header = reinterpret_cast<embedding::MatrixHeader *>( mKeySpacePtr + numberOfKeySlots * sizeof( embedding::Entry ) );
+    entry->tag = tag;
+    entry->check = check;
+    entry->row = static_cast<uint32_t>( header->numberOfRows++ );
+    mHeader.maxCollisions = std::max( collisions, mHeader.maxCollisions );
+    ++mHeader.numberOfEntries;
+    return std::make_pair( true, collisions );
+}
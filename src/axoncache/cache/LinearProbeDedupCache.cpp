@@ -1,7 +1,10 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2025 AppLovin. All rights reserved.
 
+#include <algorithm>
+#include <functional>
 #include <sstream>
+#include <tuple>
 #include "axoncache/logger/Logger.h"
 #include "axoncache/cache/LinearProbeDedupCache.h"
 
@@ -44,6 +47,7 @@ auto LinearProbeDedupCache::output( std::ostream & output ) const -> void
 
 auto LinearProbeDedupCache::putInternal( std::string_view key, CacheValueType type, std::string_view value ) -> std::pair<bool, uint32_t>
 {
+    checkNoFilter();
     if ( this->mHeader.numberOfEntries >= this->mMaxNumberOfEntries ) // linear requires more empty slots for efficient get operations
     {
         std::ostringstream oss;
@@ -56,11 +60,17 @@ auto LinearProbeDedupCache::putInternal( std::string_view key, CacheValueType ty
     }
 
     uint32_t collisions = 0;
+    StoredKey storedKey;
     auto hashcode = Xxh3Hasher::hash( key );
-    auto keySlotOffset = this->mProbe.findFreeKeySlotOffset( key, hashcode, this->mKeySpacePtr, collisions );
+    const auto recordKey = this->toStoredKey( key, hashcode, storedKey );
+    auto keySlotOffset = this->mProbe.findFreeKeySlotOffset( recordKey, hashcode, this->mKeySpacePtr, collisions );
     if ( keySlotOffset != Constants::ProbeStatus::AXONCACHE_KEY_EXISTS )
     {
-        int index = -1;
+        if ( mSketch != nullptr )
+        {
+            mSketch->add( value );
+        }
+        int64_t index = -1;
         {
             const auto & iter = mValuesToIndex.find( value.size() );
             if ( iter != mValuesToIndex.end() )
@@ -74,11 +84,11 @@ auto LinearProbeDedupCache::putInternal( std::string_view key, CacheValueType ty
         }
         if ( index == -1 )
         {
-            collisions = std::max( collisions, this->mValueMgr.add( keySlotOffset, key, hashcode, static_cast<uint8_t>( type ), value, this->mutableMemoryHandler() ) );
+            collisions = std::max( collisions, this->mValueMgr.add( keySlotOffset, recordKey, hashcode, static_cast<uint8_t>( type ), value, this->mutableMemoryHandler() ) );
         }
         else
         {
-            collisions = std::max( collisions, this->mValueMgr.add( keySlotOffset, key, hashcode, static_cast<uint8_t>( type ), static_cast<uint32_t>( value.size() ), static_cast<uint16_t>( index ), this->mutableMemoryHandler() ) );
+            collisions = std::max( collisions, this->mValueMgr.add( keySlotOffset, recordKey, hashcode, static_cast<uint8_t>( type ), static_cast<uint32_t>( value.size() ), static_cast<uint32_t>( index ), this->mutableMemoryHandler() ) );
         }
         this->mHeader.maxCollisions = std::max( collisions, this->mHeader.maxCollisions );
         ++( this->mHeader.numberOfEntries );
@@ -93,7 +103,7 @@ auto LinearProbeDedupCache::putInternal( std::string_view key, CacheValueType ty
 auto LinearProbeDedupCache::frequentValuesOutput( const std::vector<std::string_view> & valuesInOrder, MallocMemoryHandler * handler, std::ostream & output ) const -> uint64_t
 {
     AL_LOG_INFO( "Write frequent value data" );
-    const auto topValueCount = static_cast<uint16_t>( valuesInOrder.size() );
+    const auto topValueCount = static_cast<uint32_t>( valuesInOrder.size() );
     uint64_t wroteSize = 0UL;
 
     if ( topValueCount == 0U )
@@ -104,8 +114,20 @@ auto LinearProbeDedupCache::frequentValuesOutput( const std::vector<std::string_
         return wroteSize;
     }
 
-    output.write( ( const char * )&topValueCount, sizeof( uint16_t ) );
-    wroteSize += sizeof( uint16_t );
+    // A count over 16 bits follows a 0 count, which was never written before the values
+    const auto countSize = topValueCount > 0xFFFFU ? sizeof( uint16_t ) + sizeof( uint32_t ) : sizeof( uint16_t );
+    if ( topValueCount > 0xFFFFU )
+    {
+        const uint16_t extended = 0U;
+        output.write( ( const char * )&extended, sizeof( uint16_t ) );
+        output.write( ( const char * )&topValueCount, sizeof( uint32_t ) );
+    }
+    else
+    {
+        const auto count = static_cast<uint16_t>( topValueCount );
+        output.write( ( const char * )&count, sizeof( uint16_t ) );
+    }
+    wroteSize += countSize;
     std::vector<uint32_t> topValuesLength;
     topValuesLength.resize( topValueCount );
     uint64_t checkSize = 0UL;
@@ -125,7 +147,7 @@ auto LinearProbeDedupCache::frequentValuesOutput( const std::vector<std::string_
         throw std::runtime_error( "frequent values total size doesn't match" );
     }
 
-    uint64_t valueOffset = sizeof( uint16_t ) + topValueCount * sizeof( uint32_t ) + handler->dataSize() + sizeof( uint64_t );
+    uint64_t valueOffset = countSize + topValueCount * sizeof( uint32_t ) + handler->dataSize() + sizeof( uint64_t );
     output.write( ( char * )&valueOffset, sizeof( uint64_t ) );
     wroteSize += sizeof( uint64_t );
     return wroteSize;
@@ -142,15 +164,19 @@ auto LinearProbeDedupCache::setFrequentValue() -> void
     }
 
     auto currentOffset = memoryHandler()->dataSize() - valueOffset;
-    const auto frequentValuesCount = *reinterpret_cast<const uint16_t *>( dataPtr + currentOffset );
-
+    uint32_t frequentValuesCount = *reinterpret_cast<const uint16_t *>( dataPtr + currentOffset );
     currentOffset += sizeof( uint16_t );
+    if ( frequentValuesCount == 0U )
+    {
+        std::memcpy( &frequentValuesCount, dataPtr + currentOffset, sizeof( uint32_t ) );
+        currentOffset += sizeof( uint32_t );
+    }
     mValues.reserve( frequentValuesCount );
     std::vector<uint32_t> freqValuesLength;
     freqValuesLength.resize( frequentValuesCount );
     std::memcpy( ( void * )freqValuesLength.data(), ( void * )( dataPtr + currentOffset ), frequentValuesCount * sizeof( uint32_t ) );
     currentOffset += frequentValuesCount * sizeof( uint32_t );
-    uint8_t index = 0U;
+    uint32_t index = 0U;
     for ( const auto & length : freqValuesLength )
     {
         mValues.emplace_back( ( const char * )( dataPtr + currentOffset ), length );
@@ -171,3 +197,92 @@ auto LinearProbeDedupCache::setFrequentValue() -> void
         throw std::runtime_error( "data size doesn't match" );
     }
 }
+
+auto LinearProbeDedupCache::detectFrequentValues( size_t maxValues ) -> void
+{
+    if ( maxValues > Constants::Limit::kFrequentValues )
+    {
+        throw std::runtime_error( "Should not detect more than " + std::to_string( Constants::Limit::kFrequentValues ) + " frequent values" );
+    }
+    if ( mIsValuesLoaded || mValuesMemoryHandler != nullptr )
+    {
+        throw std::runtime_error( "Values already set, can't detect them" );
+    }
+    if ( mHeader.numberOfEntries != 0U )
+    {
+        throw std::runtime_error( "Frequent values must be detected from the first put" );
+    }
+    // Extra candidates so the exact count can still tell apart the ones the sketch overestimated
+    mMaxFrequentValues = maxValues;
+    mSketch = maxValues == 0U ? nullptr : std::make_unique<FrequentValueSketch>( 4U * maxValues );
+}
+
+auto LinearProbeDedupCache::finalize() -> void
+{
+    if ( !mIsFinalized && mSketch != nullptr )
+    {
+        selectFrequentValues();
+    }
+    LinearProbeCache::finalize();
+}
+
+auto LinearProbeDedupCache::selectFrequentValues() -> void
+{
+    const auto candidates = mSketch->candidates();
+    mSketch.reset();
+
+    std::unordered_map<std::string_view, uint64_t> counts;
+    counts.reserve( candidates.size() );
+    for ( const auto & candidate : candidates )
+    {
+        counts.emplace( candidate, 0U );
+    }
+    mValueMgr.forEachPlainValue( mProbe.numberOfKeySlots(), memoryHandler(), [&counts]( std::string_view value )
+                                 {
+                                     const auto iter = counts.find( value );
+                                     if ( iter != counts.end() )
+                                     {
+                                         ++iter->second;
+                                     }
+                                 } );
+
+    // Each record saves its value but the index, the value is written once with its uint32_t
+    // length. With the largest index size, every value kept saves at least as much as counted.
+    const auto indexSize = static_cast<int64_t>( linear::frequentValueIndexSize( static_cast<uint32_t>( mMaxFrequentValues - 1U ) ) );
+    std::vector<std::tuple<int64_t, uint64_t, std::string_view>> selected;
+    for ( const auto & [value, count] : counts )
+    {
+        const auto size = static_cast<int64_t>( value.size() );
+        const auto savings = static_cast<int64_t>( count ) * ( size - indexSize ) - size - static_cast<int64_t>( sizeof( uint32_t ) );
+        if ( savings > 0 )
+        {
+            selected.emplace_back( savings, count, value );
+        }
+    }
+    std::sort( selected.begin(), selected.end(), std::greater<>() );
+    selected.resize( std::min( selected.size(), mMaxFrequentValues ) );
+
+    // The most counted values get the shortest indexes
+    std::sort( selected.begin(), selected.end(), []( const auto & left, const auto & right )
+               { return std::get<1>( left ) != std::get<1>( right ) ? std::get<1>( left ) > std::get<1>( right ) : std::get<2>( left ) < std::get<2>( right ); } );
+    std::vector<std::string> values;
+    values.reserve( selected.size() );
+    for ( const auto & entry : selected )
+    {
+        values.emplace_back( std::get<2>( entry ) );
+    }
+    setDuplicatedValues( values );
+
+    std::unordered_map<std::string_view, uint32_t> indexes;
+    indexes.reserve( mValues.size() );
+    for ( uint32_t index = 0U; index < mValues.size(); ++index )
+    {
+        indexes.emplace( mValues[index], index );
+    }
+    mValueMgr.dedupValues( mProbe.numberOfKeySlots(), mProbe.keyspaceSize(), indexes, mutableMemoryHandler() );
+    updateKeySpacePtr();
+
+    std::ostringstream oss;
+    oss << "Detected " << mValues.size() << " frequent values out of " << candidates.size() << " candidates";
+    AL_LOG_INFO( oss.str() );
+}
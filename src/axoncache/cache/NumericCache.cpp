@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include "axoncache/cache/NumericCache.h"
+#include <cstring>
+#include <sstream>
+#include "axoncache/logger/Logger.h"
+
+using namespace axoncache;
+
+namespace
+{
+constexpr uint32_t kNumericHeaderFlags = Constants::HeaderFlag::kSlotMappingFastRange | Constants::HeaderFlag::kSlotMappingPow2Mask;
+
+auto checkNumericHeaderFlags( uint32_t headerFlags ) -> void
+{
+    if ( ( headerFlags & ~kNumericHeaderFlags ) != 0U )
+    {
+        throw std::runtime_error( "Only slot mapping header flags are supported by NUMERIC caches" );
+    }
+}
+}
+
+NumericCache::NumericCache( uint16_t offsetBits, uint64_t numberOfKeySlots, double maxLoadFactor, std::unique_ptr<MemoryHandler> memoryHandler, uint32_t headerFlags ) :
+    NumericCacheBase( offsetBits, numberOfKeySlots, maxLoadFactor, std::move( memoryHandler ), headerFlags )
+{
+    checkNumericHeaderFlags( headerFlags );
+    // The keySpace allocated by the base class becomes the start of the entries
+    std::memset( mutableMemoryHandler()->grow( dataSize() ), 0, dataSize() );
+    updateKeySpacePtr();
+}
+
+NumericCache::NumericCache( const CacheHeader & header, std::unique_ptr<MemoryHandler> memoryHandler ) :
+    NumericCacheBase( header, std::move( memoryHandler ) )
+{
+    checkNumericHeaderFlags( header.flags );
+    if ( this->memoryHandler()->dataSize() != mProbe.keyspaceSize() + dataSize() )
+    {
+        throw std::runtime_error( "NUMERIC cache data size doesn't match its number of key slots" );
+    }
+}
+
+auto NumericCache::putInternal( std::string_view key, CacheValueType type, std::string_view value ) -> std::pair<bool, uint32_t>
+{
+    if ( type != CacheValueType::Bool && type != CacheValueType::Int64 && type != CacheValueType::Double )
+    {
+        std::ostringstream oss;
+        oss << "NUMERIC caches only store Int64, Double and Bool values, key " << key << " has a " << to_string( type ) << " value";
+        AL_LOG_ERROR( oss.str() );
+
+        throw std::runtime_error( oss.str() );
+    }
+    if ( mHeader.numberOfEntries >= mMaxNumberOfEntries )
+    {
+        std::ostringstream oss;
+        oss << "keySpace is full, numOfEntries=" << mHeader.numberOfEntries
+            << " numberOfKeySlots=" << numberOfKeySlots()
+            << " maxLoadFactor=" << mHeader.maxLoadFactor;
+        AL_LOG_ERROR( oss.str() );
+
+        throw std::runtime_error( "keySpace is full" );
+    }
+
+    const auto hash = Xxh3Hasher::hash( key );
+    const auto tag = tagOf( hash );
+    const auto fingerprint = ( KeyFingerprint::secondHash( key ) & ~numeric::kTypeMask ) | ( static_cast<uint64_t>( type ) - 1U );
+    const auto numberOfKeySlots = mProbe.numberOfKeySlots();
+    auto * slotEntries = reinterpret_cast<numeric::Entry *>( mKeySpacePtr );
+
+    // The load factor keeps an empty slot, so the probe ends
+    uint32_t collisions = 0;
+    auto slotId = homeSlot( mProbe.slotMapping(), hash, numberOfKeySlots );
+    while ( slotEntries[slotId].tag != 0U )
+    {
+        if ( slotEntries[slotId].tag == tag && ( slotEntries[slotId].fingerprint | numeric::kTypeMask ) == ( fingerprint | numeric::kTypeMask ) )
+        {
+            return std::make_pair( false, collisions );
+        }
+        slotId = slotId + 1U == numberOfKeySlots ? 0U : slotId + 1U;
+        ++collisions;
+    }
+
+    slotEntries[slotId].tag = tag;
+    slotEntries[slotId].fingerprint = fingerprint;
+    slotEntries[slotId].value = 0U;
+    std::memcpy( &slotEntries[slotId].value, value.data(), std::min( value.size(), sizeof( uint64_t ) ) );
+    mHeader.maxCollisions = std::max( collisions, mHeader.maxCollisions );
+    ++mHeader.numberOfEntries;
+    return std::make_pair( true, collisions );
+}
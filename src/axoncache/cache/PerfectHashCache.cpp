@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include "axoncache/cache/PerfectHashCache.h"
+#include <cstring>
+#include <vector>
+#include "axoncache/logger/Logger.h"
+
+using namespace axoncache;
+
+auto PerfectHashCache::finalize() -> void
+{
+    if ( mIsFinalized )
+    {
+        return;
+    }
+    mIsFinalized = true;
+
+    // Collect the staged slots before the new keySpace overwrites them
+    const auto stagingKeySpaceSize = mProbe.keyspaceSize();
+    const auto stagingRecordBase = mProbe.numberOfKeySlots() * sizeof( uint64_t ) - 8;
+    const auto * stagingSlots = reinterpret_cast<const uint64_t *>( mKeySpacePtr );
+    std::vector<uint64_t> slots;
+    std::vector<uint64_t> hashcodes;
+    slots.reserve( mHeader.numberOfEntries );
+    hashcodes.reserve( mHeader.numberOfEntries );
+    for ( uint64_t slotId = 0; slotId < mProbe.numberOfKeySlots(); ++slotId )
+    {
+        const auto slot = stagingSlots[slotId];
+        if ( ( slot & mProbe.offsetMask() ) != 0UL )
+        {
+            const auto * record = reinterpret_cast<const linear::LinearProbeRecord *>( mKeySpacePtr + ( slot & mProbe.offsetMask() ) + stagingRecordBase );
+            slots.push_back( slot );
+            hashcodes.push_back( Xxh3Hasher::hash( std::string_view{ record->data, record->keySize } ) );
+        }
+    }
+
+    const auto function = perfect::build( hashcodes );
+    PerfectHashProbe<sizeof( uint64_t )> probe( mProbe.offsetBits(), slots.size() );
+    const auto keySpaceSize = slots.size() * sizeof( uint64_t ) + probe.metadataSize();
+
+    // Records keep their order and move with the whole data space. A slot offset is relative to the
+    // end of the slots minus 8, so it shifts by the size of the metadata placed between slots and data.
+    const auto recordShift = probe.metadataSize();
+    for ( const auto slot : slots )
+    {
+        if ( ( slot & mProbe.offsetMask() ) + recordShift > mProbe.offsetMask() )
+        {
+            const auto message = "offset bits " + std::to_string( mProbe.offsetBits() ) + " too short for the perfect hash layout";
+            AL_LOG_ERROR( message );
+            throw std::runtime_error( message );
+        }
+    }
+
+    const auto dataSpaceSize = memoryHandler()->dataSize() - stagingKeySpaceSize;
+    if ( keySpaceSize > stagingKeySpaceSize )
+    {
+        mutableMemoryHandler()->grow( keySpaceSize - stagingKeySpaceSize );
+        updateKeySpacePtr();
+    }
+    std::memmove( mKeySpacePtr + keySpaceSize, mKeySpacePtr + stagingKeySpaceSize, dataSpaceSize );
+    mutableMemoryHandler()->truncate( keySpaceSize + dataSpaceSize );
+    std::memset( mKeySpacePtr, 0, keySpaceSize );
+
+    probe.writeFunction( function, mKeySpacePtr );
+    auto * newSlots = reinterpret_cast<uint64_t *>( mKeySpacePtr );
+    for ( size_t keyId = 0; keyId < slots.size(); ++keyId )
+    {
+        const auto slot = slots[keyId];
+        newSlots[probe.perfectSlotId( hashcodes[keyId], mKeySpacePtr )] = ( slot & mProbe.hashcodeMask() ) | ( ( slot & mProbe.offsetMask() ) + recordShift );
+    }
+
+    mValueMgr = LinearProbeValue( mProbe.offsetBits(), slots.size(), mProbe.hashcodeMask(), mProbe.offsetMask() );
+    mProbe = probe;
+    mMaxNumberOfEntries = slots.size();
+    mHeader.numberOfKeySlots = slots.size();
+    mHeader.maxCollisions = 0U;
+}
@@ -2,14 +2,19 @@
 // Copyright (c) 2025 AppLovin. All rights reserved.
 
 #include "axoncache/cache/base/HashedCacheBase.h"
+#include "axoncache/cache/hasher/WyHasher.h"
 #include "axoncache/cache/hasher/Xxh3Hasher.h"
 #include "axoncache/cache/probe/LinearProbe.h"
 #include "axoncache/cache/value/LinearProbeValue.h"
+#include "axoncache/cache/probe/CuckooProbe.h"
+#include "axoncache/cache/probe/PerfectHashProbe.h"
+#include "axoncache/cache/probe/SimdProbe.h"
 #include "axoncache/cache/probe/SimpleProbe.h"
 #include "axoncache/cache/value/ChainedValue.h"
 #include "axoncache/logger/Logger.h"
 #include "axoncache/common/StringUtils.h"
 #include "axoncache/common/StringViewUtils.h"
+#include "axoncache/transformer/FloatListQuantizer.h"
 #include <sstream>
 
 using namespace axoncache;
@@ -29,10 +34,60 @@ auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getString( std::s
     }
 }
 
+template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
+auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getString( std::string_view key, KeyHash hash, std::string_view defaultValue ) const -> std::pair<std::string_view, bool>
+{
+    bool isExist = false;
+    const auto str = getHashedInternal( key, hash.value, CacheValueType::String, &isExist );
+    if ( !isExist )
+    {
+        return std::make_pair( defaultValue, false );
+    }
+    return std::make_pair( StringViewToNullTerminatedString::trimExtraNullTerminator( str ), true );
+}
+
+template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
+auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getString( std::string_view key, std::string & buffer, std::string_view defaultValue ) const -> std::pair<std::string_view, bool>
+{
+    bool isExist = false;
+    const auto str = getInternal( key, CacheValueType::String, &isExist, nullptr, &buffer );
+    if ( !isExist )
+    {
+        return std::make_pair( defaultValue, false );
+    }
+    return std::make_pair( StringViewToNullTerminatedString::trimExtraNullTerminator( str ), true );
+}
+
+template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
+auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getString( std::string_view key, KeyHash hash, std::string & buffer, std::string_view defaultValue ) const -> std::pair<std::string_view, bool>
+{
+    bool isExist = false;
+    const auto str = getHashedInternal( key, hash.value, CacheValueType::String, &isExist, &buffer );
+    if ( !isExist )
+    {
+        return std::make_pair( defaultValue, false );
+    }
+    return std::make_pair( StringViewToNullTerminatedString::trimExtraNullTerminator( str ), true );
+}
+
 template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
 auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getBool( std::string_view key, bool defaultValue, uint64_t * foundHash ) const -> std::pair<bool, bool>
 {
-    const auto [str, type] = getWithType( key, foundHash );
+    std::string buffer;
+    return toBool( key, getWithType( key, buffer, foundHash ), defaultValue );
+}
+
+template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
+auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getBool( std::string_view key, KeyHash hash, bool defaultValue ) const -> std::pair<bool, bool>
+{
+    std::string buffer;
+    return toBool( key, getWithType( key, hash, buffer ), defaultValue );
+}
+
+template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
+auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::toBool( std::string_view key, std::pair<std::string_view, CacheValueType> valueAndType, bool defaultValue ) -> std::pair<bool, bool>
+{
+    const auto [str, type] = valueAndType;
     if ( str.empty() )
     {
         return std::make_pair( defaultValue, false );
@@ -65,7 +120,21 @@ auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getBool( std::str
 template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
 auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getInt64( std::string_view key, int64_t defaultValue, uint64_t * foundHash ) const -> std::pair<int64_t, bool>
 {
-    const auto [str, type] = getWithType( key, foundHash );
+    std::string buffer;
+    return toInt64( key, getWithType( key, buffer, foundHash ), defaultValue );
+}
+
+template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
+auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getInt64( std::string_view key, KeyHash hash, int64_t defaultValue ) const -> std::pair<int64_t, bool>
+{
+    std::string buffer;
+    return toInt64( key, getWithType( key, hash, buffer ), defaultValue );
+}
+
+template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
+auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::toInt64( std::string_view key, std::pair<std::string_view, CacheValueType> valueAndType, int64_t defaultValue ) -> std::pair<int64_t, bool>
+{
+    const auto [str, type] = valueAndType;
     if ( str.empty() )
     {
         return std::make_pair( defaultValue, false );
@@ -94,7 +163,21 @@ auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getInt64( std::st
 template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
 auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getDouble( std::string_view key, double defaultValue, uint64_t * foundHash ) const -> std::pair<double, bool>
 {
-    const auto [str, type] = getWithType( key, foundHash );
+    std::string buffer;
+    return toDouble( key, getWithType( key, buffer, foundHash ), defaultValue );
+}
+
+template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
+auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getDouble( std::string_view key, KeyHash hash, double defaultValue ) const -> std::pair<double, bool>
+{
+    std::string buffer;
+    return toDouble( key, getWithType( key, hash, buffer ), defaultValue );
+}
+
+template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
+auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::toDouble( std::string_view key, std::pair<std::string_view, CacheValueType> valueAndType, double defaultValue ) -> std::pair<double, bool>
+{
+    const auto [str, type] = valueAndType;
     if ( str.empty() )
     {
         return std::make_pair( defaultValue, false );
@@ -124,6 +207,7 @@ auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getDouble( std::s
 template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
 auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::putInternal( std::string_view key, CacheValueType type, std::string_view value ) -> std::pair<bool, uint32_t>
 {
+    checkNoFilter();
     if ( this->mHeader.numberOfEntries >= this->mMaxNumberOfEntries ) // linear requires more empty slots for efficient get operations
     {
         std::ostringstream oss;
@@ -136,15 +220,18 @@ auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::putInternal( std:
     }
 
     uint32_t collisions = 0;
+    StoredKey storedKey;
     auto hashcode = HashAlgo::hash( key );
-    auto keySlotOffset = this->mProbe.findFreeKeySlotOffset( key, hashcode, this->mKeySpacePtr, collisions );
+    const auto recordKey = this->toStoredKey( key, hashcode, storedKey );
+    auto keySlotOffset = this->mProbe.findFreeKeySlotOffset( recordKey, hashcode, this->mKeySpacePtr, collisions );
     if ( keySlotOffset != Constants::ProbeStatus::AXONCACHE_KEY_EXISTS )
     {
-        collisions = std::max( collisions, this->mValueMgr.add( keySlotOffset, key, hashcode, static_cast<uint8_t>( type ), value, this->mutableMemoryHandler() ) );
+        collisions = std::max( collisions, this->mValueMgr.add( keySlotOffset, recordKey, hashcode, static_cast<uint8_t>( type ), value, this->mutableMemoryHandler() ) );
         this->mHeader.maxCollisions = std::max( collisions, this->mHeader.maxCollisions );
         ++( this->mHeader.numberOfEntries );
         // Data ptr could have changed, so update the pointer
         this->updateKeySpacePtr();
+        this->mProbe.commitKeySlot( keySlotOffset, hashcode, this->mKeySpacePtr );
         return std::make_pair( true, collisions );
     }
 
@@ -153,7 +240,21 @@ auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::putInternal( std:
 template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
 auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getFloatVector( std::string_view key, uint64_t * foundHash ) const -> std::vector<float>
 {
-    const auto [value, type] = getWithTypeInternal( key, foundHash );
+    std::string buffer;
+    return toFloatVector( key, getWithTypeInternal( key, foundHash, &buffer ) );
+}
+
+template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
+auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getFloatVector( std::string_view key, KeyHash hash ) const -> std::vector<float>
+{
+    std::string buffer;
+    return toFloatVector( key, getWithTypeHashedInternal( key, hash.value, &buffer ) );
+}
+
+template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
+auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::toFloatVector( std::string_view key, std::pair<std::string_view, CacheValueType> valueAndType ) -> std::vector<float>
+{
+    const auto [value, type] = valueAndType;
     if ( !value.empty() )
     {
         switch ( type )
@@ -162,6 +263,10 @@ auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getFloatVector( s
                 return axoncache::stringViewToVector<float>( value, ':', value.size() );
             case CacheValueType::FloatList:
                 return transform<std::vector<float>>( value );
+            case CacheValueType::Float16List:
+            case CacheValueType::BFloat16List:
+            case CacheValueType::Int8List:
+                return FloatListQuantizer::dequantize( value, type );
             default:
             {
                 std::ostringstream oss;
@@ -178,7 +283,21 @@ auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getFloatVector( s
 template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
 auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getFloatSpan( std::string_view key, uint64_t * foundHash ) const -> std::span<const float>
 {
-    const auto [value, type] = getWithTypeInternal( key, foundHash );
+    std::string buffer;
+    return toFloatSpan( key, getWithTypeInternal( key, foundHash, &buffer ) );
+}
+
+template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
+auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getFloatSpan( std::string_view key, KeyHash hash ) const -> std::span<const float>
+{
+    std::string buffer;
+    return toFloatSpan( key, getWithTypeHashedInternal( key, hash.value, &buffer ) );
+}
+
+template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
+auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::toFloatSpan( std::string_view key, std::pair<std::string_view, CacheValueType> valueAndType ) -> std::span<const float>
+{
+    const auto [value, type] = valueAndType;
     if ( !value.empty() )
     {
         switch ( type )
@@ -187,6 +306,10 @@ auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getFloatSpan( std
                 throw std::runtime_error( "Cache value type is string, please use getFloatVector instead to explicitly convert it to a float vector" );
             case CacheValueType::FloatList:
                 return transform<std::span<const float>>( value );
+            case CacheValueType::Float16List:
+            case CacheValueType::BFloat16List:
+            case CacheValueType::Int8List:
+                throw std::runtime_error( "Cache value type is " + to_string( type ) + ", please use getFloatVector instead to dequantize it to a float vector" );
             default:
             {
                 std::ostringstream oss;
@@ -269,7 +392,8 @@ template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTy
 auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getFloatAtIndices( std::string_view key, const std::vector<int32_t> & indices, uint64_t * foundHash ) const -> std::vector<float>
 {
     std::vector<float> result( indices.size(), 0.f );
-    const auto [value, type] = getWithTypeInternal( key, foundHash );
+    std::string buffer;
+    const auto [value, type] = getWithTypeInternal( key, foundHash, &buffer );
     if ( !value.empty() )
     {
         switch ( type )
@@ -298,6 +422,20 @@ auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getFloatAtIndices
                 }
                 return result;
             }
+            case CacheValueType::Float16List:
+            case CacheValueType::BFloat16List:
+            case CacheValueType::Int8List:
+            {
+                const auto size = FloatListQuantizer::size( value, type );
+                for ( size_t at = 0U; at < indices.size(); at++ )
+                {
+                    if ( 0 <= indices[at] && static_cast<size_t>( indices[at] ) < size )
+                    {
+                        result[at] = FloatListQuantizer::at( value, type, indices[at] );
+                    }
+                }
+                return result;
+            }
             default:
             {
                 std::ostringstream oss;
@@ -317,7 +455,8 @@ auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getFloatAtIndices
 template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
 auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getFloatAtIndex( std::string_view key, int32_t index, uint64_t * foundHash ) const -> float
 {
-    const auto [value, type] = getWithTypeInternal( key, foundHash );
+    std::string buffer;
+    const auto [value, type] = getWithTypeInternal( key, foundHash, &buffer );
     if ( !value.empty() )
     {
         switch ( type )
@@ -332,6 +471,10 @@ auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getFloatAtIndex(
                 size_t offset = index * sizeof( float );
                 return ( 0 <= index && offset < value.size() ) ? *( float * )( value.data() + offset ) : 0.f;
             }
+            case CacheValueType::Float16List:
+            case CacheValueType::BFloat16List:
+            case CacheValueType::Int8List:
+                return ( 0 <= index && static_cast<size_t>( index ) < FloatListQuantizer::size( value, type ) ) ? FloatListQuantizer::at( value, type, index ) : 0.f;
             default:
             {
                 std::ostringstream oss;
@@ -350,7 +493,8 @@ auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getFloatAtIndex(
 template<typename HashAlgo, typename Probe, typename ValueMgr, CacheType CacheTypeVal>
 auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getKeyType( std::string_view key, uint64_t * foundHash ) const -> std::string
 {
-    const auto [value, type] = getWithTypeInternal( key, foundHash );
+    std::string buffer;
+    const auto [value, type] = getWithTypeInternal( key, foundHash, &buffer );
     if ( value.empty() )
     {
         return {};
@@ -373,6 +517,8 @@ auto HashedCacheBase<HashAlgo, Probe, ValueMgr, CacheTypeVal>::getKeyType( std::
 // that way we can keep out StringUtils from the header class
 template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
     getString( std::string_view, std::string_view, uint64_t * ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getString( std::string_view, std::string &, std::string_view ) const -> std::pair<std::string_view, bool>;
 template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
     getBool( std::string_view, bool, uint64_t * ) const -> std::pair<bool, bool>;
 template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
@@ -383,6 +529,20 @@ template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::Linea
     getFloatVector( std::string_view key, uint64_t * ) const -> std::vector<float>;
 template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
     getFloatSpan( std::string_view key, uint64_t * ) const -> std::span<const float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getString( std::string_view, KeyHash, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getString( std::string_view, KeyHash, std::string &, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getBool( std::string_view, KeyHash, bool ) const -> std::pair<bool, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getInt64( std::string_view, KeyHash, int64_t ) const -> std::pair<int64_t, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getDouble( std::string_view, KeyHash, double ) const -> std::pair<double, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getFloatVector( std::string_view, KeyHash ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getFloatSpan( std::string_view, KeyHash ) const -> std::span<const float>;
 template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
     readKey( std::string_view key, uint64_t * ) -> std::string_view;
 template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
@@ -396,6 +556,12 @@ template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::Linea
 
 template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimpleProbe<8u>, axoncache::ChainedValue, ( axoncache::CacheType )2>::
     getString( std::string_view, std::string_view, uint64_t * ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimpleProbe<8u>, axoncache::ChainedValue, ( axoncache::CacheType )2>::
+    getString( std::string_view, std::string &, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimpleProbe<8u>, axoncache::ChainedValue, ( axoncache::CacheType )2>::
+    getString( std::string_view, KeyHash, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimpleProbe<8u>, axoncache::ChainedValue, ( axoncache::CacheType )2>::
+    getString( std::string_view, KeyHash, std::string &, std::string_view ) const -> std::pair<std::string_view, bool>;
 template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimpleProbe<8u>, axoncache::ChainedValue, ( axoncache::CacheType )3>::
     getBool( std::string_view, bool, uint64_t * ) const -> std::pair<bool, bool>;
 template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimpleProbe<8u>, axoncache::ChainedValue, ( axoncache::CacheType )3>::
@@ -406,6 +572,20 @@ template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::Simpl
     getFloatVector( std::string_view key, uint64_t * ) const -> std::vector<float>;
 template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimpleProbe<8u>, axoncache::ChainedValue, ( axoncache::CacheType )3>::
     getFloatSpan( std::string_view key, uint64_t * ) const -> std::span<const float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimpleProbe<8u>, axoncache::ChainedValue, ( axoncache::CacheType )3>::
+    getString( std::string_view, KeyHash, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimpleProbe<8u>, axoncache::ChainedValue, ( axoncache::CacheType )3>::
+    getString( std::string_view, KeyHash, std::string &, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimpleProbe<8u>, axoncache::ChainedValue, ( axoncache::CacheType )3>::
+    getBool( std::string_view, KeyHash, bool ) const -> std::pair<bool, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimpleProbe<8u>, axoncache::ChainedValue, ( axoncache::CacheType )3>::
+    getInt64( std::string_view, KeyHash, int64_t ) const -> std::pair<int64_t, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimpleProbe<8u>, axoncache::ChainedValue, ( axoncache::CacheType )3>::
+    getDouble( std::string_view, KeyHash, double ) const -> std::pair<double, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimpleProbe<8u>, axoncache::ChainedValue, ( axoncache::CacheType )3>::
+    getFloatVector( std::string_view, KeyHash ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimpleProbe<8u>, axoncache::ChainedValue, ( axoncache::CacheType )3>::
+    getFloatSpan( std::string_view, KeyHash ) const -> std::span<const float>;
 template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimpleProbe<8u>, axoncache::ChainedValue, ( axoncache::CacheType )3>::
     readKey( std::string_view key, uint64_t * ) -> std::string_view;
 template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimpleProbe<8u>, axoncache::ChainedValue, ( axoncache::CacheType )3>::
@@ -423,3 +603,246 @@ template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::Simpl
     putInternal( std::string_view key, CacheValueType type, std::string_view value ) -> std::pair<bool, uint32_t>;
 template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimpleProbe<8u>, axoncache::ChainedValue, ( axoncache::CacheType )2>::
     putInternal( std::string_view key, CacheValueType type, std::string_view value ) -> std::pair<bool, uint32_t>;
+
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    getString( std::string_view, std::string_view, uint64_t * ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    getString( std::string_view, std::string &, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    getBool( std::string_view, bool, uint64_t * ) const -> std::pair<bool, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    getInt64( std::string_view, int64_t, uint64_t * ) const -> std::pair<int64_t, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    getDouble( std::string_view, double, uint64_t * ) const -> std::pair<double, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    getFloatVector( std::string_view key, uint64_t * ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    getFloatSpan( std::string_view key, uint64_t * ) const -> std::span<const float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    getString( std::string_view, KeyHash, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    getString( std::string_view, KeyHash, std::string &, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    getBool( std::string_view, KeyHash, bool ) const -> std::pair<bool, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    getInt64( std::string_view, KeyHash, int64_t ) const -> std::pair<int64_t, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    getDouble( std::string_view, KeyHash, double ) const -> std::pair<double, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    getFloatVector( std::string_view, KeyHash ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    getFloatSpan( std::string_view, KeyHash ) const -> std::span<const float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    readKey( std::string_view key, uint64_t * ) -> std::string_view;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    readKeys( std::string_view key, uint64_t * ) -> std::vector<std::string_view>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    getFloatAtIndices( std::string_view key, const std::vector<int32_t> & indices, uint64_t * ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    getFloatAtIndex( std::string_view key, int32_t index, uint64_t * ) const -> float;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    getKeyType( std::string_view key, uint64_t * ) const -> std::string;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::SimdProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::LINEAR_PROBE_SIMD>::
+    putInternal( std::string_view key, CacheValueType type, std::string_view value ) -> std::pair<bool, uint32_t>;
+
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    getString( std::string_view, std::string_view, uint64_t * ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    getString( std::string_view, std::string &, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    getBool( std::string_view, bool, uint64_t * ) const -> std::pair<bool, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    getInt64( std::string_view, int64_t, uint64_t * ) const -> std::pair<int64_t, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    getDouble( std::string_view, double, uint64_t * ) const -> std::pair<double, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    getFloatVector( std::string_view key, uint64_t * ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    getFloatSpan( std::string_view key, uint64_t * ) const -> std::span<const float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    getString( std::string_view, KeyHash, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    getString( std::string_view, KeyHash, std::string &, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    getBool( std::string_view, KeyHash, bool ) const -> std::pair<bool, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    getInt64( std::string_view, KeyHash, int64_t ) const -> std::pair<int64_t, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    getDouble( std::string_view, KeyHash, double ) const -> std::pair<double, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    getFloatVector( std::string_view, KeyHash ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    getFloatSpan( std::string_view, KeyHash ) const -> std::span<const float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    readKey( std::string_view key, uint64_t * ) -> std::string_view;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    readKeys( std::string_view key, uint64_t * ) -> std::vector<std::string_view>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    getFloatAtIndices( std::string_view key, const std::vector<int32_t> & indices, uint64_t * ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    getFloatAtIndex( std::string_view key, int32_t index, uint64_t * ) const -> float;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    getKeyType( std::string_view key, uint64_t * ) const -> std::string;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::PerfectHashProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::PERFECT_HASH>::
+    putInternal( std::string_view key, CacheValueType type, std::string_view value ) -> std::pair<bool, uint32_t>;
+
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    getString( std::string_view, std::string_view, uint64_t * ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    getString( std::string_view, std::string &, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    getBool( std::string_view, bool, uint64_t * ) const -> std::pair<bool, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    getInt64( std::string_view, int64_t, uint64_t * ) const -> std::pair<int64_t, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    getDouble( std::string_view, double, uint64_t * ) const -> std::pair<double, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    getFloatVector( std::string_view key, uint64_t * ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    getFloatSpan( std::string_view key, uint64_t * ) const -> std::span<const float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    getString( std::string_view, KeyHash, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    getString( std::string_view, KeyHash, std::string &, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    getBool( std::string_view, KeyHash, bool ) const -> std::pair<bool, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    getInt64( std::string_view, KeyHash, int64_t ) const -> std::pair<int64_t, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    getDouble( std::string_view, KeyHash, double ) const -> std::pair<double, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    getFloatVector( std::string_view, KeyHash ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    getFloatSpan( std::string_view, KeyHash ) const -> std::span<const float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    readKey( std::string_view key, uint64_t * ) -> std::string_view;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    readKeys( std::string_view key, uint64_t * ) -> std::vector<std::string_view>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    getFloatAtIndices( std::string_view key, const std::vector<int32_t> & indices, uint64_t * ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    getFloatAtIndex( std::string_view key, int32_t index, uint64_t * ) const -> float;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    getKeyType( std::string_view key, uint64_t * ) const -> std::string;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::CuckooProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::CUCKOO>::
+    putInternal( std::string_view key, CacheValueType type, std::string_view value ) -> std::pair<bool, uint32_t>;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getString( std::string_view, std::string_view, uint64_t * ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getString( std::string_view, std::string &, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getBool( std::string_view, bool, uint64_t * ) const -> std::pair<bool, bool>;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getInt64( std::string_view, int64_t, uint64_t * ) const -> std::pair<int64_t, bool>;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getDouble( std::string_view, double, uint64_t * ) const -> std::pair<double, bool>;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getFloatVector( std::string_view key, uint64_t * ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getFloatSpan( std::string_view key, uint64_t * ) const -> std::span<const float>;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getString( std::string_view, KeyHash, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getString( std::string_view, KeyHash, std::string &, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getBool( std::string_view, KeyHash, bool ) const -> std::pair<bool, bool>;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getInt64( std::string_view, KeyHash, int64_t ) const -> std::pair<int64_t, bool>;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getDouble( std::string_view, KeyHash, double ) const -> std::pair<double, bool>;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getFloatVector( std::string_view, KeyHash ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getFloatSpan( std::string_view, KeyHash ) const -> std::span<const float>;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    readKey( std::string_view key, uint64_t * ) -> std::string_view;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    readKeys( std::string_view key, uint64_t * ) -> std::vector<std::string_view>;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getFloatAtIndices( std::string_view key, const std::vector<int32_t> & indices, uint64_t * ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getFloatAtIndex( std::string_view key, int32_t index, uint64_t * ) const -> float;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    getKeyType( std::string_view key, uint64_t * ) const -> std::string;
+template auto axoncache::HashedCacheBase<axoncache::WyHasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, ( axoncache::CacheType )3>::
+    putInternal( std::string_view key, CacheValueType type, std::string_view value ) -> std::pair<bool, uint32_t>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    getString( std::string_view, std::string_view, uint64_t * ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    getString( std::string_view, std::string &, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    getBool( std::string_view, bool, uint64_t * ) const -> std::pair<bool, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    getInt64( std::string_view, int64_t, uint64_t * ) const -> std::pair<int64_t, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    getDouble( std::string_view, double, uint64_t * ) const -> std::pair<double, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    getFloatVector( std::string_view key, uint64_t * ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    getFloatSpan( std::string_view key, uint64_t * ) const -> std::span<const float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    getString( std::string_view, KeyHash, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    getString( std::string_view, KeyHash, std::string &, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    getBool( std::string_view, KeyHash, bool ) const -> std::pair<bool, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    getInt64( std::string_view, KeyHash, int64_t ) const -> std::pair<int64_t, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    getDouble( std::string_view, KeyHash, double ) const -> std::pair<double, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    getFloatVector( std::string_view, KeyHash ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    getFloatSpan( std::string_view, KeyHash ) const -> std::span<const float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    readKey( std::string_view key, uint64_t * ) -> std::string_view;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    readKeys( std::string_view key, uint64_t * ) -> std::vector<std::string_view>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    getFloatAtIndices( std::string_view key, const std::vector<int32_t> & indices, uint64_t * ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    getFloatAtIndex( std::string_view key, int32_t index, uint64_t * ) const -> float;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    getKeyType( std::string_view key, uint64_t * ) const -> std::string;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::NUMERIC>::
+    putInternal( std::string_view key, CacheValueType type, std::string_view value ) -> std::pair<bool, uint32_t>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    getString( std::string_view, std::string_view, uint64_t * ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    getString( std::string_view, std::string &, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    getBool( std::string_view, bool, uint64_t * ) const -> std::pair<bool, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    getInt64( std::string_view, int64_t, uint64_t * ) const -> std::pair<int64_t, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    getDouble( std::string_view, double, uint64_t * ) const -> std::pair<double, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    getFloatVector( std::string_view key, uint64_t * ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    getFloatSpan( std::string_view key, uint64_t * ) const -> std::span<const float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    getString( std::string_view, KeyHash, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    getString( std::string_view, KeyHash, std::string &, std::string_view ) const -> std::pair<std::string_view, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    getBool( std::string_view, KeyHash, bool ) const -> std::pair<bool, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    getInt64( std::string_view, KeyHash, int64_t ) const -> std::pair<int64_t, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    getDouble( std::string_view, KeyHash, double ) const -> std::pair<double, bool>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    getFloatVector( std::string_view, KeyHash ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    getFloatSpan( std::string_view, KeyHash ) const -> std::span<const float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    readKey( std::string_view key, uint64_t * ) -> std::string_view;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    readKeys( std::string_view key, uint64_t * ) -> std::vector<std::string_view>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    getFloatAtIndices( std::string_view key, const std::vector<int32_t> & indices, uint64_t * ) const -> std::vector<float>;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    getFloatAtIndex( std::string_view key, int32_t index, uint64_t * ) const -> float;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    getKeyType( std::string_view key, uint64_t * ) const -> std::string;
+template auto axoncache::HashedCacheBase<axoncache::Xxh3Hasher, axoncache::LinearProbe<8u>, axoncache::LinearProbeValue, axoncache::CacheType::EMBEDDING>::
+    putInternal( std::string_view key, CacheValueType type, std::string_view value ) -> std::pair<bool, uint32_t>;
@@ -3,11 +3,18 @@
 
 #include "axoncache/cache/factory/CacheFactory.h"
 #include <stdexcept>
+#include <string>
+#include "axoncache/Constants.h"
 #include "axoncache/cache/BucketChainCache.h"
 #include "axoncache/cache/CacheType.h"
+#include "axoncache/cache/CuckooCache.h"
+#include "axoncache/cache/EmbeddingCache.h"
 #include "axoncache/cache/LinearProbeCache.h"
 #include "axoncache/cache/LinearProbeDedupCache.h"
+#include "axoncache/cache/LinearProbeSimdCache.h"
 #include "axoncache/cache/MapCache.h"
+#include "axoncache/cache/NumericCache.h"
+#include "axoncache/cache/PerfectHashCache.h"
 #include "axoncache/memory/MallocMemoryHandler.h"
 namespace axoncache
 {
@@ -16,20 +23,43 @@ class CacheBase;
 
 using namespace axoncache;
 
-auto CacheFactory::createCache( uint16_t offsetBits, uint64_t numberOfKeySlots, double maxLoadFactor, CacheType type ) -> std::unique_ptr<CacheBase>
+auto CacheFactory::createCache( uint16_t offsetBits, uint64_t numberOfKeySlots, double maxLoadFactor, CacheType type, uint32_t headerFlags, uint16_t hashFuncId ) -> std::unique_ptr<CacheBase>
 {
+    if ( hashFuncId == Constants::HashFuncId::WYHASH && type == CacheType::LINEAR_PROBE )
+    {
+        return std::make_unique<LinearProbeWyhashCache>( offsetBits, numberOfKeySlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>(), headerFlags );
+    }
+    if ( hashFuncId != Constants::HashFuncId::XXH3 )
+    {
+        throw std::runtime_error( "CacheFactory::createCache: hashFuncId " + std::to_string( hashFuncId ) + " is not supported by " + to_string( type ) );
+    }
+
     switch ( type )
     {
         case CacheType::MAP:
+            if ( headerFlags != 0U )
+            {
+                throw std::runtime_error( "CacheFactory::createCache: CacheType::MAP does not support header flags" );
+            }
             return std::make_unique<MapCache>( std::make_unique<MallocMemoryHandler>() );
         case CacheType::BUCKET_CHAIN:
-            return std::make_unique<BucketChainCache>( offsetBits, numberOfKeySlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>() );
+            return std::make_unique<BucketChainCache>( offsetBits, numberOfKeySlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>(), headerFlags );
         case CacheType::LINEAR_PROBE:
-            return std::make_unique<LinearProbeCache>( offsetBits, numberOfKeySlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>() );
+            return std::make_unique<LinearProbeCache>( offsetBits, numberOfKeySlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>(), headerFlags );
         case CacheType::LINEAR_PROBE_DEDUP:
-            return std::make_unique<LinearProbeDedupCache>( offsetBits, numberOfKeySlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>(), CacheType::LINEAR_PROBE_DEDUP );
+            return std::make_unique<LinearProbeDedupCache>( offsetBits, numberOfKeySlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>(), CacheType::LINEAR_PROBE_DEDUP, headerFlags );
         case CacheType::LINEAR_PROBE_DEDUP_TYPED:
-            return std::make_unique<LinearProbeDedupCache>( offsetBits, numberOfKeySlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>(), CacheType::LINEAR_PROBE_DEDUP_TYPED );
+            return std::make_unique<LinearProbeDedupCache>( offsetBits, numberOfKeySlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>(), CacheType::LINEAR_PROBE_DEDUP_TYPED, headerFlags );
+        case CacheType::LINEAR_PROBE_SIMD:
+            return std::make_unique<LinearProbeSimdCache>( offsetBits, numberOfKeySlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>(), headerFlags );
+        case CacheType::PERFECT_HASH:
+            return std::make_unique<PerfectHashCache>( offsetBits, numberOfKeySlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>(), headerFlags );
+        case CacheType::CUCKOO:
+            return std::make_unique<CuckooCache>( offsetBits, numberOfKeySlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>(), headerFlags );
+        case CacheType::NUMERIC:
+            return std::make_unique<NumericCache>( offsetBits, numberOfKeySlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>(), headerFlags );
+        case CacheType::EMBEDDING:
+            return std::make_unique<EmbeddingCache>( offsetBits, numberOfKeySlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>(), headerFlags );
         case CacheType::NONE:
             throw std::runtime_error( "CacheFactory::createCache: CacheType::None is not a valid CacheType" );
     }
@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include "axoncache/cache/key/KeyFingerprint.h"
+#include <axoncache/common/xxh3.h>
+
+using namespace axoncache;
+
+namespace
+{
+// Any seed works as long as it never changes, it is part of the file format
+constexpr uint64_t kSecondHashSeed = 0x9E3779B97F4A7C15ULL;
+}
+
+auto KeyFingerprint::secondHash( std::string_view key ) -> uint64_t
+{
+    return XXH3_64bits_withSeed( key.data(), key.size(), kSecondHashSeed );
+}
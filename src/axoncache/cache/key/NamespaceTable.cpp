@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include "axoncache/cache/key/NamespaceTable.h"
+#include <stdexcept>
+#include "axoncache/logger/Logger.h"
+
+using namespace axoncache;
+
+namespace
+{
+constexpr uint64_t kSectionHeaderSize = sizeof( uint64_t ) + 2 * sizeof( uint32_t );
+
+auto roundUpTo8( uint64_t size ) -> uint64_t
+{
+    return ( size + 7U ) & ~uint64_t{ 7U };
+}
+}
+
+auto NamespaceTable::addStoredKey( std::string_view key, StoredKey & storedKey ) -> void
+{
+    const auto separator = key.find( kSeparator );
+    if ( separator == std::string_view::npos )
+    {
+        assign( kNoNamespace, key, storedKey );
+        return;
+    }
+
+    const auto name = key.substr( 0, separator );
+    auto iter = mIds.find( name );
+    if ( iter == mIds.end() )
+    {
+        if ( mNamespaces.size() == kMaxNamespaces )
+        {
+            const auto message = "too many namespaces, max=" + std::to_string( kMaxNamespaces );
+            AL_LOG_ERROR( message );
+            throw std::runtime_error( message );
+        }
+        const std::string_view owned = mOwned.emplace_back( name );
+        mNamespaces.push_back( owned );
+        iter = mIds.emplace( owned, static_cast<uint16_t>( mNamespaces.size() ) ).first;
+    }
+    assign( iter->second, key.substr( separator + 1 ), storedKey );
+}
+
+auto NamespaceTable::toKey( std::string_view storedKey ) const -> std::string
+{
+    uint16_t id = kNoNamespace;
+    std::memcpy( &id, storedKey.data(), kIdSize );
+    const auto suffix = storedKey.substr( kIdSize );
+    if ( id == kNoNamespace )
+    {
+        return std::string{ suffix };
+    }
+
+    const auto name = mNamespaces.at( id - 1U );
+    std::string key;
+    key.reserve( name.size() + 1U + suffix.size() );
+    key.append( name ).append( 1U, kSeparator ).append( suffix );
+    return key;
+}
+
+auto NamespaceTable::serializedSize() const -> uint64_t
+{
+    uint64_t size = kSectionHeaderSize + mNamespaces.size() * sizeof( uint16_t );
+    for ( const auto name : mNamespaces )
+    {
+        size += name.size();
+    }
+    return roundUpTo8( size );
+}
+
+auto NamespaceTable::write( uint8_t * data ) -> void
+{
+    mSize = serializedSize();
+    const auto count = static_cast<uint32_t>( mNamespaces.size() );
+    std::memset( data, 0, mSize );
+    std::memcpy( data, &mSize, sizeof( uint64_t ) );
+    std::memcpy( data + sizeof( uint64_t ), &count, sizeof( uint32_t ) );
+
+    auto * lengths = data + kSectionHeaderSize;
+    auto * bytes = lengths + count * sizeof( uint16_t );
+    for ( const auto name : mNamespaces )
+    {
+        const auto length = static_cast<uint16_t>( name.size() );
+        std::memcpy( lengths, &length, sizeof( uint16_t ) );
+        lengths += sizeof( uint16_t );
+        std::memcpy( bytes, name.data(), name.size() );
+        bytes += name.size();
+    }
+}
+
+auto NamespaceTable::load( const uint8_t * data ) -> void
+{
+    uint32_t count = 0U;
+    std::memcpy( &mSize, data, sizeof( uint64_t ) );
+    std::memcpy( &count, data + sizeof( uint64_t ), sizeof( uint32_t ) );
+
+    mIsEnabled = true;
+    mNamespaces.clear();
+    mIds.clear();
+    mNamespaces.reserve( count );
+    const auto * lengths = data + kSectionHeaderSize;
+    const auto * bytes = reinterpret_cast<const char *>( lengths + count * sizeof( uint16_t ) );
+    for ( uint32_t index = 0; index < count; ++index )
+    {
+        uint16_t length = 0U;
+        std::memcpy( &length, lengths + index * sizeof( uint16_t ), sizeof( uint16_t ) );
+        mNamespaces.emplace_back( bytes, length );
+        mIds.emplace( mNamespaces.back(), static_cast<uint16_t>( index + 1U ) );
+        bytes += length;
+    }
+
+    if ( roundUpTo8( static_cast<uint64_t>( reinterpret_cast<const uint8_t *>( bytes ) - data ) ) != mSize )
+    {
+        throw std::runtime_error( "namespace table size doesn't match" );
+    }
+}
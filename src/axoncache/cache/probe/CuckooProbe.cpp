@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include "axoncache/cache/probe/CuckooProbe.h"
+#include <unordered_set>
+#include <vector>
+
+using namespace axoncache;
+
+namespace
+{
+// Enough for load factors up to 0.95 with 8-slot buckets, paths are rarely longer than a few moves
+constexpr size_t kMaxSearchedBuckets = 4096;
+
+struct Node
+{
+    uint64_t bucket;
+    int64_t parent;      // index in the search queue, -1 for the key's own buckets
+    uint64_t parentSlot; // id of the parent bucket slot that moves into this bucket
+};
+
+auto emptySlotId( const cuckoo::Layout & layout, uint64_t offsetMask, const uint64_t * slots, uint64_t bucket ) -> int64_t
+{
+    for ( auto slotId = layout.firstSlotId( bucket ); slotId < layout.firstSlotId( bucket ) + cuckoo::kSlotsPerBucket; ++slotId )
+    {
+        if ( ( slots[slotId] & offsetMask ) == 0UL )
+        {
+            return static_cast<int64_t>( slotId );
+        }
+    }
+    return -1;
+}
+}
+
+auto cuckoo::makeRoom( const Layout & layout, uint64_t offsetMask, uint64_t * slots, uint64_t firstBucket, uint64_t secondBucket ) -> int64_t
+{
+    // Every bucket is searched at most once, so the buckets of a path are all different and
+    // moving its slots from the end back to the start never overwrites a slot still to move
+    std::vector<Node> queue{ { firstBucket, -1, 0U } };
+    std::unordered_set<uint64_t> isQueued{ firstBucket };
+    if ( isQueued.insert( secondBucket ).second )
+    {
+        queue.push_back( { secondBucket, -1, 0U } );
+    }
+
+    for ( size_t head = 0; head < queue.size(); ++head )
+    {
+        const auto bucket = queue[head].bucket;
+        for ( auto slotId = layout.firstSlotId( bucket ); slotId < layout.firstSlotId( bucket ) + kSlotsPerBucket; ++slotId )
+        {
+            const auto otherBucket = layout.otherBucket( slots[slotId], bucket );
+            const auto freeSlotId = emptySlotId( layout, offsetMask, slots, otherBucket );
+            if ( freeSlotId >= 0 )
+            {
+                slots[freeSlotId] = slots[slotId];
+                auto freedSlotId = slotId;
+                for ( auto node = static_cast<int64_t>( head ); queue[node].parent >= 0; node = queue[node].parent )
+                {
+                    slots[freedSlotId] = slots[queue[node].parentSlot];
+                    freedSlotId = queue[node].parentSlot;
+                }
+                slots[freedSlotId] = 0UL;
+                return static_cast<int64_t>( freedSlotId );
+            }
+            if ( queue.size() < kMaxSearchedBuckets && isQueued.insert( otherBucket ).second )
+            {
+                queue.push_back( { otherBucket, static_cast<int64_t>( head ), slotId } );
+            }
+        }
+    }
+    return -1;
+}
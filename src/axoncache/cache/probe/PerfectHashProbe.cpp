@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include "axoncache/cache/probe/PerfectHashProbe.h"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <string>
+#include "axoncache/logger/Logger.h"
+
+using namespace axoncache;
+
+namespace
+{
+constexpr uint32_t kMaxSeedAttempts = 32;
+constexpr uint32_t kMaxPilot = 0xFFFF;
+
+// Try every pilot of every bucket, largest buckets first while the table is still empty.
+// Return false if a bucket runs out of pilots so the caller can retry with another seed.
+auto searchPilots( std::span<const uint64_t> hashcodes, const perfect::Layout & layout, uint64_t seed, std::vector<uint16_t> & pilots, std::vector<uint8_t> & taken ) -> bool
+{
+    std::vector<uint64_t> bucketOfKey( hashcodes.size() );
+    std::vector<uint64_t> bucketStart( layout.numberOfBuckets + 1, 0UL );
+    for ( size_t keyId = 0; keyId < hashcodes.size(); ++keyId )
+    {
+        bucketOfKey[keyId] = perfect::bucketOf( hashcodes[keyId], seed, layout.numberOfBuckets );
+        ++bucketStart[bucketOfKey[keyId] + 1];
+    }
+    std::partial_sum( bucketStart.begin(), bucketStart.end(), bucketStart.begin() );
+
+    // Keys grouped by bucket
+    std::vector<uint64_t> keysByBucket( hashcodes.size() );
+    auto fill = bucketStart;
+    for ( size_t keyId = 0; keyId < hashcodes.size(); ++keyId )
+    {
+        keysByBucket[fill[bucketOfKey[keyId]]++] = hashcodes[keyId];
+    }
+
+    std::vector<uint64_t> bucketOrder( layout.numberOfBuckets );
+    std::iota( bucketOrder.begin(), bucketOrder.end(), 0UL );
+    std::stable_sort( bucketOrder.begin(), bucketOrder.end(), [&]( uint64_t lhs, uint64_t rhs )
+                      { return bucketStart[lhs + 1] - bucketStart[lhs] > bucketStart[rhs + 1] - bucketStart[rhs]; } );
+
+    pilots.assign( layout.numberOfBuckets, 0U );
+    taken.assign( layout.tableSize, 0U );
+    std::vector<uint64_t> positions;
+    for ( const auto bucket : bucketOrder )
+    {
+        const auto begin = bucketStart[bucket];
+        const auto end = bucketStart[bucket + 1];
+        if ( begin == end )
+        {
+            break; // sorted by size, the remaining buckets are empty too
+        }
+
+        bool isPlaced = false;
+        for ( uint32_t pilot = 0; pilot <= kMaxPilot && !isPlaced; ++pilot )
+        {
+            positions.clear();
+            isPlaced = true;
+            for ( auto keyId = begin; keyId < end; ++keyId )
+            {
+                const auto position = perfect::positionOf( keysByBucket[keyId], seed, static_cast<uint16_t>( pilot ), layout.tableSize );
+                if ( taken[position] != 0U || std::find( positions.begin(), positions.end(), position ) != positions.end() )
+                {
+                    isPlaced = false;
+                    break;
+                }
+                positions.push_back( position );
+            }
+
+            if ( isPlaced )
+            {
+                pilots[bucket] = static_cast<uint16_t>( pilot );
+                for ( const auto position : positions )
+                {
+                    taken[position] = 1U;
+                }
+            }
+        }
+
+        if ( !isPlaced )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+}
+
+auto perfect::build( std::span<const uint64_t> hashcodes ) -> Function
+{
+    if ( hashcodes.size() > std::numeric_limits<uint32_t>::max() )
+    {
+        throw std::runtime_error( "perfect hash supports at most " + std::to_string( std::numeric_limits<uint32_t>::max() ) + " keys" );
+    }
+
+    std::vector<uint64_t> sorted( hashcodes.begin(), hashcodes.end() );
+    std::sort( sorted.begin(), sorted.end() );
+    if ( std::adjacent_find( sorted.begin(), sorted.end() ) != sorted.end() )
+    {
+        AL_LOG_ERROR( "two keys have the same 64-bit hashcode" );
+        throw std::runtime_error( "perfect hash can't separate keys with the same hashcode" );
+    }
+
+    const auto layout = layoutFor( hashcodes.size() );
+    Function function{ 0UL, {}, {} };
+    std::vector<uint8_t> taken;
+    for ( uint32_t attempt = 0; attempt < kMaxSeedAttempts; ++attempt )
+    {
+        function.seed = mix( 0x9E3779B97F4A7C15ULL * ( attempt + 1U ) );
+        if ( !searchPilots( hashcodes, layout, function.seed, function.pilots, taken ) )
+        {
+            continue;
+        }
+
+        // As many positions past the key count are taken as positions below it are free, pair them up
+        function.remap.assign( layout.tableSize - layout.numberOfKeys, 0U );
+        uint64_t freePosition = 0;
+        for ( auto position = layout.numberOfKeys; position < layout.tableSize; ++position )
+        {
+            if ( taken[position] != 0U )
+            {
+                while ( taken[freePosition] != 0U )
+                {
+                    ++freePosition;
+                }
+                function.remap[position - layout.numberOfKeys] = static_cast<uint32_t>( freePosition++ );
+            }
+        }
+        return function;
+    }
+
+    throw std::runtime_error( "failed to build a perfect hash for " + std::to_string( hashcodes.size() ) + " keys" );
+}
@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include "axoncache/cache/probe/SimdProbe.h"
+#include <array>
+#include <cstring>
+#include "axoncache/Constants.h"
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+#include <immintrin.h>
+#define AXONCACHE_SIMD_X86 1
+#elif defined( __aarch64__ )
+#include <arm_neon.h>
+#define AXONCACHE_SIMD_NEON 1
+#endif
+
+using namespace axoncache;
+
+namespace
+{
+struct GroupMatch
+{
+    uint32_t match; // bit i set when tag i equals the searched tag
+    uint32_t empty; // bit i set when slot i is empty
+};
+
+struct ScalarGroup
+{
+    static constexpr uint64_t kWidth = 8;
+
+    static auto match( const uint8_t * tags, uint8_t tag ) -> GroupMatch
+    {
+        GroupMatch result{ 0U, 0U };
+        for ( uint32_t i = 0; i < kWidth; ++i )
+        {
+            result.match |= static_cast<uint32_t>( tags[i] == tag ) << i;
+            result.empty |= static_cast<uint32_t>( tags[i] == simd::kEmptyTag ) << i;
+        }
+        return result;
+    }
+};
+
+#ifdef AXONCACHE_SIMD_X86
+struct Sse2Group
+{
+    static constexpr uint64_t kWidth = 16;
+
+    static auto match( const uint8_t * tags, uint8_t tag ) -> GroupMatch
+    {
+        const auto group = _mm_loadu_si128( reinterpret_cast<const __m128i *>( tags ) );
+        return { static_cast<uint32_t>( _mm_movemask_epi8( _mm_cmpeq_epi8( group, _mm_set1_epi8( static_cast<char>( tag ) ) ) ) ),
+                 static_cast<uint32_t>( _mm_movemask_epi8( _mm_cmpeq_epi8( group, _mm_setzero_si128() ) ) ) };
+    }
+};
+
+struct Avx2Group
+{
+    static constexpr uint64_t kWidth = 32;
+
+    __attribute__( ( target( "avx2" ) ) ) static auto match( const uint8_t * tags, uint8_t tag ) -> GroupMatch
+    {
+        const auto group = _mm256_loadu_si256( reinterpret_cast<const __m256i *>( tags ) );
+        return { static_cast<uint32_t>( _mm256_movemask_epi8( _mm256_cmpeq_epi8( group, _mm256_set1_epi8( static_cast<char>( tag ) ) ) ) ),
+                 static_cast<uint32_t>( _mm256_movemask_epi8( _mm256_cmpeq_epi8( group, _mm256_setzero_si256() ) ) ) };
+    }
+};
+#endif
+
+#ifdef AXONCACHE_SIMD_NEON
+struct NeonGroup
+{
+    static constexpr uint64_t kWidth = 16;
+
+    // NEON has no movemask; narrow each 0x00/0xFF byte to a nibble and keep one bit per nibble
+    static auto toMask( uint8x16_t cmp ) -> uint32_t
+    {
+        const auto nibbles = vget_lane_u64( vreinterpret_u64_u8( vshrn_n_u16( vreinterpretq_u16_u8( cmp ), 4 ) ), 0 );
+        auto bits = nibbles & 0x1111111111111111ULL;
+        uint32_t mask = 0;
+        while ( bits != 0 )
+        {
+            mask |= 1U << ( __builtin_ctzll( bits ) >> 2 );
+            bits &= bits - 1;
+        }
+        return mask;
+    }
+
+    static auto match( const uint8_t * tags, uint8_t tag ) -> GroupMatch
+    {
+        const auto group = vld1q_u8( tags );
+        return { toMask( vceqq_u8( group, vdupq_n_u8( tag ) ) ), toMask( vceqq_u8( group, vdupq_n_u8( simd::kEmptyTag ) ) ) };
+    }
+};
+#endif
+
+template<typename Group, SlotMapping Mapping>
+inline auto findKeySlot( const simd::ProbeLayout & layout, std::string_view key, uint64_t hashcode, const uint8_t * keySpacePtr, uint64_t * foundSlot ) -> int64_t
+{
+    const auto tag = simd::tagOf( hashcode );
+    const auto cmpHashcode = ( hashcode & layout.hashcodeMask );
+    const auto * slots = reinterpret_cast<const uint64_t *>( keySpacePtr );
+    const auto * tags = keySpacePtr + layout.tagsOffset;
+    auto groupStart = homeSlot<Mapping>( hashcode, layout.numberOfKeySlots );
+
+    for ( uint64_t displacement = 0;; displacement += Group::kWidth )
+    {
+        auto [match, empty] = Group::match( tags + groupStart, tag );
+
+        // Treat the slots past the bound of a Robin Hood layout as empty, and stop after the
+        // group that holds the bound even when all of its slots are in use
+        const auto remaining = layout.maxDisplacement - displacement;
+        const auto isLastGroup = remaining <= Group::kWidth - 1;
+        if ( isLastGroup )
+        {
+            const auto inBound = static_cast<uint32_t>( ( uint64_t{ 2 } << remaining ) - 1U );
+            match &= inBound;
+            empty |= ~inBound;
+        }
+
+        // Keys are never deleted, so the probe sequence of a key has no holes: only
+        // tags before the first empty slot can belong to it
+        if ( empty != 0U )
+        {
+            match &= ( empty & -empty ) - 1U;
+        }
+
+        while ( match != 0U )
+        {
+            auto slotId = groupStart + static_cast<uint64_t>( __builtin_ctz( match ) );
+            while ( slotId >= layout.numberOfKeySlots )
+            {
+                slotId -= layout.numberOfKeySlots;
+            }
+
+            const auto slot = slots[slotId];
+            if ( ( slot & layout.hashcodeMask ) == cmpHashcode )
+            {
+                const auto * record = reinterpret_cast<const linear::LinearProbeRecord *>( keySpacePtr + ( slot & layout.offsetMask ) + layout.keyspaceSizeOffset );
+                if ( record->keySize == key.size() && std::memcmp( ( const void * )record->data, key.data(), key.size() ) == 0 )
+                {
+                    if ( foundSlot != nullptr )
+                    {
+                        *foundSlot = slot;
+                    }
+                    return static_cast<int64_t>( slotId * sizeof( uint64_t ) );
+                }
+            }
+            match &= match - 1U;
+        }
+
+        if ( empty != 0U || isLastGroup )
+        {
+            return Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND;
+        }
+
+        groupStart += Group::kWidth;
+        while ( groupStart >= layout.numberOfKeySlots )
+        {
+            groupStart -= layout.numberOfKeySlots;
+        }
+    }
+}
+
+template<SlotMapping Mapping>
+auto findKeySlotScalar( const simd::ProbeLayout & layout, std::string_view key, uint64_t hashcode, const uint8_t * keySpacePtr, uint64_t * foundSlot ) -> int64_t
+{
+    return findKeySlot<ScalarGroup, Mapping>( layout, key, hashcode, keySpacePtr, foundSlot );
+}
+
+#ifdef AXONCACHE_SIMD_X86
+template<SlotMapping Mapping>
+auto findKeySlotSse2( const simd::ProbeLayout & layout, std::string_view key, uint64_t hashcode, const uint8_t * keySpacePtr, uint64_t * foundSlot ) -> int64_t
+{
+    return findKeySlot<Sse2Group, Mapping>( layout, key, hashcode, keySpacePtr, foundSlot );
+}
+
+// flatten pulls the avx2 group compare into this avx2-enabled body
+template<SlotMapping Mapping>
+__attribute__( ( target( "avx2" ), flatten ) ) auto findKeySlotAvx2( const simd::ProbeLayout & layout, std::string_view key, uint64_t hashcode, const uint8_t * keySpacePtr, uint64_t * foundSlot ) -> int64_t
+{
+    return findKeySlot<Avx2Group, Mapping>( layout, key, hashcode, keySpacePtr, foundSlot );
+}
+#endif
+
+#ifdef AXONCACHE_SIMD_NEON
+template<SlotMapping Mapping>
+auto findKeySlotNeon( const simd::ProbeLayout & layout, std::string_view key, uint64_t hashcode, const uint8_t * keySpacePtr, uint64_t * foundSlot ) -> int64_t
+{
+    return findKeySlot<NeonGroup, Mapping>( layout, key, hashcode, keySpacePtr, foundSlot );
+}
+#endif
+
+struct IsaSelection
+{
+    std::array<simd::FindKeySlotFunc, 3> funcs; // indexed by SlotMapping
+    std::string_view name;
+};
+
+auto selectIsa() -> IsaSelection
+{
+#if defined( AXONCACHE_SIMD_X86 )
+    if ( __builtin_cpu_supports( "avx2" ) )
+    {
+        return { { findKeySlotAvx2<SlotMapping::MODULO>, findKeySlotAvx2<SlotMapping::FAST_RANGE>, findKeySlotAvx2<SlotMapping::POW2_MASK> }, "avx2" };
+    }
+    if ( __builtin_cpu_supports( "sse2" ) )
+    {
+        return { { findKeySlotSse2<SlotMapping::MODULO>, findKeySlotSse2<SlotMapping::FAST_RANGE>, findKeySlotSse2<SlotMapping::POW2_MASK> }, "sse2" };
+    }
+#elif defined( AXONCACHE_SIMD_NEON )
+    return { { findKeySlotNeon<SlotMapping::MODULO>, findKeySlotNeon<SlotMapping::FAST_RANGE>, findKeySlotNeon<SlotMapping::POW2_MASK> }, "neon" };
+#endif
+    return { { findKeySlotScalar<SlotMapping::MODULO>, findKeySlotScalar<SlotMapping::FAST_RANGE>, findKeySlotScalar<SlotMapping::POW2_MASK> }, "scalar" };
+}
+
+auto isaSelection() -> const IsaSelection &
+{
+    static const IsaSelection selection = selectIsa();
+    return selection;
+}
+}
+
+auto simd::findKeySlotFunc( SlotMapping slotMapping ) -> FindKeySlotFunc
+{
+    return isaSelection().funcs[static_cast<size_t>( slotMapping )];
+}
+
+auto simd::isaName() -> std::string_view
+{
+    return isaSelection().name;
+}
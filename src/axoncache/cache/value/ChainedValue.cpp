@@ -49,7 +49,7 @@ auto ChainedValue::add( int64_t keySpaceOffset, std::string_view key, [[maybe_un
     return collisions;
 }
 
-auto ChainedValue::get( const uint8_t * dataSpace, int64_t keySpaceOffset, std::string_view key, [[maybe_unused]] uint8_t type, bool * isExist ) const -> std::string_view
+auto ChainedValue::get( const uint8_t * dataSpace, int64_t keySpaceOffset, std::string_view key, [[maybe_unused]] uint8_t type, bool * isExist, [[maybe_unused]] std::string * buffer ) const -> std::string_view
 {
     *isExist = false;
 #ifdef DEBUG
@@ -104,7 +104,7 @@ auto ChainedValue::get( const uint8_t * dataSpace, int64_t keySpaceOffset, std::
     return get( dataSpace, keySpaceOffset, key, type, &isExist );
 }
 
-auto ChainedValue::getWithType( const uint8_t * /* dataSpace */, int64_t /* keySpaceOffset */, [[maybe_unused]] const std::vector<std::string_view> & /* frequentValues */ ) const -> std::pair<std::string_view, CacheValueType>
+auto ChainedValue::getWithType( const uint8_t * /* dataSpace */, int64_t /* keySpaceOffset */, [[maybe_unused]] const std::vector<std::string_view> & /* frequentValues */, [[maybe_unused]] std::string * /* buffer */ ) const -> std::pair<std::string_view, CacheValueType>
 {
     return {};
 }
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include "axoncache/cache/value/FrequentValueSketch.h"
+
+using namespace axoncache;
+
+auto FrequentValueSketch::add( std::string_view value ) -> void
+{
+    if ( value.size() < kMinValueSize || mCapacity == 0U )
+    {
+        return;
+    }
+    const auto [iter, isNew] = mWeights.try_emplace( std::string{ value }, mDroppedWeight );
+    iter->second += value.size();
+    if ( isNew && mWeights.size() >= 2U * mCapacity )
+    {
+        evict();
+    }
+}
+
+auto FrequentValueSketch::evict() -> void
+{
+    std::vector<uint64_t> weights;
+    weights.reserve( mWeights.size() );
+    for ( const auto & [value, weight] : mWeights )
+    {
+        weights.push_back( weight );
+    }
+    // Drop everything lighter than the capacity-th heaviest, ties included, so at least half goes
+    std::nth_element( weights.begin(), weights.begin() + static_cast<std::ptrdiff_t>( mCapacity - 1U ), weights.end(), std::greater<>() );
+    const auto threshold = weights[mCapacity - 1U];
+    for ( auto iter = mWeights.begin(); iter != mWeights.end(); )
+    {
+        if ( iter->second <= threshold )
+        {
+            mDroppedWeight = std::max( mDroppedWeight, iter->second );
+            iter = mWeights.erase( iter );
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+}
+
+auto FrequentValueSketch::candidates() const -> std::vector<std::string>
+{
+    std::vector<std::pair<uint64_t, const std::string *>> weighted;
+    weighted.reserve( mWeights.size() );
+    for ( const auto & [value, weight] : mWeights )
+    {
+        weighted.emplace_back( weight, &value );
+    }
+    std::sort( weighted.begin(), weighted.end(), []( const auto & left, const auto & right )
+               { return left.first != right.first ? left.first > right.first : *left.second < *right.second; } );
+    weighted.resize( std::min( weighted.size(), mCapacity ) );
+
+    std::vector<std::string> values;
+    values.reserve( weighted.size() );
+    for ( const auto & [weight, value] : weighted )
+    {
+        values.push_back( *value );
+    }
+    return values;
+}
@@ -3,16 +3,51 @@
 
 #include "axoncache/logger/Logger.h"
 #include "axoncache/cache/value/LinearProbeValue.h"
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
 #include <string_view>
 #include <sstream>
+#include <vector>
 #include "axoncache/Constants.h"
+#include "axoncache/cache/hasher/Xxh3Hasher.h"
 #include "axoncache/cache/probe/LinearProbe.h"
+#include "axoncache/domain/CacheHeader.h"
 #include "axoncache/memory/MemoryHandler.h"
 
 using namespace axoncache;
 
+namespace
+{
+// Copies the record at oldOffset to the end of records, a shared value one with the old offset of
+// the record with its value instead of the distance, see LinearProbeValue::fixSharedValues
+auto appendMovedRecord( std::vector<uint8_t> & records, const uint8_t * dataSpace, uint64_t oldOffset ) -> bool
+{
+    const auto * record = reinterpret_cast<const linear::LinearProbeRecord *>( dataSpace + oldOffset );
+    const auto * bytes = dataSpace + oldOffset;
+    const auto size = LinearProbeValue::recordSize( record );
+    records.insert( records.end(), bytes, bytes + size );
+    if ( !linear::isSharedValue( record ) )
+    {
+        return false;
+    }
+    const auto ownerOffset = static_cast<int64_t>( oldOffset ) + linear::sharedValueDistance( record );
+    std::memcpy( records.data() + records.size() - sizeof( int64_t ), &ownerOffset, sizeof( int64_t ) );
+    return true;
+}
+
+// Replaces the records after a keySpace of keyspaceSize bytes, padding can make them grow
+auto replaceRecords( uint64_t keyspaceSize, const std::vector<uint8_t> & records, MemoryHandler * memory ) -> void
+{
+    if ( keyspaceSize + records.size() > memory->dataSize() )
+    {
+        memory->grow( keyspaceSize + records.size() - memory->dataSize() );
+    }
+    std::memcpy( memory->data() + keyspaceSize, records.data(), records.size() );
+    memory->truncate( keyspaceSize + records.size() );
+}
+}
+
 auto LinearProbeValue::calculateSize( std::string_view key, std::string_view value ) -> uint64_t
 {
     return sizeof( linear::LinearProbeRecord ) + key.size() + value.size();
@@ -20,8 +55,28 @@ auto LinearProbeValue::calculateSize( std::string_view key, std::string_view val
 
 auto LinearProbeValue::add( int64_t keySpaceOffset, std::string_view key, uint64_t hashcode, uint8_t type, std::string_view value, MemoryHandler * memory ) -> uint32_t
 {
-    // Add new value to end of dataspace
-    auto newValueOffset = addToEnd( key, type, value, memory ) - mKeyspaceSizeOffset;
+    // Add new value to end of dataspace, or only the key when an earlier record has the value.
+    // Values no longer than the distance to that record are written again.
+    uint64_t recordOffset = 0U;
+    if ( mIsSharingValues && value.size() > sizeof( int64_t ) )
+    {
+        const auto valueHash = Xxh3Hasher::hash( value );
+        const auto ownerOffset = findSharedValue( value, valueHash, memory );
+        if ( ownerOffset != 0U )
+        {
+            recordOffset = addSharedToEnd( key, type, value.size(), ownerOffset, memory );
+        }
+        else
+        {
+            recordOffset = addToEnd( key, type, value, memory );
+            mSharedValues.emplace( valueHash, recordOffset );
+        }
+    }
+    else
+    {
+        recordOffset = addToEnd( key, type, value, memory );
+    }
+    auto newValueOffset = recordOffset - mKeyspaceSizeOffset;
     auto slotOffset = ( newValueOffset & mOffsetMask );
 
     if ( slotOffset != newValueOffset )
@@ -38,7 +93,7 @@ auto LinearProbeValue::add( int64_t keySpaceOffset, std::string_view key, uint64
     return 0;
 }
 
-auto LinearProbeValue::get( const uint8_t * dataSpace, int64_t keySpaceOffset, [[maybe_unused]] std::string_view key, uint8_t type, [[maybe_unused]] bool * isExist ) const -> std::string_view
+auto LinearProbeValue::get( const uint8_t * dataSpace, int64_t keySpaceOffset, [[maybe_unused]] std::string_view key, uint8_t type, [[maybe_unused]] bool * isExist, std::string * buffer ) const -> std::string_view
 {
     if ( keySpaceOffset == Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND )
     {
@@ -50,16 +105,20 @@ auto LinearProbeValue::get( const uint8_t * dataSpace, int64_t keySpaceOffset, [
     const auto * record = reinterpret_cast<const linear::LinearProbeRecord *>( dataSpace + static_cast<uint64_t>( slotOffset ) );
     const auto * dataPtr = reinterpret_cast<const char *>( dataSpace + static_cast<uint64_t>( slotOffset ) + sizeof( const linear::LinearProbeRecord ) );
 
-    if ( static_cast<uint8_t>( record->type ) != type )
+    if ( linear::valueType( record ) != type )
     {
         std::ostringstream oss;
         oss << "Type mismatch for key " << record->data
             << " expected " << type
-            << " type in cache was " << record->type;
+            << " type in cache was " << linear::valueType( record );
         AL_LOG_ERROR( oss.str() );
         return {};
     }
 
+    if ( record->dedupIndex & linear::kCompressedFlag )
+    {
+        return linear::isSharedValue( record ) ? linear::sharedValue( record ) : decompress( record, buffer );
+    }
     return { dataPtr + record->keySize, record->valSize };
 }
 
@@ -79,11 +138,21 @@ auto LinearProbeValue::typeMismatch( const linear::LinearProbeRecord * record, u
     std::ostringstream oss;
     oss << "Type mismatch for key " << record->data
         << " expected " << expectedType
-        << " type in cache was " << record->type;
+        << " type in cache was " << linear::valueType( record );
     return {};
 }
 
-auto LinearProbeValue::getWithType( const uint8_t * dataSpace, int64_t keySpaceOffset, [[maybe_unused]] const std::vector<std::string_view> & frequentValues ) const -> std::pair<std::string_view, CacheValueType>
+auto LinearProbeValue::decompress( const linear::LinearProbeRecord * record, std::string * buffer ) const -> std::string_view
+{
+    if ( buffer == nullptr )
+    {
+        thread_local std::string threadBuffer;
+        buffer = &threadBuffer;
+    }
+    return mDictionary.decompress( { record->data + record->keySize, record->valSize }, *buffer );
+}
+
+auto LinearProbeValue::getWithType( const uint8_t * dataSpace, int64_t keySpaceOffset, [[maybe_unused]] const std::vector<std::string_view> & frequentValues, std::string * buffer ) const -> std::pair<std::string_view, CacheValueType>
 {
     if ( keySpaceOffset == Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND )
     {
@@ -91,24 +160,24 @@ auto LinearProbeValue::getWithType( const uint8_t * dataSpace, int64_t keySpaceO
     }
 
     const auto slot = *( reinterpret_cast<const uint64_t *>( dataSpace + keySpaceOffset ) );
-    return getWithTypeFromSlot( dataSpace, slot, frequentValues );
+    return getWithTypeFromSlot( dataSpace, slot, frequentValues, buffer );
 }
 
-auto LinearProbeValue::getWithTypeFromSlot( const uint8_t * dataSpace, uint64_t slot, const std::vector<std::string_view> & frequentValues ) const -> std::pair<std::string_view, CacheValueType>
+auto LinearProbeValue::getWithTypeFromSlot( const uint8_t * dataSpace, uint64_t slot, const std::vector<std::string_view> & frequentValues, std::string * buffer ) const -> std::pair<std::string_view, CacheValueType>
 {
     uint64_t slotOffset = ( slot & mOffsetMask ) + mKeyspaceSizeOffset;
     const auto * record = reinterpret_cast<const linear::LinearProbeRecord *>( dataSpace + static_cast<uint64_t>( slotOffset ) );
     const auto * dataPtr = reinterpret_cast<const char *>( dataSpace + static_cast<uint64_t>( slotOffset ) + sizeof( const linear::LinearProbeRecord ) );
 
-    if ( ( record->dedupIndex & linear::kDedupFlag ) && !frequentValues.empty() )
+    if ( record->dedupIndex & linear::kCompressedFlag )
     {
-        return std::make_pair( frequentValues[*( uint8_t * )( dataPtr + record->keySize )], static_cast<CacheValueType>( record->type ) );
+        return std::make_pair( linear::isSharedValue( record ) ? linear::sharedValue( record ) : decompress( record, buffer ), static_cast<CacheValueType>( linear::valueType( record ) ) );
     }
-    else if ( ( record->dedupIndex & linear::kDedupExtendedFlag ) && !frequentValues.empty() )
+    else if ( ( record->dedupIndex & linear::kDedupVarintFlags ) && !frequentValues.empty() )
     {
-        return std::make_pair( frequentValues[*( uint16_t * )( dataPtr + record->keySize )], static_cast<CacheValueType>( record->type ) );
+        return std::make_pair( frequentValues[linear::frequentValueIndex( record )], static_cast<CacheValueType>( linear::valueType( record ) ) );
     }
-    return std::make_pair( std::string_view{ dataPtr + record->keySize, record->valSize }, static_cast<CacheValueType>( record->type ) );
+    return std::make_pair( std::string_view{ dataPtr + record->keySize, record->valSize }, static_cast<CacheValueType>( linear::valueType( record ) ) );
 }
 
 auto LinearProbeValue::contains( [[maybe_unused]] const uint8_t * dataSpace, int64_t keySpaceOffset, [[maybe_unused]] std::string_view key ) const -> bool
@@ -138,27 +207,38 @@ auto LinearProbeValue::addToEnd( std::string_view key, uint8_t type, std::string
         throw std::runtime_error( "value size " + std::to_string( value.size() ) + " too large. max=" + std::to_string( Constants::Limit::kValueLength ) );
     }
 
+    linear::LinearProbeRecord header{};
+    header.keySize = key.size();
+    header.dedupIndex = linear::recordTypeBits( type );
+    header.type = linear::recordType( type );
+    header.valSize = value.size();
+    const auto padding = recordPadding( memory->dataSize(), header );
+
     auto newSize = calculateSize( key, value );
-    auto * valueSpace = memory->grow( newSize );
-    auto * record = reinterpret_cast<linear::LinearProbeRecord *>( valueSpace );
+    auto * valueSpace = memory->grow( padding + newSize );
+    std::memset( valueSpace, 0, padding );
+    valueSpace += padding;
     auto * dataPtr = valueSpace + sizeof( const linear::LinearProbeRecord );
 
-    record->keySize = key.size();
-    record->dedupIndex = 0;
-    record->type = type;
-    record->valSize = value.size();
+    std::memcpy( valueSpace, &header, sizeof( header ) );
     std::memcpy( dataPtr, key.data(), key.size() );
     std::memcpy( dataPtr + key.size(), value.data(), value.size() );
 
     return valueSpace - memory->data();
 }
 
-auto LinearProbeValue::calculateSize( std::string_view key, uint16_t index ) -> uint64_t
+auto LinearProbeValue::findSharedValue( std::string_view value, uint64_t valueHash, const MemoryHandler * memory ) const -> uint64_t
 {
-    return sizeof( linear::LinearProbeRecord ) + key.size() + ( index < 256U ? 1U : 2U );
+    const auto iter = mSharedValues.find( valueHash );
+    if ( iter == mSharedValues.end() )
+    {
+        return 0U;
+    }
+    const auto * owner = reinterpret_cast<const linear::LinearProbeRecord *>( memory->data() + iter->second );
+    return std::string_view{ owner->data + owner->keySize, owner->valSize } == value ? iter->second : 0U;
 }
 
-auto LinearProbeValue::addToEnd( std::string_view key, uint8_t type, uint32_t valueSize, uint16_t index, MemoryHandler * memory ) -> uint64_t
+auto LinearProbeValue::addSharedToEnd( std::string_view key, uint8_t type, uint32_t valueSize, uint64_t ownerOffset, MemoryHandler * memory ) -> uint64_t
 {
     if ( key.size() > Constants::Limit::kKeyLength )
     {
@@ -170,30 +250,53 @@ auto LinearProbeValue::addToEnd( std::string_view key, uint8_t type, uint32_t va
         throw std::runtime_error( "key size " + std::to_string( key.size() ) + " too large. max=" + std::to_string( Constants::Limit::kKeyLength ) );
     }
 
-    auto newSize = calculateSize( key, index );
-    auto * valueSpace = memory->grow( newSize );
+    auto * valueSpace = memory->grow( sizeof( linear::LinearProbeRecord ) + key.size() + sizeof( int64_t ) );
     auto * record = reinterpret_cast<linear::LinearProbeRecord *>( valueSpace );
     auto * dataPtr = valueSpace + sizeof( const linear::LinearProbeRecord );
 
+    const auto recordOffset = static_cast<uint64_t>( valueSpace - memory->data() );
+    const auto distance = static_cast<int64_t>( ownerOffset ) - static_cast<int64_t>( recordOffset );
     record->keySize = key.size();
-    record->type = type;
-    record->dedupIndex = linear::kDedupFlag;
+    record->type = linear::recordType( type );
+    record->dedupIndex = linear::kSharedValueFlags | linear::recordTypeBits( type );
     record->valSize = valueSize;
     std::memcpy( dataPtr, key.data(), key.size() );
-    if ( index < 256U )
-    {
-        auto shortIndex = static_cast<uint8_t>( index );
-        std::memcpy( dataPtr + key.size(), ( void * )&shortIndex, 1U );
-    }
-    else
+    std::memcpy( dataPtr + key.size(), &distance, sizeof( distance ) );
+    return recordOffset;
+}
+
+auto LinearProbeValue::calculateSize( std::string_view key, uint32_t index ) -> uint64_t
+{
+    return sizeof( linear::LinearProbeRecord ) + key.size() + linear::frequentValueIndexSize( index );
+}
+
+auto LinearProbeValue::addToEnd( std::string_view key, uint8_t type, uint32_t valueSize, uint32_t index, MemoryHandler * memory ) -> uint64_t
+{
+    if ( key.size() > Constants::Limit::kKeyLength )
     {
-        record->dedupIndex = linear::kDedupExtendedFlag;
-        std::memcpy( dataPtr + key.size(), ( void * )&index, 2U );
+        std::ostringstream oss;
+        oss << "input key size " << key.size()
+            << " is too large. max=" << Constants::Limit::kKeyLength;
+
+        AL_LOG_ERROR( oss.str() );
+        throw std::runtime_error( "key size " + std::to_string( key.size() ) + " too large. max=" + std::to_string( Constants::Limit::kKeyLength ) );
     }
+
+    auto newSize = calculateSize( key, index );
+    auto * valueSpace = memory->grow( newSize );
+    auto * record = reinterpret_cast<linear::LinearProbeRecord *>( valueSpace );
+    auto * dataPtr = valueSpace + sizeof( const linear::LinearProbeRecord );
+
+    record->keySize = key.size();
+    record->type = linear::recordType( type );
+    record->dedupIndex = linear::dedupFlags( index ) | linear::recordTypeBits( type );
+    record->valSize = valueSize;
+    std::memcpy( dataPtr, key.data(), key.size() );
+    linear::writeFrequentValueIndex( index, reinterpret_cast<char *>( dataPtr ) + key.size() );
     return valueSpace - memory->data();
 }
 
-auto LinearProbeValue::add( int64_t keySpaceOffset, std::string_view key, uint64_t hashcode, uint8_t type, uint32_t valueSize, uint16_t index, MemoryHandler * memory ) -> uint32_t
+auto LinearProbeValue::add( int64_t keySpaceOffset, std::string_view key, uint64_t hashcode, uint8_t type, uint32_t valueSize, uint32_t index, MemoryHandler * memory ) -> uint32_t
 {
     // Add new value to end of dataspace
     auto newValueOffset = addToEnd( key, type, valueSize, index, memory ) - mKeyspaceSizeOffset;
@@ -212,3 +315,240 @@ auto LinearProbeValue::add( int64_t keySpaceOffset, std::string_view key, uint64
 
     return 0;
 }
+
+auto LinearProbeValue::recordSize( const linear::LinearProbeRecord * record ) -> uint64_t
+{
+    // A deduplicated record keeps an index into the frequent values instead of the value, a shared
+    // one the distance to the record with the value
+    uint64_t valueSize = record->valSize;
+    if ( linear::isSharedValue( record ) )
+    {
+        valueSize = sizeof( int64_t );
+    }
+    else if ( record->dedupIndex & linear::kDedupVarintFlags )
+    {
+        valueSize = linear::frequentValueIndexSize( linear::frequentValueIndex( record ) );
+    }
+    return sizeof( linear::LinearProbeRecord ) + record->keySize + valueSize;
+}
+
+auto LinearProbeValue::reserveAfterKeySpace( uint64_t numberOfKeySlots, uint64_t keyspaceSize, uint64_t size, MemoryHandler * memory ) const -> void
+{
+    const auto dataSpaceSize = memory->dataSize() - keyspaceSize;
+    const auto endOffset = keyspaceSize + size + dataSpaceSize - mKeyspaceSizeOffset;
+    if ( ( endOffset & mOffsetMask ) != endOffset )
+    {
+        throw std::runtime_error( "offset bits " + mOffsetBitsStr + " too short" );
+    }
+
+    memory->grow( size );
+    auto * keySpacePtr = memory->data();
+    auto * slots = reinterpret_cast<uint64_t *>( keySpacePtr );
+    for ( uint64_t slotId = 0; slotId < numberOfKeySlots; ++slotId )
+    {
+        const auto slot = slots[slotId];
+        if ( ( slot & mOffsetMask ) != 0UL )
+        {
+            slots[slotId] = ( slot & mHashcodeMask ) | ( ( slot & mOffsetMask ) + size );
+        }
+    }
+    std::memmove( keySpacePtr + keyspaceSize + size, keySpacePtr + keyspaceSize, dataSpaceSize );
+    std::memset( keySpacePtr + keyspaceSize, 0, size );
+}
+
+auto LinearProbeValue::compressValues( uint64_t numberOfKeySlots, uint64_t keyspaceSize, MemoryHandler * memory ) -> void
+{
+    constexpr uint64_t kMaxSampleSize = 100U * ValueDictionary::kMaxSize;
+    const auto dataSpaceSize = memory->dataSize() - keyspaceSize;
+    auto isCompressible = []( const linear::LinearProbeRecord * record )
+    {
+        return record->type == static_cast<uint8_t>( CacheValueType::String ) && record->dedupIndex == 0U;
+    };
+    auto recordAt = [memory]( uint64_t offset )
+    {
+        return reinterpret_cast<const linear::LinearProbeRecord *>( memory->data() + offset );
+    };
+    const auto offsets = recordOffsets( numberOfKeySlots, memory );
+    uint64_t valuesSize = 0U;
+    for ( const auto offset : offsets )
+    {
+        valuesSize += isCompressible( recordAt( offset ) ) ? recordAt( offset )->valSize : 0U;
+    }
+
+    // Every stride-th value, so the sample spreads over the whole cache
+    const auto stride = valuesSize / kMaxSampleSize + 1U;
+    std::vector<std::string_view> samples;
+    uint64_t valueId = 0U;
+    for ( const auto offset : offsets )
+    {
+        const auto * record = recordAt( offset );
+        if ( isCompressible( record ) && valueId++ % stride == 0U )
+        {
+            samples.emplace_back( record->data + record->keySize, record->valSize );
+        }
+    }
+    // A dictionary much larger than the values it serves would cost more than it saves
+    mDictionary.set( ValueDictionary::train( samples, std::min<uint64_t>( ValueDictionary::kMaxSize, valuesSize / 16U ) ) );
+
+    std::vector<uint8_t> records;
+    records.reserve( dataSpaceSize );
+    std::vector<std::pair<uint64_t, uint64_t>> newOffsets; // by old offset
+    newOffsets.reserve( offsets.size() );
+    std::string compressed;
+    for ( const auto offset : offsets )
+    {
+        const auto * record = recordAt( offset );
+        const auto * bytes = reinterpret_cast<const uint8_t *>( record );
+        if ( !isCompressible( record ) || !mDictionary.compress( { record->data + record->keySize, record->valSize }, compressed ) )
+        {
+            appendPadding( records, keyspaceSize, *record );
+            newOffsets.emplace_back( offset, keyspaceSize + records.size() );
+            records.insert( records.end(), bytes, bytes + recordSize( record ) );
+            continue;
+        }
+        newOffsets.emplace_back( offset, keyspaceSize + records.size() );
+        linear::LinearProbeRecord header = *record;
+        header.dedupIndex = linear::kCompressedFlag;
+        header.valSize = compressed.size();
+        const auto * headerBytes = reinterpret_cast<const uint8_t *>( &header );
+        records.insert( records.end(), headerBytes, headerBytes + sizeof( header ) );
+        records.insert( records.end(), bytes + sizeof( header ), bytes + sizeof( header ) + record->keySize );
+        records.insert( records.end(), compressed.begin(), compressed.end() );
+    }
+
+    remapSlots( numberOfKeySlots, newOffsets, memory );
+    replaceRecords( keyspaceSize, records, memory );
+}
+
+auto LinearProbeValue::remapSlots( uint64_t numberOfKeySlots, const std::vector<std::pair<uint64_t, uint64_t>> & newOffsets, MemoryHandler * memory ) const -> void
+{
+    auto * slots = reinterpret_cast<uint64_t *>( memory->data() );
+    for ( uint64_t slotId = 0; slotId < numberOfKeySlots; ++slotId )
+    {
+        const auto slot = slots[slotId];
+        if ( ( slot & mOffsetMask ) == 0UL )
+        {
+            continue;
+        }
+        const auto oldOffset = ( slot & mOffsetMask ) + mKeyspaceSizeOffset;
+        const auto iter = std::lower_bound( newOffsets.begin(), newOffsets.end(), std::make_pair( oldOffset, uint64_t{ 0U } ) );
+        if ( iter == newOffsets.end() || iter->first != oldOffset )
+        {
+            throw std::runtime_error( "slot " + std::to_string( slotId ) + " does not point to a record" );
+        }
+        slots[slotId] = ( slot & mHashcodeMask ) | ( iter->second - mKeyspaceSizeOffset );
+    }
+}
+
+auto LinearProbeValue::forEachPlainValue( uint64_t numberOfKeySlots, const MemoryHandler * memory, const std::function<void( std::string_view )> & visitor ) const -> void
+{
+    for ( const auto offset : recordOffsets( numberOfKeySlots, memory ) )
+    {
+        const auto * record = reinterpret_cast<const linear::LinearProbeRecord *>( memory->data() + offset );
+        if ( linear::isSharedValue( record ) )
+        {
+            visitor( linear::sharedValue( record ) );
+        }
+        else if ( ( record->dedupIndex & ( linear::kDedupVarintFlags | linear::kCompressedFlag ) ) == 0U )
+        {
+            visitor( { record->data + record->keySize, record->valSize } );
+        }
+    }
+}
+
+auto LinearProbeValue::dedupValues( uint64_t numberOfKeySlots, uint64_t keyspaceSize, const std::unordered_map<std::string_view, uint32_t> & indexes, MemoryHandler * memory ) const -> void
+{
+    std::vector<uint8_t> records;
+    records.reserve( memory->dataSize() - keyspaceSize );
+    std::vector<std::pair<uint64_t, uint64_t>> newOffsets; // by old offset
+    bool hasSharedValues = false;
+    for ( const auto recordOffset : recordOffsets( numberOfKeySlots, memory ) )
+    {
+        const auto * record = reinterpret_cast<const linear::LinearProbeRecord *>( memory->data() + recordOffset );
+        const auto * bytes = reinterpret_cast<const uint8_t *>( record );
+
+        // A shared value is frequent with the record holding it, so no record is left pointing to
+        // a record that no longer holds the value
+        auto iter = indexes.end();
+        if ( linear::isSharedValue( record ) )
+        {
+            iter = indexes.find( linear::sharedValue( record ) );
+        }
+        else if ( ( record->dedupIndex & ( linear::kDedupVarintFlags | linear::kCompressedFlag ) ) == 0U )
+        {
+            iter = indexes.find( { record->data + record->keySize, record->valSize } );
+        }
+        if ( iter == indexes.end() )
+        {
+            appendPadding( records, keyspaceSize, *record );
+            newOffsets.emplace_back( recordOffset, keyspaceSize + records.size() );
+            hasSharedValues |= appendMovedRecord( records, memory->data(), recordOffset );
+            continue;
+        }
+        newOffsets.emplace_back( recordOffset, keyspaceSize + records.size() );
+        // The value size stays, getters size their result from it
+        linear::LinearProbeRecord header = *record;
+        header.dedupIndex = linear::dedupFlags( iter->second ) | ( record->dedupIndex & linear::kTypeHighMask );
+        char index[8];
+        linear::writeFrequentValueIndex( iter->second, index );
+        const auto * headerBytes = reinterpret_cast<const uint8_t *>( &header );
+        records.insert( records.end(), headerBytes, headerBytes + sizeof( header ) );
+        records.insert( records.end(), bytes + sizeof( header ), bytes + sizeof( header ) + record->keySize );
+        records.insert( records.end(), index, index + linear::frequentValueIndexSize( iter->second ) );
+    }
+
+    if ( hasSharedValues )
+    {
+        fixSharedValues( records, keyspaceSize, newOffsets );
+    }
+    remapSlots( numberOfKeySlots, newOffsets, memory );
+    replaceRecords( keyspaceSize, records, memory );
+}
+
+auto LinearProbeValue::fixSharedValues( std::vector<uint8_t> & records, uint64_t keyspaceSize, const std::vector<std::pair<uint64_t, uint64_t>> & newOffsets ) const -> void
+{
+    // The records are reached from their new offsets, which skips the padding of aligned values
+    for ( const auto & offsets : newOffsets )
+    {
+        const auto position = offsets.second - keyspaceSize;
+        const auto * record = reinterpret_cast<const linear::LinearProbeRecord *>( records.data() + position );
+        const auto size = recordSize( record );
+        if ( linear::isSharedValue( record ) )
+        {
+            const auto ownerOffset = static_cast<uint64_t>( linear::sharedValueDistance( record ) );
+            const auto iter = std::lower_bound( newOffsets.begin(), newOffsets.end(), std::make_pair( ownerOffset, uint64_t{ 0U } ) );
+            if ( iter == newOffsets.end() || iter->first != ownerOffset )
+            {
+                throw std::runtime_error( "shared value at " + std::to_string( ownerOffset ) + " is not a record" );
+            }
+            const auto distance = static_cast<int64_t>( iter->second ) - static_cast<int64_t>( keyspaceSize + position );
+            std::memcpy( records.data() + position + size - sizeof( int64_t ), &distance, sizeof( int64_t ) );
+        }
+    }
+}
+
+auto LinearProbeValue::recordOffsets( uint64_t numberOfKeySlots, const MemoryHandler * memory ) const -> std::vector<uint64_t>
+{
+    const auto * slots = reinterpret_cast<const uint64_t *>( memory->data() );
+    std::vector<uint64_t> offsets;
+    for ( uint64_t slotId = 0; slotId < numberOfKeySlots; ++slotId )
+    {
+        if ( ( slots[slotId] & mOffsetMask ) != 0UL )
+        {
+            offsets.push_back( ( slots[slotId] & mOffsetMask ) + mKeyspaceSizeOffset );
+        }
+    }
+    std::sort( offsets.begin(), offsets.end() );
+    return offsets;
+}
+
+auto LinearProbeValue::recordPadding( uint64_t offset, const linear::LinearProbeRecord & record ) const -> uint64_t
+{
+    // The data space follows the header in the cache file
+    return linear::recordPadding( sizeof( CacheHeader ) + offset, record, mValueAlignment );
+}
+
+auto LinearProbeValue::appendPadding( std::vector<uint8_t> & records, uint64_t keyspaceSize, const linear::LinearProbeRecord & record ) const -> void
+{
+    records.resize( records.size() + recordPadding( keyspaceSize + records.size(), record ), 0U );
+}
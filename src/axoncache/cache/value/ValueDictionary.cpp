@@ -0,0 +1,358 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include "axoncache/cache/value/ValueDictionary.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include "axoncache/Constants.h"
+
+using namespace axoncache;
+
+namespace
+{
+constexpr uint64_t kDictionaryHeaderSize = sizeof( uint64_t ) + 2 * sizeof( uint32_t );
+constexpr uint32_t kDictionaryHashBits = 16U;
+constexpr int32_t kMaxChainLength = 16;
+
+// Training scores segments of kSegmentSize bytes by their d-mers of kDmerSize bytes
+constexpr size_t kDmerSize = sizeof( uint64_t );
+constexpr size_t kSegmentSize = 64U;
+
+auto paddedTo8( uint64_t size ) -> uint64_t
+{
+    return ( size + 7U ) & ~uint64_t{ 7U };
+}
+
+auto hash4( const char * ptr, uint32_t bits ) -> uint32_t
+{
+    uint32_t value = 0;
+    std::memcpy( &value, ptr, sizeof( value ) );
+    return ( value * 2654435761U ) >> ( 32U - bits );
+}
+
+auto readDmer( const char * ptr ) -> uint64_t
+{
+    uint64_t value = 0;
+    std::memcpy( &value, ptr, sizeof( value ) );
+    return value;
+}
+
+auto commonLength( const char * lhs, const char * rhs, size_t limit ) -> size_t
+{
+    size_t length = 0;
+    while ( length < limit && lhs[length] == rhs[length] )
+    {
+        ++length;
+    }
+    return length;
+}
+
+auto putVarint( uint64_t value, std::string & out ) -> void
+{
+    while ( value >= 0x80U )
+    {
+        out.push_back( static_cast<char>( value | 0x80U ) );
+        value >>= 7U;
+    }
+    out.push_back( static_cast<char>( value ) );
+}
+
+auto getVarint( const char *& ptr, const char * end ) -> uint64_t
+{
+    uint64_t value = 0;
+    for ( uint32_t shift = 0; shift < 64U && ptr != end; shift += 7U )
+    {
+        const auto byte = static_cast<uint8_t>( *ptr++ );
+        value |= static_cast<uint64_t>( byte & 0x7FU ) << shift;
+        if ( ( byte & 0x80U ) == 0U )
+        {
+            return value;
+        }
+    }
+    throw std::runtime_error( "corrupted compressed value" );
+}
+}
+
+auto ValueDictionary::train( const std::vector<std::string_view> & samples, size_t maxSize ) -> std::string
+{
+    // Number of samples containing each d-mer, only the ones shared by several samples count
+    struct DmerCount
+    {
+        uint32_t samples{ 0U };
+        uint32_t lastSample{ 0U };
+    };
+    std::unordered_map<uint64_t, DmerCount> counts;
+    std::string all;
+    std::vector<uint8_t> isDmer;
+    for ( uint32_t sampleId = 1; sampleId <= samples.size(); ++sampleId )
+    {
+        const auto sample = samples[sampleId - 1U];
+        for ( size_t pos = 0; pos + kDmerSize <= sample.size(); ++pos )
+        {
+            auto & count = counts[readDmer( sample.data() + pos )];
+            if ( count.lastSample != sampleId )
+            {
+                count.lastSample = sampleId;
+                ++count.samples;
+            }
+        }
+        all.append( sample );
+        isDmer.resize( all.size(), 0U );
+        for ( size_t pos = all.size() - sample.size(); pos + kDmerSize <= all.size(); ++pos )
+        {
+            isDmer[pos] = 1U;
+        }
+    }
+
+    const auto numberOfSegments = maxSize / kSegmentSize;
+    if ( numberOfSegments == 0U || all.size() < kSegmentSize )
+    {
+        return {};
+    }
+
+    auto score = [&]( size_t pos ) -> uint64_t
+    {
+        if ( isDmer[pos] == 0U )
+        {
+            return 0U;
+        }
+        const auto samplesWithDmer = counts[readDmer( all.data() + pos )].samples;
+        return samplesWithDmer > 1U ? samplesWithDmer : 0U;
+    };
+
+    // Best segment of each epoch, once picked its d-mers no longer score so segments don't repeat
+    constexpr size_t kDmersPerSegment = kSegmentSize - kDmerSize + 1U;
+    const auto epochSize = std::max( kSegmentSize, all.size() / numberOfSegments );
+    std::vector<std::pair<uint64_t, size_t>> segments;
+    for ( size_t begin = 0; begin + kSegmentSize <= all.size() && segments.size() < numberOfSegments; begin += epochSize )
+    {
+        const auto end = std::min( begin + epochSize, all.size() );
+        uint64_t windowScore = 0U;
+        for ( size_t pos = begin; pos < begin + kDmersPerSegment; ++pos )
+        {
+            windowScore += score( pos );
+        }
+        auto best = std::make_pair( windowScore, begin );
+        for ( size_t pos = begin + 1U; pos + kSegmentSize <= end; ++pos )
+        {
+            windowScore += score( pos + kDmersPerSegment - 1U );
+            windowScore -= score( pos - 1U );
+            best = std::max( best, std::make_pair( windowScore, pos ), []( const auto & lhs, const auto & rhs )
+                             { return lhs.first < rhs.first; } );
+        }
+        if ( best.first == 0U )
+        {
+            continue;
+        }
+        for ( size_t pos = best.second; pos < best.second + kDmersPerSegment; ++pos )
+        {
+            if ( isDmer[pos] != 0U )
+            {
+                counts[readDmer( all.data() + pos )].samples = 0U;
+            }
+        }
+        segments.push_back( best );
+    }
+
+    // The best segments go last, closest to the values so their matches have the shortest distances
+    std::stable_sort( segments.begin(), segments.end(), []( const auto & lhs, const auto & rhs )
+                      { return lhs.first < rhs.first; } );
+    std::string dictionary;
+    dictionary.reserve( segments.size() * kSegmentSize );
+    for ( const auto & [segmentScore, pos] : segments )
+    {
+        dictionary.append( all, pos, kSegmentSize );
+    }
+    return dictionary;
+}
+
+auto ValueDictionary::set( std::string_view dictionary ) -> void
+{
+    mOwned.assign( dictionary.begin(), dictionary.end() );
+    mBytes = { mOwned.data(), mOwned.size() };
+    mIsEnabled = true;
+
+    mHead.assign( 1U << kDictionaryHashBits, -1 );
+    mPrev.assign( mOwned.size(), -1 );
+    for ( size_t pos = 0; pos + kMinMatch <= mOwned.size(); ++pos )
+    {
+        auto & head = mHead[hash4( mOwned.data() + pos, kDictionaryHashBits )];
+        mPrev[pos] = head;
+        head = static_cast<int32_t>( pos );
+    }
+}
+
+auto ValueDictionary::compress( std::string_view value, std::string & out ) const -> bool
+{
+    out.clear();
+    putVarint( value.size(), out );
+
+    const auto * src = value.data();
+    const auto size = value.size();
+    uint32_t bits = 8U;
+    while ( bits < kDictionaryHashBits && ( size_t{ 1U } << bits ) < size )
+    {
+        ++bits;
+    }
+    std::vector<int32_t> head( size_t{ 1U } << bits, -1 );
+    std::vector<int32_t> prev( size, -1 );
+    auto insert = [&]( size_t pos )
+    {
+        if ( pos + kMinMatch <= size )
+        {
+            auto & first = head[hash4( src + pos, bits )];
+            prev[pos] = first;
+            first = static_cast<int32_t>( pos );
+        }
+    };
+
+    size_t anchor = 0;
+    size_t pos = 0;
+    while ( pos + kMinMatch <= size )
+    {
+        size_t bestLength = 0;
+        size_t bestDistance = 0;
+        if ( !mHead.empty() )
+        {
+            auto candidate = mHead[hash4( src + pos, kDictionaryHashBits )];
+            for ( int32_t depth = 0; candidate >= 0 && depth < kMaxChainLength; candidate = mPrev[candidate], ++depth )
+            {
+                const auto length = commonLength( mBytes.data() + candidate, src + pos, std::min( mBytes.size() - candidate, size - pos ) );
+                if ( length > bestLength )
+                {
+                    bestLength = length;
+                    bestDistance = mBytes.size() - candidate + pos;
+                }
+            }
+        }
+        auto candidate = head[hash4( src + pos, bits )];
+        for ( int32_t depth = 0; candidate >= 0 && depth < kMaxChainLength; candidate = prev[candidate], ++depth )
+        {
+            const auto length = commonLength( src + candidate, src + pos, size - pos );
+            if ( length > bestLength )
+            {
+                bestLength = length;
+                bestDistance = pos - candidate;
+            }
+        }
+
+        if ( bestLength < kMinMatch )
+        {
+            insert( pos++ );
+            continue;
+        }
+        putVarint( pos - anchor, out );
+        out.append( src + anchor, pos - anchor );
+        putVarint( bestLength - kMinMatch, out );
+        putVarint( bestDistance, out );
+        for ( const auto matchEnd = pos + bestLength; pos < matchEnd; ++pos )
+        {
+            insert( pos );
+        }
+        anchor = pos;
+        if ( out.size() >= size )
+        {
+            return false;
+        }
+    }
+    putVarint( size - anchor, out );
+    out.append( src + anchor, size - anchor );
+    return out.size() < size;
+}
+
+auto ValueDictionary::decompress( std::string_view compressed, std::string & out ) const -> std::string_view
+{
+    const auto * ptr = compressed.data();
+    const auto * end = ptr + compressed.size();
+    const auto size = getVarint( ptr, end );
+    // No value of a record is longer, a larger size would only allocate for a corrupted one
+    if ( size > Constants::Limit::kValueLength )
+    {
+        throw std::runtime_error( "corrupted compressed value" );
+    }
+    out.resize( size );
+
+    auto * dst = out.data();
+    uint64_t pos = 0;
+    while ( true )
+    {
+        const auto literals = getVarint( ptr, end );
+        if ( literals > static_cast<uint64_t>( end - ptr ) || literals > size - pos )
+        {
+            throw std::runtime_error( "corrupted compressed value" );
+        }
+        std::memcpy( dst + pos, ptr, literals );
+        ptr += literals;
+        pos += literals;
+        if ( pos == size )
+        {
+            break;
+        }
+
+        auto length = getVarint( ptr, end ) + kMinMatch;
+        const auto distance = getVarint( ptr, end );
+        if ( length > size - pos || distance == 0U || distance > mBytes.size() + pos )
+        {
+            throw std::runtime_error( "corrupted compressed value" );
+        }
+        if ( distance > pos )
+        {
+            // The match starts in the dictionary and may go on at the start of the value
+            const auto fromDictionary = std::min( length, distance - pos );
+            std::memcpy( dst + pos, mBytes.data() + mBytes.size() - ( distance - pos ), fromDictionary );
+            pos += fromDictionary;
+            length -= fromDictionary;
+        }
+        const auto * from = dst + pos - distance;
+        if ( distance >= length )
+        {
+            std::memcpy( dst + pos, from, length );
+        }
+        else
+        {
+            // Overlapping match, repeats the last distance bytes
+            for ( uint64_t i = 0; i < length; ++i )
+            {
+                dst[pos + i] = from[i];
+            }
+        }
+        pos += length;
+    }
+    if ( ptr != end )
+    {
+        throw std::runtime_error( "corrupted compressed value" );
+    }
+    return out;
+}
+
+auto ValueDictionary::serializedSize() const -> uint64_t
+{
+    return paddedTo8( kDictionaryHeaderSize + mBytes.size() );
+}
+
+auto ValueDictionary::write( uint8_t * data ) -> void
+{
+    mSize = serializedSize();
+    const auto length = static_cast<uint32_t>( mBytes.size() );
+    std::memset( data, 0, mSize );
+    std::memcpy( data, &mSize, sizeof( uint64_t ) );
+    std::memcpy( data + sizeof( uint64_t ), &length, sizeof( uint32_t ) );
+    std::memcpy( data + kDictionaryHeaderSize, mBytes.data(), mBytes.size() );
+}
+
+auto ValueDictionary::load( const uint8_t * data ) -> void
+{
+    uint32_t length = 0U;
+    std::memcpy( &mSize, data, sizeof( uint64_t ) );
+    std::memcpy( &length, data + sizeof( uint64_t ), sizeof( uint32_t ) );
+    if ( paddedTo8( kDictionaryHeaderSize + length ) != mSize )
+    {
+        throw std::runtime_error( "value dictionary size doesn't match" );
+    }
+
+    mIsEnabled = true;
+    mBytes = { reinterpret_cast<const char *>( data + kDictionaryHeaderSize ), length };
+}
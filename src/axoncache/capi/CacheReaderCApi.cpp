@@ -8,13 +8,20 @@
 #include <memory>
 #include <cstdio>
 #include <span>
+#include <algorithm>
 #include <atomic>
 
 #include <axoncache/CacheGenerator.h>
 #include <axoncache/loader/CacheOneTimeLoader.h>
 #include <axoncache/cache/LinearProbeCache.h>
 #include <axoncache/cache/LinearProbeDedupCache.h>
+#include <axoncache/cache/LinearProbeSimdCache.h>
+#include <axoncache/cache/PerfectHashCache.h>
+#include <axoncache/cache/CuckooCache.h>
+#include <axoncache/cache/EmbeddingCache.h>
+#include <axoncache/cache/NumericCache.h>
 #include <axoncache/cache/BucketChainCache.h>
+#include <axoncache/cache/HotKeyCache.h>
 #include "axoncache/common/SharedSettingsProvider.h"
 
 using namespace axoncache;
@@ -49,6 +56,18 @@ float * convertToPointer( std::span<const float> values, int * vectorSize )
     return ptr;
 }
 
+int64_t * convertToPointer( const Int64ListView & values, int * listSize )
+{
+    *listSize = static_cast<int>( values.size() );
+    if ( values.empty() )
+    {
+        return nullptr;
+    }
+    auto * ptr = ( int64_t * )malloc( values.size() * sizeof( int64_t ) );
+    Int64ListCodec::decode( values.bytes(), ptr );
+    return ptr;
+}
+
 char ** convertToPointer( std::vector<std::string_view> values, int * vectorSize, int ** valueSizes )
 {
     if ( values.empty() )
@@ -78,7 +97,7 @@ class CacheReader // NOLINT
     CacheReader() = default;
     virtual ~CacheReader() = default;
 
-    int initializeReader( const std::string & taskName, const std::string & destinationFolder, const std::string & timestamp, bool isPreloadMemoryEnabled )
+    int initializeReader( const std::string & taskName, const std::string & destinationFolder, const std::string & timestamp, bool isPreloadMemoryEnabled, bool isHugePagesEnabled = false, bool isHotKeyCacheEnabled = false )
     {
         const axoncache::SharedSettingsProvider settings( "" );
         axoncache::CacheOneTimeLoader loader( &settings );
@@ -114,29 +133,73 @@ class CacheReader // NOLINT
         }
 
         mCacheType = static_cast<axoncache::CacheType>( info.cacheType );
+        mHashFuncId = info.hashFuncId;
+        // BUCKET_CHAIN has no typed lookups by hash, it always reads the cache directly
+        mIsHotKeyCacheEnabled = isHotKeyCacheEnabled && mCacheType != axoncache::CacheType::BUCKET_CHAIN;
 
         try
         {
             switch ( mCacheType )
             {
                 case axoncache::CacheType::LINEAR_PROBE:
+                    if ( mHashFuncId == Constants::HashFuncId::WYHASH )
+                    {
+                        auto cache = loader.loadAbsolutePath<axoncache::LinearProbeWyhashCache>( cacheName, cacheAbsolutePath, isPreloadMemoryEnabled, isHugePagesEnabled );
+                        std::atomic_store( &mReaderLinearProbeWyhashCache, cache );
+                    }
+                    else
+                    {
+                        auto cache = loader.loadAbsolutePath<axoncache::LinearProbeCache>( cacheName, cacheAbsolutePath, isPreloadMemoryEnabled, isHugePagesEnabled );
+                        std::atomic_store( &mReaderLinearProbeCache, cache );
+                    }
+                    break;
+
+                case axoncache::CacheType::LINEAR_PROBE_SIMD:
                 {
-                    auto cache = loader.loadAbsolutePath<axoncache::LinearProbeCache>( cacheName, cacheAbsolutePath, isPreloadMemoryEnabled );
-                    std::atomic_store( &mReaderLinearProbeCache, cache );
+                    auto cache = loader.loadAbsolutePath<axoncache::LinearProbeSimdCache>( cacheName, cacheAbsolutePath, isPreloadMemoryEnabled, isHugePagesEnabled );
+                    std::atomic_store( &mReaderLinearProbeSimdCache, cache );
+                }
+                break;
+
+                case axoncache::CacheType::PERFECT_HASH:
+                {
+                    auto cache = loader.loadAbsolutePath<axoncache::PerfectHashCache>( cacheName, cacheAbsolutePath, isPreloadMemoryEnabled, isHugePagesEnabled );
+                    std::atomic_store( &mReaderPerfectHashCache, cache );
+                }
+                break;
+
+                case axoncache::CacheType::CUCKOO:
+                {
+                    auto cache = loader.loadAbsolutePath<axoncache::CuckooCache>( cacheName, cacheAbsolutePath, isPreloadMemoryEnabled, isHugePagesEnabled );
+                    std::atomic_store( &mReaderCuckooCache, cache );
+                }
+                break;
+
+                case axoncache::CacheType::NUMERIC:
+                {
+                    auto cache = loader.loadAbsolutePath<axoncache::NumericCache>( cacheName, cacheAbsolutePath, isPreloadMemoryEnabled, isHugePagesEnabled );
+                    std::atomic_store( &mReaderNumericCache, cache );
+                }
+                break;
+
+                case axoncache::CacheType::EMBEDDING:
+                {
+                    auto cache = loader.loadAbsolutePath<axoncache::EmbeddingCache>( cacheName, cacheAbsolutePath, isPreloadMemoryEnabled, isHugePagesEnabled );
+                    std::atomic_store( &mReaderEmbeddingCache, cache );
                 }
                 break;
 
                 case axoncache::CacheType::LINEAR_PROBE_DEDUP:
                 case axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED:
                 {
-                    auto cache = loader.loadAbsolutePath<axoncache::LinearProbeDedupCache>( cacheName, cacheAbsolutePath, isPreloadMemoryEnabled );
+                    auto cache = loader.loadAbsolutePath<axoncache::LinearProbeDedupCache>( cacheName, cacheAbsolutePath, isPreloadMemoryEnabled, isHugePagesEnabled );
                     std::atomic_store( &mReaderLinearProbeDedupCache, cache );
                 }
                 break;
 
                 case axoncache::CacheType::BUCKET_CHAIN:
                 {
-                    auto cache = loader.loadAbsolutePath<axoncache::BucketChainCache>( cacheName, cacheAbsolutePath, isPreloadMemoryEnabled );
+                    auto cache = loader.loadAbsolutePath<axoncache::BucketChainCache>( cacheName, cacheAbsolutePath, isPreloadMemoryEnabled, isHugePagesEnabled );
                     std::atomic_store( &mReaderBucketChainCache, cache );
                 }
                 break;
@@ -165,44 +228,16 @@ class CacheReader // NOLINT
         {
             return 0;
         }
-        switch ( mCacheType )
+        if ( mCacheType == axoncache::CacheType::BUCKET_CHAIN )
         {
-            case axoncache::CacheType::LINEAR_PROBE:
-            {
-                auto cache = std::atomic_load( &mReaderLinearProbeCache );
-                if ( cache == nullptr )
-                {
-                    return 0;
-                }
-                return cache->contains( std::string_view{ key, keySize } ) ? 1 : 0;
-            }
-
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP:
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED:
-            {
-                const auto cache = std::atomic_load( &mReaderLinearProbeDedupCache );
-                if ( cache == nullptr )
-                {
-                    return 0;
-                }
-                return cache->contains( std::string_view{ key, keySize } ) ? 1 : 0;
-            }
-
-            case axoncache::CacheType::BUCKET_CHAIN:
-            {
-                const auto cache = std::atomic_load( &mReaderBucketChainCache );
-                if ( cache == nullptr )
-                {
-                    return 0;
-                }
-                return cache->contains( std::string_view{ key, keySize } ) ? 1 : 0;
-            }
-
-            case axoncache::CacheType::MAP:
-            case axoncache::CacheType::NONE:
-            default:
-                return 0;
+            const auto cache = std::atomic_load( &mReaderBucketChainCache );
+            return cache != nullptr && cache->contains( std::string_view{ key, keySize } ) ? 1 : 0;
         }
+        auto lookup = [&]( const auto & cache )
+        {
+            return cache.contains( std::string_view{ key, keySize } ) ? 1 : 0;
+        };
+        return withFrontCache( lookup, 0 );
     }
 
     char * getKey( char * key, size_t keySize, int * isExist, int * valueSize )
@@ -213,50 +248,31 @@ class CacheReader // NOLINT
         {
             return nullptr;
         }
-
-        switch ( mCacheType )
+        std::pair<std::string_view, bool> result{};
+        std::string buffer;
+        if ( mCacheType == axoncache::CacheType::BUCKET_CHAIN )
         {
-            case axoncache::CacheType::LINEAR_PROBE:
+            const auto cache = std::atomic_load( &mReaderBucketChainCache );
+            if ( cache == nullptr )
             {
-                auto cache = std::atomic_load( &mReaderLinearProbeCache );
-                if ( cache == nullptr )
-                {
-                    return nullptr;
-                }
-                auto result = cache->getString( std::string_view{ key, keySize } );
-                *isExist = result.second ? 1 : 0;
-                return convertToPointer( result.first, valueSize );
+                return nullptr;
             }
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP:
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED:
+            result = cache->getString( std::string_view{ key, keySize }, buffer );
+        }
+        else
+        {
+            auto lookup = [&]( const auto & cache )
             {
-                auto cache = std::atomic_load( &mReaderLinearProbeDedupCache );
-                if ( cache == nullptr )
-                {
-                    return nullptr;
-                }
-                auto result = cache->getString( std::string_view{ key, keySize } );
-                *isExist = result.second ? 1 : 0;
-                return convertToPointer( result.first, valueSize );
-            }
-
-            case axoncache::CacheType::BUCKET_CHAIN:
+                result = cache.getString( std::string_view{ key, keySize }, buffer );
+                return true;
+            };
+            if ( !withFrontCache( lookup, false ) )
             {
-                auto cache = std::atomic_load( &mReaderBucketChainCache );
-                if ( cache == nullptr )
-                {
-                    return nullptr;
-                }
-                auto result = cache->getString( std::string_view{ key, keySize } );
-                *isExist = result.second ? 1 : 0;
-                return convertToPointer( result.first, valueSize );
-            }
-
-            case axoncache::CacheType::MAP:
-            case axoncache::CacheType::NONE:
-            default:
                 return nullptr;
+            }
         }
+        *isExist = result.second ? 1 : 0;
+        return convertToPointer( result.first, valueSize );
     }
 
     char * getVectorKeyItem( char * key, size_t keySize, int index, int * valueSize )
@@ -266,44 +282,11 @@ class CacheReader // NOLINT
         {
             return nullptr;
         }
-        switch ( mCacheType )
+        auto lookup = [&]( const auto & cache )
         {
-            case axoncache::CacheType::LINEAR_PROBE:
-            {
-                auto cache = std::atomic_load( &mReaderLinearProbeCache );
-                if ( cache == nullptr )
-                {
-                    return nullptr;
-                }
-                const auto items = cache->getVector( std::string_view{ key, keySize } );
-                if ( index < static_cast<int>( items.size() ) )
-                {
-                    return convertToPointer( items[index], valueSize );
-                }
-            }
-            break;
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP:
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED:
-            {
-                auto cache = std::atomic_load( &mReaderLinearProbeDedupCache );
-                if ( cache == nullptr )
-                {
-                    return nullptr;
-                }
-                const auto items = cache->getVector( std::string_view{ key, keySize } );
-                if ( index < static_cast<int>( items.size() ) )
-                {
-                    return convertToPointer( items[index], valueSize );
-                }
-            }
-            break;
-            case axoncache::CacheType::BUCKET_CHAIN:
-            case axoncache::CacheType::MAP:
-            case axoncache::CacheType::NONE:
-            default:
-                break;
-        }
-        return nullptr;
+            return index < 0 ? nullptr : convertToPointer( cache.getVectorElement( std::string_view{ key, keySize }, static_cast<size_t>( index ) ), valueSize );
+        };
+        return withLinearProbeCache( lookup, static_cast<char *>( nullptr ) );
     }
 
     size_t getVectorKeySize( char * key, size_t keySize )
@@ -312,35 +295,11 @@ class CacheReader // NOLINT
         {
             return 0;
         }
-        switch ( mCacheType )
+        auto lookup = [&]( const auto & cache )
         {
-            case axoncache::CacheType::LINEAR_PROBE:
-            {
-                auto cache = std::atomic_load( &mReaderLinearProbeCache );
-                if ( cache == nullptr )
-                {
-                    return 0;
-                }
-                return cache->getVector( std::string_view{ key, keySize } ).size();
-            }
-
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP:
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED:
-            {
-                auto cache = std::atomic_load( &mReaderLinearProbeDedupCache );
-                if ( cache == nullptr )
-                {
-                    return 0;
-                }
-                return cache->getVector( std::string_view{ key, keySize } ).size();
-            }
-
-            case axoncache::CacheType::BUCKET_CHAIN:
-            case axoncache::CacheType::MAP:
-            case axoncache::CacheType::NONE:
-            default:
-                return 0;
-        }
+            return cache.getVectorSize( std::string_view{ key, keySize } );
+        };
+        return withLinearProbeCache( lookup, size_t{ 0 } );
     }
 
     int64_t getLong( char * key, size_t keySize, int * isExist, int64_t defaultValue )
@@ -350,39 +309,17 @@ class CacheReader // NOLINT
         {
             return defaultValue;
         }
-        switch ( mCacheType )
+        if ( !isLinearProbeFamily() )
         {
-            case axoncache::CacheType::LINEAR_PROBE:
-            {
-                auto cache = std::atomic_load( &mReaderLinearProbeCache );
-                if ( cache == nullptr )
-                {
-                    return defaultValue;
-                }
-                auto result = cache->getInt64( std::string_view{ key, keySize }, defaultValue );
-                *isExist = result.second ? 1 : 0;
-                return result.first;
-            }
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP:
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED:
-            {
-                auto cache = std::atomic_load( &mReaderLinearProbeDedupCache );
-                if ( cache == nullptr )
-                {
-                    return defaultValue;
-                }
-                auto result = cache->getInt64( std::string_view{ key, keySize }, defaultValue );
-                *isExist = result.second ? 1 : 0;
-                return result.first;
-            }
-            case axoncache::CacheType::BUCKET_CHAIN:
-            case axoncache::CacheType::MAP:
-            case axoncache::CacheType::NONE:
-            default:
-            {
-                return int64_t{}; // Not supported
-            }
+            return int64_t{}; // Not supported
         }
+        auto lookup = [&]( const auto & cache )
+        {
+            const auto result = cache.getInt64( std::string_view{ key, keySize }, defaultValue );
+            *isExist = result.second ? 1 : 0;
+            return result.first;
+        };
+        return withFrontCache( lookup, defaultValue );
     }
 
     int getInteger( char * key, size_t keySize, int * isExist, int defaultValue )
@@ -392,39 +329,17 @@ class CacheReader // NOLINT
         {
             return defaultValue;
         }
-        switch ( mCacheType )
+        if ( !isLinearProbeFamily() )
         {
-            case axoncache::CacheType::LINEAR_PROBE:
-            {
-                auto cache = std::atomic_load( &mReaderLinearProbeCache );
-                if ( cache == nullptr )
-                {
-                    return defaultValue;
-                }
-                auto result = cache->getInt64( std::string_view{ key, keySize }, defaultValue );
-                *isExist = result.second ? 1 : 0;
-                return static_cast<int>( result.first );
-            }
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP:
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED:
-            {
-                auto cache = std::atomic_load( &mReaderLinearProbeDedupCache );
-                if ( cache == nullptr )
-                {
-                    return defaultValue;
-                }
-                auto result = cache->getInt64( std::string_view{ key, keySize }, defaultValue );
-                *isExist = result.second ? 1 : 0;
-                return static_cast<int>( result.first );
-            }
-            case axoncache::CacheType::BUCKET_CHAIN:
-            case axoncache::CacheType::MAP:
-            case axoncache::CacheType::NONE:
-            default:
-            {
-                return int{}; // Not supported
-            }
+            return int{}; // Not supported
         }
+        auto lookup = [&]( const auto & cache )
+        {
+            const auto result = cache.getInt64( std::string_view{ key, keySize }, defaultValue );
+            *isExist = result.second ? 1 : 0;
+            return static_cast<int>( result.first );
+        };
+        return withFrontCache( lookup, defaultValue );
     }
 
     double getDouble( char * key, size_t keySize, int * isExist, double defaultValue )
@@ -434,39 +349,17 @@ class CacheReader // NOLINT
         {
             return defaultValue;
         }
-        switch ( mCacheType )
+        if ( !isLinearProbeFamily() )
         {
-            case axoncache::CacheType::LINEAR_PROBE:
-            {
-                auto cache = std::atomic_load( &mReaderLinearProbeCache );
-                if ( cache == nullptr )
-                {
-                    return defaultValue;
-                }
-                auto result = cache->getDouble( std::string_view{ key, keySize }, defaultValue );
-                *isExist = result.second ? 1 : 0;
-                return result.first;
-            }
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP:
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED:
-            {
-                auto cache = std::atomic_load( &mReaderLinearProbeDedupCache );
-                if ( cache == nullptr )
-                {
-                    return defaultValue;
-                }
-                auto result = cache->getDouble( std::string_view{ key, keySize }, defaultValue );
-                *isExist = result.second ? 1 : 0;
-                return result.first;
-            }
-            case axoncache::CacheType::BUCKET_CHAIN:
-            case axoncache::CacheType::MAP:
-            case axoncache::CacheType::NONE:
-            default:
-            {
-                return double{}; // Not supported
-            }
+            return double{}; // Not supported
         }
+        auto lookup = [&]( const auto & cache )
+        {
+            const auto result = cache.getDouble( std::string_view{ key, keySize }, defaultValue );
+            *isExist = result.second ? 1 : 0;
+            return result.first;
+        };
+        return withFrontCache( lookup, defaultValue );
     }
 
     int getBool( char * key, size_t keySize, int * isExist, int defaultValue )
@@ -476,39 +369,17 @@ class CacheReader // NOLINT
         {
             return defaultValue;
         }
-        switch ( mCacheType )
+        if ( !isLinearProbeFamily() )
         {
-            case axoncache::CacheType::LINEAR_PROBE:
-            {
-                auto cache = std::atomic_load( &mReaderLinearProbeCache );
-                if ( cache == nullptr )
-                {
-                    return defaultValue;
-                }
-                auto result = cache->getBool( std::string_view{ key, keySize }, defaultValue != 0 );
-                *isExist = result.second ? 1 : 0;
-                return result.first ? 1 : 0;
-            }
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP:
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED:
-            {
-                auto cache = std::atomic_load( &mReaderLinearProbeDedupCache );
-                if ( cache == nullptr )
-                {
-                    return defaultValue;
-                }
-                auto result = cache->getBool( std::string_view{ key, keySize }, defaultValue != 0 );
-                *isExist = result.second ? 1 : 0;
-                return result.first ? 1 : 0;
-            }
-            case axoncache::CacheType::BUCKET_CHAIN:
-            case axoncache::CacheType::MAP:
-            case axoncache::CacheType::NONE:
-            default:
-            {
-                return 0; // Not supported
-            }
+            return 0; // Not supported
         }
+        auto lookup = [&]( const auto & cache )
+        {
+            const auto result = cache.getBool( std::string_view{ key, keySize }, defaultValue != 0 );
+            *isExist = result.second ? 1 : 0;
+            return result.first ? 1 : 0;
+        };
+        return withFrontCache( lookup, defaultValue );
     }
 
     char ** getVector( char * key, size_t keySize, int * vectorSize, int ** valueSizes )
@@ -519,32 +390,11 @@ class CacheReader // NOLINT
         {
             return nullptr;
         }
-        switch ( mCacheType )
+        auto lookup = [&]( const auto & cache )
         {
-            case axoncache::CacheType::LINEAR_PROBE:
-            {
-                auto cache = std::atomic_load( &mReaderLinearProbeCache );
-                if ( cache == nullptr )
-                {
-                    return nullptr;
-                }
-                return convertToPointer( cache->getVector( std::string_view{ key, keySize } ), vectorSize, valueSizes );
-            }
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP:
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED:
-            {
-                auto cache = std::atomic_load( &mReaderLinearProbeDedupCache );
-                if ( cache == nullptr )
-                {
-                    return nullptr;
-                }
-                return convertToPointer( cache->getVector( std::string_view{ key, keySize } ), vectorSize, valueSizes );
-            }
-            case axoncache::CacheType::MAP:
-            case axoncache::CacheType::NONE:
-            default:
-                return nullptr;
-        }
+            return convertToPointer( cache.getVector( std::string_view{ key, keySize } ), vectorSize, valueSizes );
+        };
+        return withLinearProbeCache( lookup, static_cast<char **>( nullptr ) );
     }
 
     float * getFloatVector( char * key, size_t keySize, int * vectorSize )
@@ -554,75 +404,403 @@ class CacheReader // NOLINT
         {
             return nullptr;
         }
-        switch ( mCacheType )
+        auto lookup = [&]( const auto & cache )
         {
-            case axoncache::CacheType::LINEAR_PROBE:
+            return convertToPointer( cache.getFloatSpan( std::string_view{ key, keySize } ), vectorSize );
+        };
+        return withLinearProbeCache( lookup, static_cast<float *>( nullptr ) );
+    }
+
+    int64_t * getInt64List( char * key, size_t keySize, int * listSize )
+    {
+        *listSize = 0;
+        if ( key == nullptr )
+        {
+            return nullptr;
+        }
+        auto lookup = [&]( const auto & cache )
+        {
+            return convertToPointer( cache.getInt64List( std::string_view{ key, keySize } ), listSize );
+        };
+        return withLinearProbeCache( lookup, static_cast<int64_t *>( nullptr ) );
+    }
+
+    int containsInt64( char * key, size_t keySize, int64_t id )
+    {
+        if ( key == nullptr )
+        {
+            return 0;
+        }
+        auto lookup = [&]( const auto & cache )
+        {
+            return cache.containsInt64( std::string_view{ key, keySize }, id ) ? 1 : 0;
+        };
+        return withLinearProbeCache( lookup, 0 );
+    }
+
+    int bitmapContains( char * key, size_t keySize, uint32_t value )
+    {
+        if ( key == nullptr )
+        {
+            return 0;
+        }
+        auto lookup = [&]( const auto & cache )
+        {
+            return cache.bitmapContains( std::string_view{ key, keySize }, value ) ? 1 : 0;
+        };
+        return withLinearProbeCache( lookup, 0 );
+    }
+
+    int64_t bitmapIntersectCount( char * leftKey, size_t leftKeySize, char * rightKey, size_t rightKeySize )
+    {
+        if ( leftKey == nullptr || rightKey == nullptr )
+        {
+            return 0;
+        }
+        auto lookup = [&]( const auto & cache )
+        {
+            return static_cast<int64_t>( cache.bitmapIntersectCount( std::string_view{ leftKey, leftKeySize }, std::string_view{ rightKey, rightKeySize } ) );
+        };
+        return withLinearProbeCache( lookup, int64_t{ 0 } );
+    }
+
+    int bitmapContainsMany( char * keys, const size_t * keySizes, size_t keyCount, uint32_t value, int * found )
+    {
+        std::fill_n( found, keyCount, 0 );
+        if ( keys == nullptr && keyCount != 0U )
+        {
+            return 0;
+        }
+        const auto keyViews = toKeyViews( keys, keySizes, keyCount );
+        auto lookup = [&]( const auto & cache )
+        {
+            auto contained = std::make_unique<bool[]>( keyCount );
+            const auto count = cache.bitmapContainsMany( keyViews, value, std::span<bool>{ contained.get(), keyCount } );
+            std::copy_n( contained.get(), keyCount, found );
+            return static_cast<int>( count );
+        };
+        return withLinearProbeCache( lookup, 0 );
+    }
+
+    char * getKeyType( char * key, size_t keySize, int * valueSize )
+    {
+        *valueSize = 0;
+        if ( key == nullptr )
+        {
+            return nullptr;
+        }
+        auto lookup = [&]( const auto & cache )
+        {
+            return convertToPointer( cache.getKeyType( std::string_view{ key, keySize } ), valueSize );
+        };
+        return withLinearProbeCache( lookup, static_cast<char *>( nullptr ) );
+    }
+
+    uint64_t hashKey( char * key, size_t keySize )
+    {
+        if ( key == nullptr )
+        {
+            return 0U;
+        }
+        if ( mCacheType == axoncache::CacheType::LINEAR_PROBE && mHashFuncId == Constants::HashFuncId::WYHASH )
+        {
+            return LinearProbeWyhashCache::hashKey( std::string_view{ key, keySize } ).value;
+        }
+        return LinearProbeCache::hashKey( std::string_view{ key, keySize } ).value;
+    }
+
+    int containsKeyWithHash( char * key, size_t keySize, uint64_t hash )
+    {
+        if ( key == nullptr )
+        {
+            return 0;
+        }
+        if ( mCacheType == axoncache::CacheType::BUCKET_CHAIN )
+        {
+            const auto cache = std::atomic_load( &mReaderBucketChainCache );
+            return cache != nullptr && cache->contains( std::string_view{ key, keySize }, KeyHash{ hash } ) ? 1 : 0;
+        }
+        auto lookup = [&]( const auto & cache )
+        {
+            return cache.contains( std::string_view{ key, keySize }, KeyHash{ hash } ) ? 1 : 0;
+        };
+        return withLinearProbeCache( lookup, 0 );
+    }
+
+    char * getKeyWithHash( char * key, size_t keySize, uint64_t hash, int * isExist, int * valueSize )
+    {
+        *isExist = 0;
+        *valueSize = 0;
+        if ( key == nullptr )
+        {
+            return nullptr;
+        }
+        std::pair<std::string_view, bool> result{};
+        std::string buffer;
+        if ( mCacheType == axoncache::CacheType::BUCKET_CHAIN )
+        {
+            const auto cache = std::atomic_load( &mReaderBucketChainCache );
+            if ( cache == nullptr )
             {
-                auto cache = std::atomic_load( &mReaderLinearProbeCache );
-                if ( cache == nullptr )
-                {
-                    return nullptr;
-                }
-                return convertToPointer( cache->getFloatSpan( std::string_view{ key, keySize } ), vectorSize );
+                return nullptr;
             }
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP:
-            case axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED:
+            result = cache->getString( std::string_view{ key, keySize }, KeyHash{ hash }, buffer );
+        }
+        else
+        {
+            auto lookup = [&]( const auto & cache )
+            {
+                result = cache.getString( std::string_view{ key, keySize }, KeyHash{ hash }, buffer );
+                return true;
+            };
+            if ( !withLinearProbeCache( lookup, false ) )
             {
-                auto cache = std::atomic_load( &mReaderLinearProbeDedupCache );
-                if ( cache == nullptr )
-                {
-                    return nullptr;
-                }
-                return convertToPointer( cache->getFloatSpan( std::string_view{ key, keySize } ), vectorSize );
-            }
-            case axoncache::CacheType::MAP:
-            case axoncache::CacheType::NONE:
-            default:
                 return nullptr;
+            }
         }
+        *isExist = result.second ? 1 : 0;
+        return convertToPointer( result.first, valueSize );
     }
 
-    char * getKeyType( char * key, size_t keySize, int * valueSize )
+    int64_t getLongWithHash( char * key, size_t keySize, uint64_t hash, int * isExist, int64_t defaultValue )
     {
-        *valueSize = 0;
+        *isExist = 0;
         if ( key == nullptr )
         {
-            return nullptr;
+            return defaultValue;
+        }
+        auto lookup = [&]( const auto & cache )
+        {
+            const auto result = cache.getInt64( std::string_view{ key, keySize }, KeyHash{ hash }, defaultValue );
+            *isExist = result.second ? 1 : 0;
+            return result.first;
+        };
+        return withLinearProbeCache( lookup, defaultValue );
+    }
+
+    int getIntegerWithHash( char * key, size_t keySize, uint64_t hash, int * isExist, int defaultValue )
+    {
+        return static_cast<int>( getLongWithHash( key, keySize, hash, isExist, defaultValue ) );
+    }
+
+    double getDoubleWithHash( char * key, size_t keySize, uint64_t hash, int * isExist, double defaultValue )
+    {
+        *isExist = 0;
+        if ( key == nullptr )
+        {
+            return defaultValue;
+        }
+        auto lookup = [&]( const auto & cache )
+        {
+            const auto result = cache.getDouble( std::string_view{ key, keySize }, KeyHash{ hash }, defaultValue );
+            *isExist = result.second ? 1 : 0;
+            return result.first;
+        };
+        return withLinearProbeCache( lookup, defaultValue );
+    }
+
+    int getBoolWithHash( char * key, size_t keySize, uint64_t hash, int * isExist, int defaultValue )
+    {
+        *isExist = 0;
+        if ( key == nullptr )
+        {
+            return defaultValue;
+        }
+        auto lookup = [&]( const auto & cache )
+        {
+            const auto result = cache.getBool( std::string_view{ key, keySize }, KeyHash{ hash }, defaultValue != 0 );
+            *isExist = result.second ? 1 : 0;
+            return result.first ? 1 : 0;
+        };
+        return withLinearProbeCache( lookup, defaultValue );
+    }
+
+    float score( char * key, size_t keySize, const float * query, size_t querySize, FloatListScore metric, int * isExist )
+    {
+        *isExist = 0;
+        if ( key == nullptr || ( query == nullptr && querySize != 0U ) )
+        {
+            return 0.0F;
+        }
+        auto lookup = [&]( const auto & cache )
+        {
+            const std::span<const float> querySpan{ query, querySize };
+            const auto result = metric == FloatListScore::Cosine ? cache.cosineSimilarity( std::string_view{ key, keySize }, querySpan ) : cache.dotProduct( std::string_view{ key, keySize }, querySpan );
+            *isExist = result.second ? 1 : 0;
+            return result.first;
+        };
+        return withLinearProbeCache( lookup, 0.0F );
+    }
+
+    int scoreMany( char * keys, const size_t * keySizes, size_t keyCount, const float * query, size_t querySize, int metric, float defaultScore, float * scores )
+    {
+        if ( !isScoreMetric( metric ) )
+        {
+            return -1;
+        }
+        std::fill_n( scores, keyCount, defaultScore );
+        if ( ( keys == nullptr && keyCount != 0U ) || ( query == nullptr && querySize != 0U ) )
+        {
+            return 0;
+        }
+        const auto keyViews = toKeyViews( keys, keySizes, keyCount );
+        auto lookup = [&]( const auto & cache )
+        {
+            return static_cast<int>( cache.scoreMany( keyViews, std::span<const float>{ query, querySize }, std::span<float>{ scores, keyCount }, static_cast<FloatListScore>( metric ), defaultScore ) );
+        };
+        return withLinearProbeCache( lookup, 0 );
+    }
+
+    int topK( char * keys, const size_t * keySizes, size_t keyCount, const float * query, size_t querySize, int metric, size_t k, int32_t * indexes, float * scores )
+    {
+        if ( !isScoreMetric( metric ) )
+        {
+            return -1;
         }
+        if ( ( keys == nullptr && keyCount != 0U ) || ( query == nullptr && querySize != 0U ) )
+        {
+            return 0;
+        }
+        const auto keyViews = toKeyViews( keys, keySizes, keyCount );
+        auto lookup = [&]( const auto & cache )
+        {
+            const auto best = cache.topK( keyViews, std::span<const float>{ query, querySize }, k, static_cast<FloatListScore>( metric ) );
+            for ( size_t i = 0; i < best.size(); ++i )
+            {
+                indexes[i] = static_cast<int32_t>( best[i].first );
+                scores[i] = best[i].second;
+            }
+            return static_cast<int>( best.size() );
+        };
+        return withLinearProbeCache( lookup, 0 );
+    }
+
+    int getEmbeddingDimension()
+    {
+        const auto cache = std::atomic_load( &mReaderEmbeddingCache );
+        return mCacheType == axoncache::CacheType::EMBEDDING && cache != nullptr ? static_cast<int>( cache->dimension() ) : 0;
+    }
+
+    int gatherRows( char * keys, const size_t * keySizes, size_t keyCount, float * out, size_t dimension )
+    {
+        const auto cache = std::atomic_load( &mReaderEmbeddingCache );
+        if ( mCacheType != axoncache::CacheType::EMBEDDING || cache == nullptr || cache->dimension() != dimension )
+        {
+            return -1;
+        }
+        if ( keys == nullptr && keyCount != 0U )
+        {
+            return -1;
+        }
+        return static_cast<int>( cache->gatherRows( toKeyViews( keys, keySizes, keyCount ), out ) );
+    }
+
+  private:
+    static bool isScoreMetric( int metric )
+    {
+        return metric == CACHE_READER_SCORE_DOT_PRODUCT || metric == CACHE_READER_SCORE_COSINE;
+    }
+
+    static std::vector<std::string_view> toKeyViews( const char * keys, const size_t * keySizes, size_t keyCount )
+    {
+        std::vector<std::string_view> keyViews;
+        keyViews.reserve( keyCount );
+        for ( size_t i = 0; i < keyCount; ++i )
+        {
+            keyViews.emplace_back( keys, keySizes[i] );
+            keys += keySizes[i];
+        }
+        return keyViews;
+    }
+
+    bool isLinearProbeFamily() const
+    {
+        return mCacheType != axoncache::CacheType::BUCKET_CHAIN && mCacheType != axoncache::CacheType::MAP && mCacheType != axoncache::CacheType::NONE;
+    }
+
+    // Like withLinearProbeCache, through the hot key cache when it is enabled and the cache has no
+    // compressed values
+    template<typename Lookup, typename Result>
+    Result withFrontCache( Lookup && lookup, Result missing )
+    {
+        if ( mIsHotKeyCacheEnabled )
+        {
+            auto hotKeyLookup = [&]( const auto & cache )
+            {
+                return cache.hasCompressedValues() ? lookup( cache ) : lookup( HotKeyCache( cache ) );
+            };
+            return withLinearProbeCache( hotKeyLookup, missing );
+        }
+        return withLinearProbeCache( lookup, missing );
+    }
+
+    // Runs lookup on the loaded cache of the linear probe family, or returns missing if none is loaded
+    template<typename Lookup, typename Result>
+    Result withLinearProbeCache( Lookup && lookup, Result missing )
+    {
         switch ( mCacheType )
         {
             case axoncache::CacheType::LINEAR_PROBE:
             {
-                auto cache = std::atomic_load( &mReaderLinearProbeCache );
-                if ( cache == nullptr )
+                if ( mHashFuncId == Constants::HashFuncId::WYHASH )
                 {
-                    return nullptr;
+                    const auto cache = std::atomic_load( &mReaderLinearProbeWyhashCache );
+                    return cache == nullptr ? missing : lookup( *cache );
                 }
-                return convertToPointer( cache->getKeyType( std::string_view{ key, keySize } ), valueSize );
+                const auto cache = std::atomic_load( &mReaderLinearProbeCache );
+                return cache == nullptr ? missing : lookup( *cache );
+            }
+            case axoncache::CacheType::LINEAR_PROBE_SIMD:
+            {
+                const auto cache = std::atomic_load( &mReaderLinearProbeSimdCache );
+                return cache == nullptr ? missing : lookup( *cache );
+            }
+            case axoncache::CacheType::PERFECT_HASH:
+            {
+                const auto cache = std::atomic_load( &mReaderPerfectHashCache );
+                return cache == nullptr ? missing : lookup( *cache );
+            }
+            case axoncache::CacheType::CUCKOO:
+            {
+                const auto cache = std::atomic_load( &mReaderCuckooCache );
+                return cache == nullptr ? missing : lookup( *cache );
+            }
+            case axoncache::CacheType::NUMERIC:
+            {
+                const auto cache = std::atomic_load( &mReaderNumericCache );
+                return cache == nullptr ? missing : lookup( *cache );
+            }
+            case axoncache::CacheType::EMBEDDING:
+            {
+                const auto cache = std::atomic_load( &mReaderEmbeddingCache );
+                return cache == nullptr ? missing : lookup( *cache );
             }
             case axoncache::CacheType::LINEAR_PROBE_DEDUP:
             case axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED:
             {
-                auto cache = std::atomic_load( &mReaderLinearProbeDedupCache );
-                if ( cache == nullptr )
-                {
-                    return nullptr;
-                }
-                return convertToPointer( cache->getKeyType( std::string_view{ key, keySize } ), valueSize );
+                const auto cache = std::atomic_load( &mReaderLinearProbeDedupCache );
+                return cache == nullptr ? missing : lookup( *cache );
             }
             case axoncache::CacheType::BUCKET_CHAIN:
             case axoncache::CacheType::MAP:
             case axoncache::CacheType::NONE:
             default:
-                return nullptr;
+                return missing;
         }
     }
 
-  private:
     std::shared_ptr<LinearProbeCache> mReaderLinearProbeCache;
+    std::shared_ptr<LinearProbeWyhashCache> mReaderLinearProbeWyhashCache;
+    std::shared_ptr<LinearProbeSimdCache> mReaderLinearProbeSimdCache;
+    std::shared_ptr<PerfectHashCache> mReaderPerfectHashCache;
+    std::shared_ptr<CuckooCache> mReaderCuckooCache;
+    std::shared_ptr<NumericCache> mReaderNumericCache;
+    std::shared_ptr<EmbeddingCache> mReaderEmbeddingCache;
     std::shared_ptr<LinearProbeDedupCache> mReaderLinearProbeDedupCache;
     std::shared_ptr<BucketChainCache> mReaderBucketChainCache;
     axoncache::CacheType mCacheType{ CacheType::LINEAR_PROBE_DEDUP };
+    uint16_t mHashFuncId{ Constants::HashFuncId::XXH3 };
+    bool mIsHotKeyCacheEnabled{ false };
 };
 
 typedef struct _CacheReaderHandle
@@ -643,9 +821,9 @@ void CacheReader_DeleteCppObject( CacheReaderHandle * handle )
     delete handle; // NOLINT
 }
 
-int CacheReader_Initialize( CacheReaderHandle * handle, const char * taskName, const char * destinationFolder, const char * timestamp, int isPreloadMemoryEnabled )
+int CacheReader_Initialize( CacheReaderHandle * handle, const char * taskName, const char * destinationFolder, const char * timestamp, int loadOptions )
 {
-    return handle->src->initializeReader( taskName, destinationFolder, timestamp, isPreloadMemoryEnabled );
+    return handle->src->initializeReader( taskName, destinationFolder, timestamp, ( loadOptions & CACHE_READER_PRELOAD_MEMORY ) != 0, ( loadOptions & CACHE_READER_HUGE_PAGES ) != 0, ( loadOptions & CACHE_READER_HOT_KEY_CACHE ) != 0 );
 }
 
 void CacheReader_Finalize( CacheReaderHandle * handle )
@@ -658,6 +836,41 @@ char * CacheReader_GetKey( CacheReaderHandle * handle, char * key, size_t keySiz
     return handle->src->getKey( key, keySize, isExist, valueSize );
 }
 
+uint64_t CacheReader_HashKey( CacheReaderHandle * handle, char * key, size_t keySize )
+{
+    return handle->src->hashKey( key, keySize );
+}
+
+int CacheReader_ContainsKeyWithHash( CacheReaderHandle * handle, char * key, size_t keySize, uint64_t hash )
+{
+    return handle->src->containsKeyWithHash( key, keySize, hash );
+}
+
+char * CacheReader_GetKeyWithHash( CacheReaderHandle * handle, char * key, size_t keySize, uint64_t hash, int * isExist, int * valueSize )
+{
+    return handle->src->getKeyWithHash( key, keySize, hash, isExist, valueSize );
+}
+
+int64_t CacheReader_GetLongWithHash( CacheReaderHandle * handle, char * key, size_t keySize, uint64_t hash, int * isExist, int64_t defaultValue )
+{
+    return handle->src->getLongWithHash( key, keySize, hash, isExist, defaultValue );
+}
+
+int CacheReader_GetIntegerWithHash( CacheReaderHandle * handle, char * key, size_t keySize, uint64_t hash, int * isExist, int defaultValue )
+{
+    return handle->src->getIntegerWithHash( key, keySize, hash, isExist, defaultValue );
+}
+
+double CacheReader_GetDoubleWithHash( CacheReaderHandle * handle, char * key, size_t keySize, uint64_t hash, int * isExist, double defaultValue )
+{
+    return handle->src->getDoubleWithHash( key, keySize, hash, isExist, defaultValue );
+}
+
+int CacheReader_GetBoolWithHash( CacheReaderHandle * handle, char * key, size_t keySize, uint64_t hash, int * isExist, int defaultValue )
+{
+    return handle->src->getBoolWithHash( key, keySize, hash, isExist, defaultValue );
+}
+
 char * CacheReader_GetVectorKey( CacheReaderHandle * handle, char * key, size_t keySize, int32_t index, int * valueSize )
 {
     return handle->src->getVectorKeyItem( key, keySize, index, valueSize );
@@ -703,10 +916,65 @@ float * CacheReader_GetFloatVector( CacheReaderHandle * handle, char * key, size
     return handle->src->getFloatVector( key, keySize, vectorSize );
 }
 
+int64_t * CacheReader_GetInt64List( CacheReaderHandle * handle, char * key, size_t keySize, int * listSize )
+{
+    return handle->src->getInt64List( key, keySize, listSize );
+}
+
+int CacheReader_ContainsInt64( CacheReaderHandle * handle, char * key, size_t keySize, int64_t id )
+{
+    return handle->src->containsInt64( key, keySize, id );
+}
+
+int CacheReader_BitmapContains( CacheReaderHandle * handle, char * key, size_t keySize, uint32_t value )
+{
+    return handle->src->bitmapContains( key, keySize, value );
+}
+
+int64_t CacheReader_BitmapIntersectCount( CacheReaderHandle * handle, char * leftKey, size_t leftKeySize, char * rightKey, size_t rightKeySize )
+{
+    return handle->src->bitmapIntersectCount( leftKey, leftKeySize, rightKey, rightKeySize );
+}
+
+int CacheReader_BitmapContainsMany( CacheReaderHandle * handle, char * keys, const size_t * keySizes, size_t keyCount, uint32_t value, int * found )
+{
+    return handle->src->bitmapContainsMany( keys, keySizes, keyCount, value, found );
+}
+
 char * CacheReader_GetKeyType( CacheReaderHandle * handle, char * key, size_t keySize, int * valueSize )
 {
     return handle->src->getKeyType( key, keySize, valueSize );
 }
 
+float CacheReader_DotProduct( CacheReaderHandle * handle, char * key, size_t keySize, const float * query, size_t querySize, int * isExist )
+{
+    return handle->src->score( key, keySize, query, querySize, FloatListScore::DotProduct, isExist );
+}
+
+float CacheReader_CosineSimilarity( CacheReaderHandle * handle, char * key, size_t keySize, const float * query, size_t querySize, int * isExist )
+{
+    return handle->src->score( key, keySize, query, querySize, FloatListScore::Cosine, isExist );
+}
+
+int CacheReader_ScoreMany( CacheReaderHandle * handle, char * keys, const size_t * keySizes, size_t keyCount, const float * query, size_t querySize, int metric, float defaultScore, float * scores )
+{
+    return handle->src->scoreMany( keys, keySizes, keyCount, query, querySize, metric, defaultScore, scores );
+}
+
+int CacheReader_TopK( CacheReaderHandle * handle, char * keys, const size_t * keySizes, size_t keyCount, const float * query, size_t querySize, int metric, size_t k, int32_t * indexes, float * scores )
+{
+    return handle->src->topK( keys, keySizes, keyCount, query, querySize, metric, k, indexes, scores );
+}
+
+int CacheReader_GetEmbeddingDimension( CacheReaderHandle * handle )
+{
+    return handle->src->getEmbeddingDimension();
+}
+
+int CacheReader_GatherRows( CacheReaderHandle * handle, char * keys, const size_t * keySizes, size_t keyCount, float * out, size_t dimension )
+{
+    return handle->src->gatherRows( keys, keySizes, keyCount, out, dimension );
+}
+
 // NOLINTEND(cppcoreguidelines-pro-type-cstyle-cast)
 // NOLINTEND(modernize-use-trailing-return-type)
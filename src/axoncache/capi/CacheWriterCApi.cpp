@@ -20,11 +20,17 @@
 #include <axoncache/CacheGenerator.h>
 #include <axoncache/builder/CacheFileBuilder.h>
 #include <axoncache/cache/factory/CacheFactory.h>
+#include <axoncache/cache/hasher/HashFunc.h>
 #include <axoncache/loader/CacheOneTimeLoader.h>
 #include <axoncache/cache/BucketChainCache.h>
 #include <axoncache/cache/LinearProbeCache.h>
 #include <axoncache/cache/LinearProbeDedupCache.h>
+#include <axoncache/cache/probe/LinearProbe.h>
+#include <axoncache/cache/probe/SlotMapping.h>
 #include <axoncache/domain/CacheValue.h>
+#include <axoncache/transformer/FloatListQuantizer.h>
+#include <axoncache/transformer/Int64ListCodec.h>
+#include <axoncache/transformer/RoaringBitmap.h>
 #include <axoncache/transformer/TypeToString.h>
 #include <axoncache/logger/Logger.h>
 
@@ -67,6 +73,10 @@ struct CCacheOptions_s
     double maxLoadFactor;
     int cacheType;
     int offsetBits;
+    uint32_t headerFlags;
+    std::string slotMapping;
+    std::string hashFunc;
+    size_t frequentValues;
 };
 
 using CCacheOptions = struct CCacheOptions_s;
@@ -104,6 +114,17 @@ class AxonCacheWriter
 
         // FIXME: hack this is hard-coded
         ccacheOptions->maxLoadFactor = settings.getDouble( "ccache.max_load_factor", 0.5 );
+        ccacheOptions->headerFlags = settings.getBool( "ccache.robin_hood", false ) ? Constants::HeaderFlag::kRobinHood : 0U;
+        ccacheOptions->headerFlags |= settings.getBool( "ccache.negative_lookup_filter", false ) ? Constants::HeaderFlag::kNegativeLookupFilter : 0U;
+        ccacheOptions->headerFlags |= settings.getBool( "ccache.namespace_prefix", false ) ? Constants::HeaderFlag::kNamespacePrefix : 0U;
+        ccacheOptions->headerFlags |= settings.getBool( "ccache.key_fingerprint", false ) ? Constants::HeaderFlag::kKeyFingerprint : 0U;
+        ccacheOptions->headerFlags |= settings.getBool( "ccache.compressed_values", false ) ? Constants::HeaderFlag::kCompressedValues : 0U;
+        ccacheOptions->headerFlags |= settings.getBool( "ccache.indexed_string_lists", false ) ? Constants::HeaderFlag::kIndexedStringLists : 0U;
+        ccacheOptions->headerFlags |= settings.getBool( "ccache.shared_values", false ) ? Constants::HeaderFlag::kSharedValues : 0U;
+        ccacheOptions->headerFlags |= linear::valueAlignmentHeaderFlag( settings.getInt( "ccache.value_alignment", 0 ) );
+        ccacheOptions->slotMapping = settings.getString( "ccache.slot_mapping", "modulo" );
+        ccacheOptions->hashFunc = settings.getString( "ccache.hash_func", "xxh3" );
+        ccacheOptions->frequentValues = settings.getInt( "ccache.frequent_values", 0 );
 
         std::ostringstream oss;
         oss << "taskname: " << taskName
@@ -133,6 +154,7 @@ class AxonCacheWriter
         auto outputDirectory = mCCacheOptions.destinationFolder;
         auto maxLoadFactor = mCCacheOptions.maxLoadFactor;
         auto offsetBits = mCCacheOptions.offsetBits;
+        auto headerFlags = mCCacheOptions.headerFlags;
 
         if ( ( offsetBits < Constants::kMinLinearProbeOffsetBits ) || ( Constants::kMaxLinearProbeOffsetBits < offsetBits ) )
         {
@@ -141,7 +163,12 @@ class AxonCacheWriter
 
         try
         {
-            auto cache = CacheFactory::createCache( offsetBits, numberOfKeySlots, maxLoadFactor, cacheType );
+            headerFlags |= slotMappingHeaderFlag( mCCacheOptions.slotMapping );
+            auto cache = CacheFactory::createCache( offsetBits, numberOfKeySlots, maxLoadFactor, cacheType, headerFlags, hashFuncIdFromName( mCCacheOptions.hashFunc ) );
+            if ( mCCacheOptions.frequentValues != 0U && ( cacheType == CacheType::LINEAR_PROBE_DEDUP || cacheType == CacheType::LINEAR_PROBE_DEDUP_TYPED ) )
+            {
+                ( ( LinearProbeDedupCache * )cache.get() )->detectFrequentValues( mCCacheOptions.frequentValues );
+            }
 
             // make the cache file builder a member variable ; needs to be a pointer or compile errors
             mCacheFileBuilder = std::make_unique<CacheFileBuilder>(
@@ -213,6 +240,19 @@ class AxonCacheWriter
             auto actualValue = axoncache::stringViewToVector<float>( std::string_view{ value, valueSize }, ':', valueSize );
             keyValuePair.second = CacheValue( std::move( actualValue ) );
         }
+        else if ( FloatListQuantizer::isQuantized( valueType ) )
+        {
+            auto actualValue = axoncache::stringViewToVector<float>( std::string_view{ value, valueSize }, ':', valueSize );
+            keyValuePair.second = CacheValue( std::move( actualValue ), valueType );
+        }
+        else if ( valueType == CacheValueType::Int64List )
+        {
+            keyValuePair.second = CacheValue( parseAsInt64( std::string_view{ value, valueSize } ) );
+        }
+        else if ( valueType == CacheValueType::Bitmap )
+        {
+            keyValuePair.second = CacheValue( parseAsInt64( std::string_view{ value, valueSize } ), valueType );
+        }
         else if ( type == kStringNoNullType )
         {
             // Legacy C-Cache behavior: Truncate value at null if exist
@@ -327,6 +367,8 @@ class AxonCacheWriter
 
     int8_t finishCacheCreation()
     {
+        // Robin Hood placement rewrites maxCollisions, report the value that goes into the header
+        mCacheFileBuilder->cache()->finalize();
         mCacheInfo.setTotalKeys( mCacheFileBuilder->cache()->numberOfEntries() );
         mCacheInfo.setMaxCollisionCount( mCacheFileBuilder->cache()->maxCollisions() );
 
@@ -433,6 +475,18 @@ class AxonCacheWriter
             auto values = parseAsFloat( val, ':' );
             val = std::string{ ( const char * )values.data(), sizeof( float ) * values.size() };
         }
+        else if ( FloatListQuantizer::isQuantized( valueType ) )
+        {
+            val = FloatListQuantizer::quantize( parseAsFloat( val, ':' ), valueType );
+        }
+        else if ( valueType == CacheValueType::Int64List )
+        {
+            val = Int64ListCodec::encode( parseAsInt64( val ) );
+        }
+        else if ( valueType == CacheValueType::Bitmap )
+        {
+            val = RoaringBitmap::encode( parseAsInt64( val ) );
+        }
         mDuplicateValues.push_back( val );
     }
 
@@ -455,6 +509,12 @@ class AxonCacheWriter
     }
 
   private:
+    // Ids separated by ':', none for an empty string
+    static auto parseAsInt64( std::string_view arrayStr ) -> std::vector<int64_t>
+    {
+        return arrayStr.empty() ? std::vector<int64_t>{} : axoncache::stringViewToVector<int64_t>( arrayStr, ':', arrayStr.size() / 2U + 1U );
+    }
+
     auto parseAsFloat( const std::string & arrayStr, const char delimiter ) -> std::vector<float>
     {
         const auto arrayStrArray = StringUtils::split( delimiter, arrayStr );
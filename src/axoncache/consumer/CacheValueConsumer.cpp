@@ -43,6 +43,17 @@ auto CacheValueConsumer::consumeValue( CacheKeyValue keyValuePair ) -> PutStats
         case CacheValueType::FloatList:
             return cache()->put( keyValuePair.first, keyValuePair.second.asFloatList() );
 
+        case CacheValueType::Float16List:
+        case CacheValueType::BFloat16List:
+        case CacheValueType::Int8List:
+            return cache()->put( keyValuePair.first, keyValuePair.second.asFloatList(), keyValuePair.second.type() );
+
+        case CacheValueType::Int64List:
+            return cache()->put( keyValuePair.first, keyValuePair.second.asInt64List() );
+
+        case CacheValueType::Bitmap:
+            return cache()->put( keyValuePair.first, keyValuePair.second.asInt64List(), CacheValueType::Bitmap );
+
         default:
             break;
     }
@@ -32,6 +32,18 @@ CacheValue::CacheValue( std::vector<float> value ) :
     mType{ CacheValueType::FloatList }, mValue( std::move( value ) )
 {
 }
+CacheValue::CacheValue( std::vector<float> value, CacheValueType listType ) :
+    mType{ listType }, mValue( std::move( value ) )
+{
+}
+CacheValue::CacheValue( std::vector<int64_t> value ) :
+    mType{ CacheValueType::Int64List }, mValue( std::move( value ) )
+{
+}
+CacheValue::CacheValue( std::vector<int64_t> value, CacheValueType listType ) :
+    mType{ listType }, mValue( std::move( value ) )
+{
+}
 
 auto CacheValue::type() const -> CacheValueType
 {
@@ -78,6 +90,11 @@ auto CacheValue::asFloatList() const -> const std::vector<float> &
     return std::get<std::vector<float>>( mValue );
 }
 
+auto CacheValue::asInt64List() const -> const std::vector<int64_t> &
+{
+    return std::get<std::vector<int64_t>>( mValue );
+}
+
 auto CacheValue::toDebugString() const -> std::string
 {
     std::string valueStr;
@@ -115,6 +132,9 @@ auto CacheValue::toDebugString() const -> std::string
             valueStr = std::to_string( asInt64() );
             break;
         case CacheValueType::FloatList:
+        case CacheValueType::Float16List:
+        case CacheValueType::BFloat16List:
+        case CacheValueType::Int8List:
             valueStr += "[";
             for ( const auto & value : std::get<std::vector<float>>( mValue ) )
             {
@@ -124,6 +144,17 @@ auto CacheValue::toDebugString() const -> std::string
             }
             valueStr += "]";
             break;
+        case CacheValueType::Int64List:
+        case CacheValueType::Bitmap:
+            valueStr += "[";
+            for ( const auto & value : asInt64List() )
+            {
+                valueStr += prefix;
+                valueStr += std::to_string( value );
+                prefix = ", ";
+            }
+            valueStr += "]";
+            break;
         default:
             valueStr = "null";
             break;
@@ -155,7 +186,13 @@ auto CacheValue::operator==( const CacheValue & rhs ) const -> bool
         case CacheValueType::Int64:
             return asInt64() == rhs.asInt64();
         case CacheValueType::FloatList:
+        case CacheValueType::Float16List:
+        case CacheValueType::BFloat16List:
+        case CacheValueType::Int8List:
             return asFloatList() == rhs.asFloatList();
+        case CacheValueType::Int64List:
+        case CacheValueType::Bitmap:
+            return asInt64List() == rhs.asInt64List();
         default:
             break;
     }
@@ -2,6 +2,7 @@
 // Copyright (c) 2025 AppLovin. All rights reserved.
 
 #include "axoncache/memory/MemoryHandler.h"
+#include <algorithm>
 
 using namespace axoncache;
 
@@ -22,3 +23,8 @@ auto MemoryHandler::grow( uint64_t growByBytes ) -> uint8_t *
     mDataSize += growByBytes;
     return mData + oldOffset;
 }
+
+auto MemoryHandler::truncate( uint64_t newSize ) -> void
+{
+    mDataSize = std::min( mDataSize, newSize );
+}
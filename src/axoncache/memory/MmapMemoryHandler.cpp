@@ -8,19 +8,89 @@
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#include <cstdint>
 #include <cstring>
 #include <stdexcept>
 #include <string>
 #include <sstream>
+#include <utility>
 
 using namespace axoncache;
 
-MmapMemoryHandler::MmapMemoryHandler( const CacheHeader & header, const std::string & cacheFile, bool isPreloadMemoryEnabled ) :
+namespace
+{
+constexpr uint64_t kHugePageSize = 2UL << 20U;
+
+// Anonymous read-write memory aligned to a huge page. Takes pages from the hugetlbfs pool when it
+// has room, otherwise asks for transparent huge pages, which the kernel may not grant.
+auto mapHugePages( uint64_t size ) -> std::pair<uint8_t *, uint64_t>
+{
+#if defined( __linux__ )
+    const auto mappedSize = ( size + kHugePageSize - 1 ) & ~( kHugePageSize - 1 );
+    auto * result = mmap( nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+    if ( result != MAP_FAILED ) // NOLINT
+    {
+        return { ( uint8_t * )result, mappedSize };
+    }
+
+    // One extra huge page so the region can be trimmed to start on a huge page boundary
+    result = mmap( nullptr, mappedSize + kHugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if ( result == MAP_FAILED ) // NOLINT
+    {
+        return { nullptr, 0 };
+    }
+
+    auto * raw = ( uint8_t * )result;
+    auto * aligned = ( uint8_t * )( ( ( uintptr_t )raw + kHugePageSize - 1 ) & ~( kHugePageSize - 1 ) );
+    if ( aligned != raw )
+    {
+        munmap( raw, aligned - raw );
+    }
+    const auto tailSize = ( raw + mappedSize + kHugePageSize ) - ( aligned + mappedSize );
+    if ( tailSize != 0 )
+    {
+        munmap( aligned + mappedSize, tailSize );
+    }
+
+    if ( madvise( aligned, mappedSize, MADV_HUGEPAGE ) != 0 )
+    {
+        AL_LOG_WARN( std::string( "madvise MADV_HUGEPAGE failed, the cache copy uses regular pages: " ) + strerror( errno ) );
+    }
+    return { aligned, mappedSize };
+#else
+    static_cast<void>( size );
+    return { nullptr, 0 };
+#endif
+}
+
+auto readFully( int fd, uint8_t * destination, uint64_t size ) -> bool
+{
+    uint64_t position = 0;
+    while ( position < size )
+    {
+        const auto result = pread( fd, destination + position, size - position, static_cast<off_t>( position ) );
+        if ( result < 0 && errno == EINTR )
+        {
+            continue;
+        }
+        if ( result <= 0 )
+        {
+            return false;
+        }
+        position += static_cast<uint64_t>( result );
+    }
+    return true;
+}
+}
+
+MmapMemoryHandler::MmapMemoryHandler( const CacheHeader & header, const std::string & cacheFile, bool isPreloadMemoryEnabled, bool isHugePagesEnabled ) :
     mHeaderSize( header.headerSize )
 {
-    auto mmapResult = loadMmap( header, cacheFile, isPreloadMemoryEnabled );
-    mBasePointer = mmapResult.first;
-    mBaseSize = mmapResult.second;
+    const auto mapping = loadMmap( header, cacheFile, isPreloadMemoryEnabled, isHugePagesEnabled );
+    mBasePointer = mapping.basePointer;
+    mBaseSize = mapping.fileSize;
+    mMappedSize = mapping.mappedSize;
+    mIsHugePageBacked = mapping.isHugePageBacked;
 
     setData( mBasePointer + mHeaderSize );
     setDataSize( mBaseSize - mHeaderSize );
@@ -30,7 +100,7 @@ MmapMemoryHandler::~MmapMemoryHandler()
 {
     if ( mBasePointer != nullptr )
     {
-        munmap( mBasePointer, mBaseSize );
+        munmap( mBasePointer, mMappedSize );
     }
 }
 
@@ -47,7 +117,7 @@ auto MmapMemoryHandler::resizeToFit( uint64_t /* newSize */ ) -> void
     throw std::runtime_error( "MmapMemoryHandler::resizeToFit() not implemented" );
 }
 
-auto MmapMemoryHandler::loadMmap( const CacheHeader & header, const std::string & cacheFile, [[maybe_unused]] bool isPreloadMemoryEnabled ) -> std::pair<uint8_t *, size_t>
+auto MmapMemoryHandler::loadMmap( const CacheHeader & header, const std::string & cacheFile, [[maybe_unused]] bool isPreloadMemoryEnabled, bool isHugePagesEnabled ) -> Mapping
 {
     auto fd = open( cacheFile.c_str(), O_RDONLY ); // NOLINT
     if ( fd == -1 )
@@ -56,7 +126,7 @@ auto MmapMemoryHandler::loadMmap( const CacheHeader & header, const std::string
         oss << "opening file failed: " << cacheFile
             << " error " << strerror( errno );
         AL_LOG_ERROR( oss.str() );
-        return { nullptr, 0 };
+        return { nullptr, 0, 0, false };
     }
 
     struct stat st{};
@@ -64,7 +134,7 @@ auto MmapMemoryHandler::loadMmap( const CacheHeader & header, const std::string
     {
         AL_LOG_ERROR( "fstat failed for " + cacheFile );
         close( fd );
-        return { nullptr, 0 };
+        return { nullptr, 0, 0, false };
     }
 
     const auto fileSize = st.st_size;
@@ -72,7 +142,23 @@ auto MmapMemoryHandler::loadMmap( const CacheHeader & header, const std::string
     {
         AL_LOG_ERROR( "Cache has invalid size " + cacheFile );
         close( fd );
-        return { nullptr, 0 };
+        return { nullptr, 0, 0, false };
+    }
+
+    if ( isHugePagesEnabled )
+    {
+        const auto [hugePagePtr, mappedSize] = mapHugePages( fileSize );
+        if ( hugePagePtr != nullptr && readFully( fd, hugePagePtr, fileSize ) && mprotect( hugePagePtr, mappedSize, PROT_READ ) == 0 )
+        {
+            close( fd );
+            return { hugePagePtr, static_cast<uint64_t>( fileSize ), mappedSize, true };
+        }
+
+        AL_LOG_WARN( "huge page copy failed for " + cacheFile + ", falling back to mmap" );
+        if ( hugePagePtr != nullptr )
+        {
+            munmap( hugePagePtr, mappedSize );
+        }
     }
 
 #if defined( __APPLE__ )
@@ -97,10 +183,10 @@ auto MmapMemoryHandler::loadMmap( const CacheHeader & header, const std::string
             << " error " << strerror( errno );
         AL_LOG_ERROR( oss.str() );
         close( fd );
-        return { nullptr, 0 };
+        return { nullptr, 0, 0, false };
     }
 
     close( fd );
 
-    return { ( uint8_t * )result, fileSize };
+    return { ( uint8_t * )result, static_cast<uint64_t>( fileSize ), static_cast<uint64_t>( fileSize ), false };
 }
@@ -0,0 +1,293 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include "axoncache/transformer/FloatListMath.h"
+#include <cmath>
+#include <cstring>
+#include <sstream>
+#include "axoncache/logger/Logger.h"
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+#include <immintrin.h>
+#define AXONCACHE_SIMD_X86 1
+#elif defined( __aarch64__ )
+#include <arm_neon.h>
+#define AXONCACHE_SIMD_NEON 1
+#endif
+
+using namespace axoncache;
+
+namespace
+{
+enum class ListKind
+{
+    Float32,
+    Float16,
+    BFloat16,
+    Int8,
+};
+
+// Int8List sums are before the scale
+struct DotResult
+{
+    float dot;
+    float squaredNorm;
+};
+
+using DotFunc = DotResult ( * )( const uint8_t * bytes, const float * query, size_t count );
+
+template<ListKind kKind>
+auto listFloatAt( const uint8_t * bytes, size_t i ) -> float
+{
+    if constexpr ( kKind == ListKind::Float32 )
+    {
+        float value = 0;
+        std::memcpy( &value, bytes + i * sizeof( float ), sizeof( float ) );
+        return value;
+    }
+    else if constexpr ( kKind == ListKind::Int8 )
+    {
+        return static_cast<float>( static_cast<int8_t>( bytes[i] ) );
+    }
+    else
+    {
+        uint16_t bits = 0;
+        std::memcpy( &bits, bytes + i * sizeof( uint16_t ), sizeof( uint16_t ) );
+        return kKind == ListKind::Float16 ? FloatListQuantizer::fromHalf( bits ) : FloatListQuantizer::fromBFloat16( bits );
+    }
+}
+
+template<ListKind kKind>
+auto dotTail( const uint8_t * bytes, const float * query, size_t begin, size_t count, DotResult result ) -> DotResult
+{
+    for ( auto i = begin; i < count; ++i )
+    {
+        const auto value = listFloatAt<kKind>( bytes, i );
+        result.dot += value * query[i];
+        result.squaredNorm += value * value;
+    }
+    return result;
+}
+
+template<ListKind kKind>
+auto dotScalar( const uint8_t * bytes, const float * query, size_t count ) -> DotResult
+{
+    return dotTail<kKind>( bytes, query, 0U, count, DotResult{ 0.0F, 0.0F } );
+}
+
+#ifdef AXONCACHE_SIMD_X86
+template<ListKind kKind>
+__attribute__( ( target( "avx2,fma,f16c" ) ) ) inline auto load8Avx2( const uint8_t * bytes, size_t i ) -> __m256
+{
+    if constexpr ( kKind == ListKind::Float32 )
+    {
+        return _mm256_loadu_ps( reinterpret_cast<const float *>( bytes ) + i );
+    }
+    else if constexpr ( kKind == ListKind::Float16 )
+    {
+        return _mm256_cvtph_ps( _mm_loadu_si128( reinterpret_cast<const __m128i *>( bytes + i * sizeof( uint16_t ) ) ) );
+    }
+    else if constexpr ( kKind == ListKind::BFloat16 )
+    {
+        const auto bfloat16s = _mm_loadu_si128( reinterpret_cast<const __m128i *>( bytes + i * sizeof( uint16_t ) ) );
+        return _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_cvtepu16_epi32( bfloat16s ), 16 ) );
+    }
+    else
+    {
+        return _mm256_cvtepi32_ps( _mm256_cvtepi8_epi32( _mm_loadl_epi64( reinterpret_cast<const __m128i *>( bytes + i ) ) ) );
+    }
+}
+
+__attribute__( ( target( "avx2" ) ) ) inline auto sumAvx2( __m256 values ) -> float
+{
+    auto sum = _mm_add_ps( _mm256_castps256_ps128( values ), _mm256_extractf128_ps( values, 1 ) );
+    sum = _mm_hadd_ps( sum, sum );
+    sum = _mm_hadd_ps( sum, sum );
+    return _mm_cvtss_f32( sum );
+}
+
+// Two accumulators of 8 floats each, so consecutive FMAs don't wait on each other
+template<ListKind kKind>
+__attribute__( ( target( "avx2,fma,f16c" ) ) ) auto dotAvx2( const uint8_t * bytes, const float * query, size_t count ) -> DotResult
+{
+    auto dot0 = _mm256_setzero_ps();
+    auto dot1 = _mm256_setzero_ps();
+    auto norm0 = _mm256_setzero_ps();
+    auto norm1 = _mm256_setzero_ps();
+    size_t i = 0;
+    for ( ; i + 16U <= count; i += 16U )
+    {
+        const auto values0 = load8Avx2<kKind>( bytes, i );
+        const auto values1 = load8Avx2<kKind>( bytes, i + 8U );
+        dot0 = _mm256_fmadd_ps( values0, _mm256_loadu_ps( query + i ), dot0 );
+        dot1 = _mm256_fmadd_ps( values1, _mm256_loadu_ps( query + i + 8U ), dot1 );
+        norm0 = _mm256_fmadd_ps( values0, values0, norm0 );
+        norm1 = _mm256_fmadd_ps( values1, values1, norm1 );
+    }
+    if ( i + 8U <= count )
+    {
+        const auto values = load8Avx2<kKind>( bytes, i );
+        dot0 = _mm256_fmadd_ps( values, _mm256_loadu_ps( query + i ), dot0 );
+        norm0 = _mm256_fmadd_ps( values, values, norm0 );
+        i += 8U;
+    }
+    const DotResult result{ sumAvx2( _mm256_add_ps( dot0, dot1 ) ), sumAvx2( _mm256_add_ps( norm0, norm1 ) ) };
+    return dotTail<kKind>( bytes, query, i, count, result );
+}
+#endif
+
+#ifdef AXONCACHE_SIMD_NEON
+template<ListKind kKind>
+inline auto load8Neon( const uint8_t * bytes, size_t i ) -> float32x4x2_t
+{
+    if constexpr ( kKind == ListKind::Float32 )
+    {
+        const auto * floats = reinterpret_cast<const float *>( bytes ) + i;
+        return { vld1q_f32( floats ), vld1q_f32( floats + 4U ) };
+    }
+    else if constexpr ( kKind == ListKind::Float16 )
+    {
+        const auto * halves = reinterpret_cast<const uint16_t *>( bytes + i * sizeof( uint16_t ) );
+        return { vcvt_f32_f16( vreinterpret_f16_u16( vld1_u16( halves ) ) ), vcvt_f32_f16( vreinterpret_f16_u16( vld1_u16( halves + 4U ) ) ) };
+    }
+    else if constexpr ( kKind == ListKind::BFloat16 )
+    {
+        const auto * bfloat16s = reinterpret_cast<const uint16_t *>( bytes + i * sizeof( uint16_t ) );
+        return { vreinterpretq_f32_u32( vshll_n_u16( vld1_u16( bfloat16s ), 16 ) ), vreinterpretq_f32_u32( vshll_n_u16( vld1_u16( bfloat16s + 4U ), 16 ) ) };
+    }
+    else
+    {
+        const auto int16s = vmovl_s8( vld1_s8( reinterpret_cast<const int8_t *>( bytes + i ) ) );
+        return { vcvtq_f32_s32( vmovl_s16( vget_low_s16( int16s ) ) ), vcvtq_f32_s32( vmovl_s16( vget_high_s16( int16s ) ) ) };
+    }
+}
+
+template<ListKind kKind>
+auto dotNeon( const uint8_t * bytes, const float * query, size_t count ) -> DotResult
+{
+    auto dot0 = vdupq_n_f32( 0.0F );
+    auto dot1 = vdupq_n_f32( 0.0F );
+    auto norm0 = vdupq_n_f32( 0.0F );
+    auto norm1 = vdupq_n_f32( 0.0F );
+    size_t i = 0;
+    for ( ; i + 8U <= count; i += 8U )
+    {
+        const auto values = load8Neon<kKind>( bytes, i );
+        dot0 = vfmaq_f32( dot0, values.val[0], vld1q_f32( query + i ) );
+        dot1 = vfmaq_f32( dot1, values.val[1], vld1q_f32( query + i + 4U ) );
+        norm0 = vfmaq_f32( norm0, values.val[0], values.val[0] );
+        norm1 = vfmaq_f32( norm1, values.val[1], values.val[1] );
+    }
+    const DotResult result{ vaddvq_f32( vaddq_f32( dot0, dot1 ) ), vaddvq_f32( vaddq_f32( norm0, norm1 ) ) };
+    return dotTail<kKind>( bytes, query, i, count, result );
+}
+#endif
+
+struct DotKernels
+{
+    DotFunc float32;
+    DotFunc half;
+    DotFunc bfloat16;
+    DotFunc int8;
+    std::string_view name;
+};
+
+auto selectDotKernels() -> DotKernels
+{
+#if defined( AXONCACHE_SIMD_X86 )
+    if ( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) && __builtin_cpu_supports( "f16c" ) )
+    {
+        return { dotAvx2<ListKind::Float32>, dotAvx2<ListKind::Float16>, dotAvx2<ListKind::BFloat16>, dotAvx2<ListKind::Int8>, "avx2" };
+    }
+#elif defined( AXONCACHE_SIMD_NEON )
+    return { dotNeon<ListKind::Float32>, dotNeon<ListKind::Float16>, dotNeon<ListKind::BFloat16>, dotNeon<ListKind::Int8>, "neon" };
+#endif
+    return { dotScalar<ListKind::Float32>, dotScalar<ListKind::Float16>, dotScalar<ListKind::BFloat16>, dotScalar<ListKind::Int8>, "scalar" };
+}
+
+auto dotKernels() -> const DotKernels &
+{
+    static const DotKernels selection = selectDotKernels();
+    return selection;
+}
+
+// Dot product and squared norm of a list with query, with the Int8List scale applied
+auto dotWithNorm( std::string_view bytes, CacheValueType type, const float * query ) -> DotResult
+{
+    const auto & kernels = dotKernels();
+    const auto * data = reinterpret_cast<const uint8_t *>( bytes.data() );
+    const auto count = FloatListMath::size( bytes, type );
+    switch ( type )
+    {
+        case CacheValueType::FloatList:
+            return kernels.float32( data, query, count );
+        case CacheValueType::Float16List:
+            return kernels.half( data, query, count );
+        case CacheValueType::BFloat16List:
+            return kernels.bfloat16( data, query, count );
+        case CacheValueType::Int8List:
+        {
+            if ( count == 0U )
+            {
+                return { 0.0F, 0.0F };
+            }
+            float scale = 0;
+            std::memcpy( &scale, data, sizeof( scale ) );
+            const auto result = kernels.int8( data + sizeof( float ), query, count );
+            return { result.dot * scale, result.squaredNorm * scale * scale };
+        }
+        default:
+            throw std::runtime_error( "Can't score a " + to_string( type ) );
+    }
+}
+}
+
+auto FloatListMath::dot( std::string_view bytes, CacheValueType type, const float * query ) -> float
+{
+    return dotWithNorm( bytes, type, query ).dot;
+}
+
+auto FloatListMath::squaredNorm( std::span<const float> values ) -> float
+{
+    return dotKernels().float32( reinterpret_cast<const uint8_t *>( values.data() ), values.data(), values.size() ).dot;
+}
+
+auto FloatListMath::score( std::string_view key, std::pair<std::string_view, CacheValueType> valueAndType, std::span<const float> query, FloatListScore metric, float querySquaredNorm ) -> std::pair<float, bool>
+{
+    const auto [value, type] = valueAndType;
+    if ( value.empty() )
+    {
+        return std::make_pair( 0.0F, false );
+    }
+    if ( !isFloatList( type ) )
+    {
+        std::ostringstream oss;
+        oss << "Type mismatch for key " << key
+            << " expected " << to_string( CacheValueType::FloatList )
+            << " type in cache was " << to_string( type );
+        AL_LOG_ERROR( oss.str() );
+        return std::make_pair( 0.0F, false );
+    }
+    if ( size( value, type ) != query.size() )
+    {
+        std::ostringstream oss;
+        oss << "Size mismatch for key " << key
+            << " query has " << query.size()
+            << " floats, value has " << size( value, type );
+        AL_LOG_ERROR( oss.str() );
+        return std::make_pair( 0.0F, false );
+    }
+
+    const auto result = dotWithNorm( value, type, query.data() );
+    if ( metric == FloatListScore::DotProduct )
+    {
+        return std::make_pair( result.dot, true );
+    }
+    const auto norms = result.squaredNorm * querySquaredNorm;
+    return std::make_pair( norms > 0.0F ? result.dot / std::sqrt( norms ) : 0.0F, true );
+}
+
+auto FloatListMath::isaName() -> std::string_view
+{
+    return dotKernels().name;
+}
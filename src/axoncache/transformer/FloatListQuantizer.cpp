@@ -0,0 +1,345 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include "axoncache/transformer/FloatListQuantizer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+#include <immintrin.h>
+#define AXONCACHE_SIMD_X86 1
+#elif defined( __aarch64__ )
+#include <arm_neon.h>
+#define AXONCACHE_SIMD_NEON 1
+#endif
+
+using namespace axoncache;
+
+namespace
+{
+constexpr float kInt8Max = 127.0F;
+
+auto floatBits( float value ) -> uint32_t
+{
+    uint32_t bits = 0;
+    std::memcpy( &bits, &value, sizeof( bits ) );
+    return bits;
+}
+
+auto bitsFloat( uint32_t bits ) -> float
+{
+    float value = 0;
+    std::memcpy( &value, &bits, sizeof( value ) );
+    return value;
+}
+
+auto int8Scale( std::string_view bytes ) -> float
+{
+    float scale = 0;
+    std::memcpy( &scale, bytes.data(), sizeof( scale ) );
+    return scale;
+}
+
+// Dequantizes count values of bytes, scale is only used by Int8List
+using DequantizeFunc = void ( * )( const uint8_t * bytes, size_t count, float scale, float * out );
+
+auto dequantizeHalfScalar( const uint8_t * bytes, size_t count, float /* scale */, float * out ) -> void
+{
+    for ( size_t i = 0; i < count; ++i )
+    {
+        uint16_t half = 0;
+        std::memcpy( &half, bytes + i * sizeof( half ), sizeof( half ) );
+        out[i] = FloatListQuantizer::fromHalf( half );
+    }
+}
+
+auto dequantizeBFloat16Scalar( const uint8_t * bytes, size_t count, float /* scale */, float * out ) -> void
+{
+    for ( size_t i = 0; i < count; ++i )
+    {
+        uint16_t bfloat16 = 0;
+        std::memcpy( &bfloat16, bytes + i * sizeof( bfloat16 ), sizeof( bfloat16 ) );
+        out[i] = FloatListQuantizer::fromBFloat16( bfloat16 );
+    }
+}
+
+auto dequantizeInt8Scalar( const uint8_t * bytes, size_t count, float scale, float * out ) -> void
+{
+    for ( size_t i = 0; i < count; ++i )
+    {
+        out[i] = static_cast<float>( static_cast<int8_t>( bytes[i] ) ) * scale;
+    }
+}
+
+#ifdef AXONCACHE_SIMD_X86
+__attribute__( ( target( "avx2,f16c" ) ) ) auto dequantizeHalfAvx2( const uint8_t * bytes, size_t count, float scale, float * out ) -> void
+{
+    size_t i = 0;
+    for ( ; i + 8U <= count; i += 8U )
+    {
+        const auto halves = _mm_loadu_si128( reinterpret_cast<const __m128i *>( bytes + i * sizeof( uint16_t ) ) );
+        _mm256_storeu_ps( out + i, _mm256_cvtph_ps( halves ) );
+    }
+    dequantizeHalfScalar( bytes + i * sizeof( uint16_t ), count - i, scale, out + i );
+}
+
+__attribute__( ( target( "avx2" ) ) ) auto dequantizeBFloat16Avx2( const uint8_t * bytes, size_t count, float scale, float * out ) -> void
+{
+    size_t i = 0;
+    for ( ; i + 8U <= count; i += 8U )
+    {
+        const auto bfloat16s = _mm_loadu_si128( reinterpret_cast<const __m128i *>( bytes + i * sizeof( uint16_t ) ) );
+        const auto bits = _mm256_slli_epi32( _mm256_cvtepu16_epi32( bfloat16s ), 16 );
+        _mm256_storeu_ps( out + i, _mm256_castsi256_ps( bits ) );
+    }
+    dequantizeBFloat16Scalar( bytes + i * sizeof( uint16_t ), count - i, scale, out + i );
+}
+
+__attribute__( ( target( "avx2" ) ) ) auto dequantizeInt8Avx2( const uint8_t * bytes, size_t count, float scale, float * out ) -> void
+{
+    const auto scales = _mm256_set1_ps( scale );
+    size_t i = 0;
+    for ( ; i + 8U <= count; i += 8U )
+    {
+        const auto int8s = _mm_loadl_epi64( reinterpret_cast<const __m128i *>( bytes + i ) );
+        const auto floats = _mm256_cvtepi32_ps( _mm256_cvtepi8_epi32( int8s ) );
+        _mm256_storeu_ps( out + i, _mm256_mul_ps( floats, scales ) );
+    }
+    dequantizeInt8Scalar( bytes + i, count - i, scale, out + i );
+}
+#endif
+
+#ifdef AXONCACHE_SIMD_NEON
+auto dequantizeHalfNeon( const uint8_t * bytes, size_t count, float scale, float * out ) -> void
+{
+    size_t i = 0;
+    for ( ; i + 4U <= count; i += 4U )
+    {
+        const auto halves = vreinterpret_f16_u16( vld1_u16( reinterpret_cast<const uint16_t *>( bytes + i * sizeof( uint16_t ) ) ) );
+        vst1q_f32( out + i, vcvt_f32_f16( halves ) );
+    }
+    dequantizeHalfScalar( bytes + i * sizeof( uint16_t ), count - i, scale, out + i );
+}
+
+auto dequantizeBFloat16Neon( const uint8_t * bytes, size_t count, float scale, float * out ) -> void
+{
+    size_t i = 0;
+    for ( ; i + 4U <= count; i += 4U )
+    {
+        const auto bits = vshll_n_u16( vld1_u16( reinterpret_cast<const uint16_t *>( bytes + i * sizeof( uint16_t ) ) ), 16 );
+        vst1q_f32( out + i, vreinterpretq_f32_u32( bits ) );
+    }
+    dequantizeBFloat16Scalar( bytes + i * sizeof( uint16_t ), count - i, scale, out + i );
+}
+
+auto dequantizeInt8Neon( const uint8_t * bytes, size_t count, float scale, float * out ) -> void
+{
+    size_t i = 0;
+    for ( ; i + 8U <= count; i += 8U )
+    {
+        const auto int16s = vmovl_s8( vld1_s8( reinterpret_cast<const int8_t *>( bytes + i ) ) );
+        vst1q_f32( out + i, vmulq_n_f32( vcvtq_f32_s32( vmovl_s16( vget_low_s16( int16s ) ) ), scale ) );
+        vst1q_f32( out + i + 4U, vmulq_n_f32( vcvtq_f32_s32( vmovl_s16( vget_high_s16( int16s ) ) ), scale ) );
+    }
+    dequantizeInt8Scalar( bytes + i, count - i, scale, out + i );
+}
+#endif
+
+struct Dequantizers
+{
+    DequantizeFunc half;
+    DequantizeFunc bfloat16;
+    DequantizeFunc int8;
+    std::string_view name;
+};
+
+auto selectDequantizers() -> Dequantizers
+{
+#if defined( AXONCACHE_SIMD_X86 )
+    if ( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "f16c" ) )
+    {
+        return { dequantizeHalfAvx2, dequantizeBFloat16Avx2, dequantizeInt8Avx2, "avx2" };
+    }
+#elif defined( AXONCACHE_SIMD_NEON )
+    return { dequantizeHalfNeon, dequantizeBFloat16Neon, dequantizeInt8Neon, "neon" };
+#endif
+    return { dequantizeHalfScalar, dequantizeBFloat16Scalar, dequantizeInt8Scalar, "scalar" };
+}
+
+auto dequantizers() -> const Dequantizers &
+{
+    static const Dequantizers selection = selectDequantizers();
+    return selection;
+}
+}
+
+// Round to nearest even, out of range values become infinities and NaNs a quiet NaN
+auto FloatListQuantizer::toHalf( float value ) -> uint16_t
+{
+    constexpr uint32_t kInfinity = 255U << 23U;
+    constexpr uint32_t kHalfOverflow = ( 127U + 16U ) << 23U;
+    constexpr uint32_t kSubnormalMagic = ( ( 127U - 15U ) + ( 23U - 10U ) + 1U ) << 23U;
+
+    auto bits = floatBits( value );
+    const auto sign = bits & 0x80000000U;
+    bits ^= sign;
+    uint32_t half = 0;
+    if ( bits >= kHalfOverflow )
+    {
+        half = bits > kInfinity ? 0x7E00U : 0x7C00U;
+    }
+    else if ( bits < ( 113U << 23U ) )
+    {
+        // Adding the magic number lets the float addition round the subnormal half
+        half = floatBits( bitsFloat( bits ) + bitsFloat( kSubnormalMagic ) ) - kSubnormalMagic;
+    }
+    else
+    {
+        const auto isMantissaOdd = ( bits >> 13U ) & 1U;
+        bits += ( ( 15U - 127U ) << 23U ) + 0xFFFU + isMantissaOdd;
+        half = bits >> 13U;
+    }
+    return static_cast<uint16_t>( half | ( sign >> 16U ) );
+}
+
+auto FloatListQuantizer::fromHalf( uint16_t half ) -> float
+{
+    constexpr uint32_t kShiftedExponent = 0x7C00U << 13U;
+
+    auto bits = static_cast<uint32_t>( half & 0x7FFFU ) << 13U;
+    const auto exponent = bits & kShiftedExponent;
+    bits += ( 127U - 15U ) << 23U;
+    if ( exponent == kShiftedExponent )
+    {
+        bits += ( 128U - 16U ) << 23U;
+    }
+    else if ( exponent == 0U )
+    {
+        bits += 1U << 23U;
+        bits = floatBits( bitsFloat( bits ) - bitsFloat( 113U << 23U ) );
+    }
+    return bitsFloat( bits | ( static_cast<uint32_t>( half & 0x8000U ) << 16U ) );
+}
+
+// Round to nearest even, NaNs stay quiet NaNs
+auto FloatListQuantizer::toBFloat16( float value ) -> uint16_t
+{
+    const auto bits = floatBits( value );
+    if ( std::isnan( value ) )
+    {
+        return static_cast<uint16_t>( ( bits >> 16U ) | 0x40U );
+    }
+    return static_cast<uint16_t>( ( bits + 0x7FFFU + ( ( bits >> 16U ) & 1U ) ) >> 16U );
+}
+
+auto FloatListQuantizer::fromBFloat16( uint16_t bfloat16 ) -> float
+{
+    return bitsFloat( static_cast<uint32_t>( bfloat16 ) << 16U );
+}
+
+auto FloatListQuantizer::quantize( const std::vector<float> & values, CacheValueType type ) -> std::string
+{
+    std::string bytes;
+    switch ( type )
+    {
+        case CacheValueType::Float16List:
+        case CacheValueType::BFloat16List:
+        {
+            bytes.resize( values.size() * sizeof( uint16_t ) );
+            for ( size_t i = 0; i < values.size(); ++i )
+            {
+                const auto quantized = type == CacheValueType::Float16List ? toHalf( values[i] ) : toBFloat16( values[i] );
+                std::memcpy( bytes.data() + i * sizeof( uint16_t ), &quantized, sizeof( quantized ) );
+            }
+            return bytes;
+        }
+        case CacheValueType::Int8List:
+        {
+            if ( values.empty() )
+            {
+                return bytes;
+            }
+            float maxAbs = 0;
+            for ( const auto value : values )
+            {
+                if ( !std::isfinite( value ) )
+                {
+                    throw std::runtime_error( "Int8List values must be finite" );
+                }
+                maxAbs = std::max( maxAbs, std::fabs( value ) );
+            }
+            const auto scale = maxAbs / kInt8Max;
+            bytes.resize( sizeof( scale ) + values.size() );
+            std::memcpy( bytes.data(), &scale, sizeof( scale ) );
+            for ( size_t i = 0; i < values.size(); ++i )
+            {
+                const auto quantized = scale == 0 ? 0L : std::lrint( values[i] / scale );
+                bytes[sizeof( scale ) + i] = static_cast<char>( std::clamp( quantized, -127L, 127L ) );
+            }
+            return bytes;
+        }
+        default:
+            break;
+    }
+    throw std::runtime_error( "Can't quantize a FloatList to " + to_string( type ) );
+}
+
+auto FloatListQuantizer::size( std::string_view bytes, CacheValueType type ) -> size_t
+{
+    if ( type == CacheValueType::Int8List )
+    {
+        return bytes.size() > sizeof( float ) ? bytes.size() - sizeof( float ) : 0U;
+    }
+    return bytes.size() / sizeof( uint16_t );
+}
+
+auto FloatListQuantizer::dequantize( std::string_view bytes, CacheValueType type, float * out ) -> void
+{
+    const auto & selection = dequantizers();
+    const auto * data = reinterpret_cast<const uint8_t *>( bytes.data() );
+    const auto count = size( bytes, type );
+    switch ( type )
+    {
+        case CacheValueType::Float16List:
+            selection.half( data, count, 0, out );
+            break;
+        case CacheValueType::BFloat16List:
+            selection.bfloat16( data, count, 0, out );
+            break;
+        case CacheValueType::Int8List:
+            if ( count != 0U )
+            {
+                selection.int8( data + sizeof( float ), count, int8Scale( bytes ), out );
+            }
+            break;
+        default:
+            throw std::runtime_error( "Can't dequantize a " + to_string( type ) );
+    }
+}
+
+auto FloatListQuantizer::at( std::string_view bytes, CacheValueType type, size_t index ) -> float
+{
+    float value = 0;
+    switch ( type )
+    {
+        case CacheValueType::Float16List:
+            dequantizeHalfScalar( reinterpret_cast<const uint8_t *>( bytes.data() ) + index * sizeof( uint16_t ), 1U, 0, &value );
+            break;
+        case CacheValueType::BFloat16List:
+            dequantizeBFloat16Scalar( reinterpret_cast<const uint8_t *>( bytes.data() ) + index * sizeof( uint16_t ), 1U, 0, &value );
+            break;
+        case CacheValueType::Int8List:
+            dequantizeInt8Scalar( reinterpret_cast<const uint8_t *>( bytes.data() ) + sizeof( float ) + index, 1U, int8Scale( bytes ), &value );
+            break;
+        default:
+            throw std::runtime_error( "Can't dequantize a " + to_string( type ) );
+    }
+    return value;
+}
+
+auto FloatListQuantizer::isaName() -> std::string_view
+{
+    return dequantizers().name;
+}
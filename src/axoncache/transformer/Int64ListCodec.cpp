@@ -0,0 +1,335 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include "axoncache/transformer/Int64ListCodec.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+#include <immintrin.h>
+#define AXONCACHE_SIMD_X86 1
+#elif defined( __aarch64__ )
+#include <arm_neon.h>
+#define AXONCACHE_SIMD_NEON 1
+#endif
+
+using namespace axoncache;
+
+namespace
+{
+constexpr size_t kInt64ListHeaderSize = 2U * sizeof( uint32_t );
+
+template<typename T>
+auto loadAt( std::string_view bytes, size_t offset ) -> T
+{
+    T value{};
+    std::memcpy( &value, bytes.data() + offset, sizeof( value ) );
+    return value;
+}
+
+template<typename T>
+auto storeAt( std::string & bytes, size_t offset, T value ) -> void
+{
+    std::memcpy( bytes.data() + offset, &value, sizeof( value ) );
+}
+
+auto blockCount( size_t count ) -> size_t
+{
+    return ( count + Int64ListCodec::kBlockSize - 1U ) / Int64ListCodec::kBlockSize;
+}
+
+auto offsetsOffset( size_t blocks ) -> size_t
+{
+    return kInt64ListHeaderSize + blocks * sizeof( int64_t );
+}
+
+auto blocksOffset( size_t blocks ) -> size_t
+{
+    return offsetsOffset( blocks ) + blocks * sizeof( uint32_t );
+}
+
+auto firstValue( std::string_view bytes, size_t block ) -> int64_t
+{
+    return loadAt<int64_t>( bytes, kInt64ListHeaderSize + block * sizeof( int64_t ) );
+}
+
+auto deltaSize( uint32_t delta ) -> uint32_t
+{
+    return delta < ( 1U << 8U ) ? 1U : ( delta < ( 1U << 16U ) ? 2U : ( delta < ( 1U << 24U ) ? 3U : 4U ) );
+}
+
+// For each control byte, the byte of the data each byte of 4 uint32 deltas comes from, 0xFF for
+// the zeroed high bytes, and the number of data bytes of the 4 deltas
+struct StreamVByteTables
+{
+    std::array<std::array<uint8_t, 16>, 256> shuffles;
+    std::array<uint8_t, 256> lengths;
+};
+
+constexpr auto makeStreamVByteTables() -> StreamVByteTables
+{
+    StreamVByteTables tables{};
+    for ( uint32_t control = 0; control < 256U; ++control )
+    {
+        uint32_t position = 0;
+        for ( uint32_t lane = 0; lane < 4U; ++lane )
+        {
+            const auto size = ( ( control >> ( 2U * lane ) ) & 3U ) + 1U;
+            for ( uint32_t byte = 0; byte < 4U; ++byte )
+            {
+                tables.shuffles[control][lane * 4U + byte] = static_cast<uint8_t>( byte < size ? position + byte : 0xFFU );
+            }
+            position += size;
+        }
+        tables.lengths[control] = static_cast<uint8_t>( position );
+    }
+    return tables;
+}
+
+constexpr StreamVByteTables kStreamVByteTables = makeStreamVByteTables();
+
+// Decodes count deltas into out. dataEnd bounds the 16-byte loads of the SIMD versions.
+using DeltaDecodeFunc = auto ( * )( const uint8_t * control, const uint8_t * data, const uint8_t * dataEnd, size_t count, uint32_t * out ) -> void;
+
+auto decodeDeltasFrom( const uint8_t * control, const uint8_t * data, size_t begin, size_t count, uint32_t * out ) -> void
+{
+    for ( size_t i = begin; i < count; ++i )
+    {
+        const auto size = ( ( control[i / 4U] >> ( 2U * ( i % 4U ) ) ) & 3U ) + 1U;
+        uint32_t delta = 0;
+        std::memcpy( &delta, data, size );
+        data += size;
+        out[i] = delta;
+    }
+}
+
+auto decodeDeltasScalar( const uint8_t * control, const uint8_t * data, const uint8_t * /* dataEnd */, size_t count, uint32_t * out ) -> void
+{
+    decodeDeltasFrom( control, data, 0U, count, out );
+}
+
+#if defined( AXONCACHE_SIMD_X86 )
+__attribute__( ( target( "ssse3" ) ) ) auto decodeDeltasSsse3( const uint8_t * control, const uint8_t * data, const uint8_t * dataEnd, size_t count, uint32_t * out ) -> void
+{
+    size_t i = 0;
+    for ( ; i + 4U <= count && data + 16U <= dataEnd; i += 4U )
+    {
+        const auto bits = control[i / 4U];
+        const auto shuffle = _mm_loadu_si128( reinterpret_cast<const __m128i *>( kStreamVByteTables.shuffles[bits].data() ) );
+        const auto deltas = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i *>( data ) ), shuffle );
+        _mm_storeu_si128( reinterpret_cast<__m128i *>( out + i ), deltas );
+        data += kStreamVByteTables.lengths[bits];
+    }
+    decodeDeltasFrom( control, data, i, count, out );
+}
+#elif defined( AXONCACHE_SIMD_NEON )
+auto decodeDeltasNeon( const uint8_t * control, const uint8_t * data, const uint8_t * dataEnd, size_t count, uint32_t * out ) -> void
+{
+    size_t i = 0;
+    for ( ; i + 4U <= count && data + 16U <= dataEnd; i += 4U )
+    {
+        const auto bits = control[i / 4U];
+        const auto deltas = vqtbl1q_u8( vld1q_u8( data ), vld1q_u8( kStreamVByteTables.shuffles[bits].data() ) );
+        vst1q_u8( reinterpret_cast<uint8_t *>( out + i ), deltas );
+        data += kStreamVByteTables.lengths[bits];
+    }
+    decodeDeltasFrom( control, data, i, count, out );
+}
+#endif
+
+struct DeltaDecoder
+{
+    DeltaDecodeFunc decode;
+    std::string_view name;
+};
+
+auto selectDeltaDecoder() -> DeltaDecoder
+{
+#if defined( AXONCACHE_SIMD_X86 )
+    if ( __builtin_cpu_supports( "ssse3" ) )
+    {
+        return { decodeDeltasSsse3, "ssse3" };
+    }
+#elif defined( AXONCACHE_SIMD_NEON )
+    return { decodeDeltasNeon, "neon" };
+#endif
+    return { decodeDeltasScalar, "scalar" };
+}
+
+auto deltaDecoder() -> const DeltaDecoder &
+{
+    static const DeltaDecoder selection = selectDeltaDecoder();
+    return selection;
+}
+
+// Adds the deltas to out[0], zigzag decoding them for unsorted lists
+template<typename Delta>
+auto prefixSum( const Delta * deltas, size_t count, bool isSorted, int64_t * out ) -> void
+{
+    auto previous = static_cast<uint64_t>( out[0] );
+    if ( isSorted )
+    {
+        for ( size_t i = 0; i < count; ++i )
+        {
+            previous += deltas[i];
+            out[i + 1U] = static_cast<int64_t>( previous );
+        }
+        return;
+    }
+    for ( size_t i = 0; i < count; ++i )
+    {
+        const auto delta = static_cast<uint64_t>( deltas[i] );
+        previous += ( delta >> 1U ) ^ ( 0U - ( delta & 1U ) );
+        out[i + 1U] = static_cast<int64_t>( previous );
+    }
+}
+}
+
+auto Int64ListCodec::encode( const std::vector<int64_t> & values ) -> std::string
+{
+    if ( values.size() > std::numeric_limits<uint32_t>::max() )
+    {
+        throw std::runtime_error( "Int64List can't hold " + std::to_string( values.size() ) + " values" );
+    }
+    const auto count = values.size();
+    const auto blocks = blockCount( count );
+    const auto isSortedList = std::is_sorted( values.begin(), values.end() );
+    std::string bytes( blocksOffset( blocks ), '\0' );
+    storeAt( bytes, 0U, static_cast<uint32_t>( count ) );
+    storeAt( bytes, sizeof( uint32_t ), isSortedList ? kSorted : 0U );
+
+    std::vector<uint64_t> deltas;
+    deltas.reserve( kBlockSize );
+    for ( size_t block = 0; block < blocks; ++block )
+    {
+        const auto begin = block * kBlockSize;
+        const auto end = std::min( count, begin + kBlockSize );
+        storeAt( bytes, kInt64ListHeaderSize + block * sizeof( int64_t ), values[begin] );
+        storeAt( bytes, offsetsOffset( blocks ) + block * sizeof( uint32_t ), static_cast<uint32_t>( bytes.size() - blocksOffset( blocks ) ) );
+
+        deltas.clear();
+        bool isSmall = true;
+        for ( size_t i = begin + 1U; i < end; ++i )
+        {
+            auto delta = static_cast<uint64_t>( values[i] ) - static_cast<uint64_t>( values[i - 1U] );
+            if ( !isSortedList )
+            {
+                delta = ( delta << 1U ) ^ static_cast<uint64_t>( static_cast<int64_t>( delta ) >> 63U );
+            }
+            isSmall = isSmall && delta <= std::numeric_limits<uint32_t>::max();
+            deltas.push_back( delta );
+        }
+
+        if ( !isSmall )
+        {
+            bytes.push_back( static_cast<char>( kRaw ) );
+            for ( const auto delta : deltas )
+            {
+                bytes.append( reinterpret_cast<const char *>( &delta ), sizeof( delta ) );
+            }
+            continue;
+        }
+        bytes.push_back( static_cast<char>( kStreamVByte ) );
+        const auto controlOffset = bytes.size();
+        bytes.append( ( deltas.size() + 3U ) / 4U, '\0' );
+        for ( size_t i = 0; i < deltas.size(); ++i )
+        {
+            const auto delta = static_cast<uint32_t>( deltas[i] );
+            const auto size = deltaSize( delta );
+            bytes[controlOffset + i / 4U] = static_cast<char>( static_cast<uint8_t>( bytes[controlOffset + i / 4U] ) | ( ( size - 1U ) << ( 2U * ( i % 4U ) ) ) );
+            bytes.append( reinterpret_cast<const char *>( &delta ), size );
+        }
+    }
+    return bytes;
+}
+
+auto Int64ListCodec::size( std::string_view bytes ) -> size_t
+{
+    return bytes.size() < kInt64ListHeaderSize ? 0U : loadAt<uint32_t>( bytes, 0U );
+}
+
+auto Int64ListCodec::isSorted( std::string_view bytes ) -> bool
+{
+    return bytes.size() >= kInt64ListHeaderSize && ( loadAt<uint32_t>( bytes, sizeof( uint32_t ) ) & kSorted ) != 0U;
+}
+
+auto Int64ListCodec::decodeBlock( std::string_view bytes, size_t block, int64_t * out ) -> size_t
+{
+    const auto count = size( bytes );
+    const auto blocks = blockCount( count );
+    const auto blockValues = std::min( kBlockSize, count - block * kBlockSize );
+    const auto * data = reinterpret_cast<const uint8_t *>( bytes.data() ) + blocksOffset( blocks ) + loadAt<uint32_t>( bytes, offsetsOffset( blocks ) + block * sizeof( uint32_t ) );
+    const auto deltaCount = blockValues - 1U;
+    out[0] = firstValue( bytes, block );
+    if ( *data == kRaw )
+    {
+        std::array<uint64_t, kBlockSize> deltas;
+        std::memcpy( deltas.data(), data + 1U, deltaCount * sizeof( uint64_t ) );
+        prefixSum( deltas.data(), deltaCount, isSorted( bytes ), out );
+        return blockValues;
+    }
+    std::array<uint32_t, kBlockSize> deltas;
+    const auto * control = data + 1U;
+    deltaDecoder().decode( control, control + ( deltaCount + 3U ) / 4U, reinterpret_cast<const uint8_t *>( bytes.data() + bytes.size() ), deltaCount, deltas.data() );
+    prefixSum( deltas.data(), deltaCount, isSorted( bytes ), out );
+    return blockValues;
+}
+
+auto Int64ListCodec::decode( std::string_view bytes, int64_t * out ) -> void
+{
+    const auto blocks = blockCount( size( bytes ) );
+    for ( size_t block = 0; block < blocks; ++block )
+    {
+        decodeBlock( bytes, block, out + block * kBlockSize );
+    }
+}
+
+auto Int64ListCodec::contains( std::string_view bytes, int64_t value ) -> bool
+{
+    const auto blocks = blockCount( size( bytes ) );
+    std::array<int64_t, kBlockSize> values;
+    if ( isSorted( bytes ) )
+    {
+        // One past the last block starting at or below value
+        size_t low = 0;
+        size_t high = blocks;
+        while ( low < high )
+        {
+            const auto middle = ( low + high ) / 2U;
+            if ( firstValue( bytes, middle ) <= value )
+            {
+                low = middle + 1U;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        if ( low == 0U )
+        {
+            return false;
+        }
+        if ( firstValue( bytes, low - 1U ) == value )
+        {
+            return true;
+        }
+        const auto blockValues = decodeBlock( bytes, low - 1U, values.data() );
+        return std::binary_search( values.begin(), values.begin() + static_cast<std::ptrdiff_t>( blockValues ), value );
+    }
+    for ( size_t block = 0; block < blocks; ++block )
+    {
+        const auto blockValues = decodeBlock( bytes, block, values.data() );
+        if ( std::find( values.begin(), values.begin() + static_cast<std::ptrdiff_t>( blockValues ), value ) != values.begin() + static_cast<std::ptrdiff_t>( blockValues ) )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+auto Int64ListCodec::isaName() -> std::string_view
+{
+    return deltaDecoder().name;
+}
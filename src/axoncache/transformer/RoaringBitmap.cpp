@@ -0,0 +1,366 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include "axoncache/transformer/RoaringBitmap.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+#include <immintrin.h>
+#define AXONCACHE_SIMD_X86 1
+#elif defined( __aarch64__ )
+#include <arm_neon.h>
+#define AXONCACHE_SIMD_NEON 1
+#endif
+
+using namespace axoncache;
+
+namespace
+{
+constexpr size_t kBitmapHeaderSize = 2U * sizeof( uint32_t );
+constexpr size_t kBitsetBytes = RoaringBitmap::kBitsetWords * sizeof( uint64_t );
+
+template<typename T>
+auto bitmapLoad( const uint8_t * data ) -> T
+{
+    T value{};
+    std::memcpy( &value, data, sizeof( value ) );
+    return value;
+}
+
+struct BitmapContainer
+{
+    uint16_t key;
+    uint32_t cardinality;
+    const uint8_t * data;
+
+    [[nodiscard]] auto isBitset() const -> bool
+    {
+        return cardinality > RoaringBitmap::kArrayMaxCardinality;
+    }
+};
+
+auto bitmapContainerCount( std::string_view bytes ) -> size_t
+{
+    return bytes.size() < kBitmapHeaderSize ? 0U : bitmapLoad<uint32_t>( reinterpret_cast<const uint8_t *>( bytes.data() ) + sizeof( uint32_t ) );
+}
+
+auto bitmapContainerKey( std::string_view bytes, size_t index ) -> uint16_t
+{
+    return bitmapLoad<uint16_t>( reinterpret_cast<const uint8_t *>( bytes.data() ) + kBitmapHeaderSize + index * sizeof( uint16_t ) );
+}
+
+auto bitmapContainerAt( std::string_view bytes, size_t containers, size_t index ) -> BitmapContainer
+{
+    const auto * base = reinterpret_cast<const uint8_t *>( bytes.data() );
+    const auto * cardinalities = base + kBitmapHeaderSize + containers * sizeof( uint16_t );
+    const auto * offsets = cardinalities + containers * sizeof( uint16_t );
+    return { bitmapContainerKey( bytes, index ),
+             static_cast<uint32_t>( bitmapLoad<uint16_t>( cardinalities + index * sizeof( uint16_t ) ) ) + 1U,
+             base + bitmapLoad<uint32_t>( offsets + index * sizeof( uint32_t ) ) };
+}
+
+auto arrayValueAt( const uint8_t * data, size_t index ) -> uint16_t
+{
+    return bitmapLoad<uint16_t>( data + index * sizeof( uint16_t ) );
+}
+
+auto bitsetHas( const uint8_t * data, uint16_t low ) -> bool
+{
+    return ( ( bitmapLoad<uint64_t>( data + ( low >> 6U ) * sizeof( uint64_t ) ) >> ( low & 63U ) ) & 1U ) != 0U;
+}
+
+auto arrayContains( const uint8_t * data, size_t cardinality, uint16_t low ) -> bool
+{
+    size_t begin = 0;
+    size_t end = cardinality;
+    while ( begin < end )
+    {
+        const auto middle = ( begin + end ) / 2U;
+        if ( arrayValueAt( data, middle ) < low )
+        {
+            begin = middle + 1U;
+        }
+        else
+        {
+            end = middle;
+        }
+    }
+    return begin < cardinality && arrayValueAt( data, begin ) == low;
+}
+
+auto containerContains( const BitmapContainer & container, uint16_t low ) -> bool
+{
+    return container.isBitset() ? bitsetHas( container.data, low ) : arrayContains( container.data, container.cardinality, low );
+}
+
+// A much smaller array is searched in the other one, otherwise both are merged
+auto arrayIntersectCount( const BitmapContainer & left, const BitmapContainer & right ) -> uint64_t
+{
+    const auto & small = left.cardinality <= right.cardinality ? left : right;
+    const auto & large = left.cardinality <= right.cardinality ? right : left;
+    uint64_t count = 0;
+    if ( small.cardinality * 32U < large.cardinality )
+    {
+        for ( size_t i = 0; i < small.cardinality; ++i )
+        {
+            count += arrayContains( large.data, large.cardinality, arrayValueAt( small.data, i ) ) ? 1U : 0U;
+        }
+        return count;
+    }
+    size_t i = 0;
+    size_t j = 0;
+    while ( i < small.cardinality && j < large.cardinality )
+    {
+        const auto smallValue = arrayValueAt( small.data, i );
+        const auto largeValue = arrayValueAt( large.data, j );
+        count += smallValue == largeValue ? 1U : 0U;
+        i += smallValue <= largeValue ? 1U : 0U;
+        j += largeValue <= smallValue ? 1U : 0U;
+    }
+    return count;
+}
+
+auto arrayBitsetIntersectCount( const BitmapContainer & array, const BitmapContainer & bitset ) -> uint64_t
+{
+    uint64_t count = 0;
+    for ( size_t i = 0; i < array.cardinality; ++i )
+    {
+        count += bitsetHas( bitset.data, arrayValueAt( array.data, i ) ) ? 1U : 0U;
+    }
+    return count;
+}
+
+// Bits set in both bitsets
+using AndCountFunc = auto ( * )( const uint8_t * left, const uint8_t * right ) -> uint64_t;
+
+auto andCountScalar( const uint8_t * left, const uint8_t * right ) -> uint64_t
+{
+    uint64_t count = 0;
+    for ( size_t i = 0; i < kBitsetBytes; i += sizeof( uint64_t ) )
+    {
+        count += static_cast<uint64_t>( __builtin_popcountll( bitmapLoad<uint64_t>( left + i ) & bitmapLoad<uint64_t>( right + i ) ) );
+    }
+    return count;
+}
+
+#if defined( AXONCACHE_SIMD_X86 )
+// Bits of each nibble looked up with a byte shuffle, then summed per 8 bytes
+__attribute__( ( target( "avx2" ) ) ) auto andCountAvx2( const uint8_t * left, const uint8_t * right ) -> uint64_t
+{
+    const auto nibbleCounts = _mm256_setr_epi8( 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 );
+    const auto lowNibbles = _mm256_set1_epi8( 0x0F );
+    auto total = _mm256_setzero_si256();
+    for ( size_t i = 0; i < kBitsetBytes; i += 32U )
+    {
+        const auto bits = _mm256_and_si256( _mm256_loadu_si256( reinterpret_cast<const __m256i *>( left + i ) ), _mm256_loadu_si256( reinterpret_cast<const __m256i *>( right + i ) ) );
+        const auto counts = _mm256_add_epi8( _mm256_shuffle_epi8( nibbleCounts, _mm256_and_si256( bits, lowNibbles ) ),
+                                             _mm256_shuffle_epi8( nibbleCounts, _mm256_and_si256( _mm256_srli_epi16( bits, 4 ), lowNibbles ) ) );
+        total = _mm256_add_epi64( total, _mm256_sad_epu8( counts, _mm256_setzero_si256() ) );
+    }
+    return static_cast<uint64_t>( _mm256_extract_epi64( total, 0 ) + _mm256_extract_epi64( total, 1 ) + _mm256_extract_epi64( total, 2 ) + _mm256_extract_epi64( total, 3 ) );
+}
+#elif defined( AXONCACHE_SIMD_NEON )
+auto andCountNeon( const uint8_t * left, const uint8_t * right ) -> uint64_t
+{
+    auto total = vdupq_n_u64( 0 );
+    for ( size_t i = 0; i < kBitsetBytes; i += 16U )
+    {
+        const auto counts = vcntq_u8( vandq_u8( vld1q_u8( left + i ), vld1q_u8( right + i ) ) );
+        total = vpadalq_u32( total, vpaddlq_u16( vpaddlq_u8( counts ) ) );
+    }
+    return vaddvq_u64( total );
+}
+#endif
+
+struct BitsetKernel
+{
+    AndCountFunc andCount;
+    std::string_view name;
+};
+
+auto selectBitsetKernel() -> BitsetKernel
+{
+#if defined( AXONCACHE_SIMD_X86 )
+    if ( __builtin_cpu_supports( "avx2" ) )
+    {
+        return { andCountAvx2, "avx2" };
+    }
+#elif defined( AXONCACHE_SIMD_NEON )
+    return { andCountNeon, "neon" };
+#endif
+    return { andCountScalar, "scalar" };
+}
+
+auto bitsetKernel() -> const BitsetKernel &
+{
+    static const BitsetKernel selection = selectBitsetKernel();
+    return selection;
+}
+
+auto containerIntersectCount( const BitmapContainer & left, const BitmapContainer & right ) -> uint64_t
+{
+    if ( left.isBitset() && right.isBitset() )
+    {
+        return bitsetKernel().andCount( left.data, right.data );
+    }
+    if ( left.isBitset() || right.isBitset() )
+    {
+        return left.isBitset() ? arrayBitsetIntersectCount( right, left ) : arrayBitsetIntersectCount( left, right );
+    }
+    return arrayIntersectCount( left, right );
+}
+
+template<typename T>
+auto bitmapStore( std::string & bytes, size_t offset, T value ) -> void
+{
+    std::memcpy( bytes.data() + offset, &value, sizeof( value ) );
+}
+}
+
+auto RoaringBitmap::encode( const std::vector<int64_t> & values ) -> std::string
+{
+    std::vector<uint32_t> sorted;
+    sorted.reserve( values.size() );
+    for ( const auto value : values )
+    {
+        if ( value < 0 || value > std::numeric_limits<uint32_t>::max() )
+        {
+            throw std::runtime_error( "Bitmap values must be within [0, 4294967295], got " + std::to_string( value ) );
+        }
+        sorted.push_back( static_cast<uint32_t>( value ) );
+    }
+    std::sort( sorted.begin(), sorted.end() );
+    sorted.erase( std::unique( sorted.begin(), sorted.end() ), sorted.end() );
+
+    // Start of the values of each container, and the end
+    std::vector<size_t> starts;
+    for ( size_t i = 0; i < sorted.size(); ++i )
+    {
+        if ( i == 0U || ( sorted[i] >> 16U ) != ( sorted[i - 1U] >> 16U ) )
+        {
+            starts.push_back( i );
+        }
+    }
+    const auto containers = starts.size();
+    starts.push_back( sorted.size() );
+
+    std::string bytes( kBitmapHeaderSize + containers * ( 2U * sizeof( uint16_t ) + sizeof( uint32_t ) ), '\0' );
+    bitmapStore( bytes, 0U, static_cast<uint32_t>( sorted.size() ) );
+    bitmapStore( bytes, sizeof( uint32_t ), static_cast<uint32_t>( containers ) );
+    const auto cardinalitiesOffset = kBitmapHeaderSize + containers * sizeof( uint16_t );
+    const auto containerOffsetsOffset = cardinalitiesOffset + containers * sizeof( uint16_t );
+    for ( size_t container = 0; container < containers; ++container )
+    {
+        const auto begin = starts[container];
+        const auto cardinality = starts[container + 1U] - begin;
+        bitmapStore( bytes, kBitmapHeaderSize + container * sizeof( uint16_t ), static_cast<uint16_t>( sorted[begin] >> 16U ) );
+        bitmapStore( bytes, cardinalitiesOffset + container * sizeof( uint16_t ), static_cast<uint16_t>( cardinality - 1U ) );
+        if ( cardinality > kArrayMaxCardinality )
+        {
+            bytes.append( ( sizeof( uint64_t ) - bytes.size() % sizeof( uint64_t ) ) % sizeof( uint64_t ), '\0' );
+            bitmapStore( bytes, containerOffsetsOffset + container * sizeof( uint32_t ), static_cast<uint32_t>( bytes.size() ) );
+            std::vector<uint64_t> words( kBitsetWords );
+            for ( size_t i = begin; i < begin + cardinality; ++i )
+            {
+                const auto low = sorted[i] & 0xFFFFU;
+                words[low >> 6U] |= uint64_t{ 1 } << ( low & 63U );
+            }
+            bytes.append( reinterpret_cast<const char *>( words.data() ), kBitsetBytes );
+            continue;
+        }
+        bitmapStore( bytes, containerOffsetsOffset + container * sizeof( uint32_t ), static_cast<uint32_t>( bytes.size() ) );
+        for ( size_t i = begin; i < begin + cardinality; ++i )
+        {
+            const auto low = static_cast<uint16_t>( sorted[i] & 0xFFFFU );
+            bytes.append( reinterpret_cast<const char *>( &low ), sizeof( low ) );
+        }
+    }
+    return bytes;
+}
+
+auto RoaringBitmap::cardinality( std::string_view bytes ) -> size_t
+{
+    return bytes.size() < kBitmapHeaderSize ? 0U : bitmapLoad<uint32_t>( reinterpret_cast<const uint8_t *>( bytes.data() ) );
+}
+
+auto RoaringBitmap::contains( std::string_view bytes, uint32_t value ) -> bool
+{
+    const auto containers = bitmapContainerCount( bytes );
+    const auto key = static_cast<uint16_t>( value >> 16U );
+    size_t begin = 0;
+    size_t end = containers;
+    while ( begin < end )
+    {
+        const auto middle = ( begin + end ) / 2U;
+        if ( bitmapContainerKey( bytes, middle ) < key )
+        {
+            begin = middle + 1U;
+        }
+        else
+        {
+            end = middle;
+        }
+    }
+    if ( begin == containers || bitmapContainerKey( bytes, begin ) != key )
+    {
+        return false;
+    }
+    return containerContains( bitmapContainerAt( bytes, containers, begin ), static_cast<uint16_t>( value & 0xFFFFU ) );
+}
+
+auto RoaringBitmap::intersectCount( std::string_view left, std::string_view right ) -> uint64_t
+{
+    const auto leftContainers = bitmapContainerCount( left );
+    const auto rightContainers = bitmapContainerCount( right );
+    uint64_t count = 0;
+    size_t i = 0;
+    size_t j = 0;
+    while ( i < leftContainers && j < rightContainers )
+    {
+        const auto leftKey = bitmapContainerKey( left, i );
+        const auto rightKey = bitmapContainerKey( right, j );
+        if ( leftKey == rightKey )
+        {
+            count += containerIntersectCount( bitmapContainerAt( left, leftContainers, i ), bitmapContainerAt( right, rightContainers, j ) );
+        }
+        i += leftKey <= rightKey ? 1U : 0U;
+        j += rightKey <= leftKey ? 1U : 0U;
+    }
+    return count;
+}
+
+auto RoaringBitmap::decode( std::string_view bytes ) -> std::vector<uint32_t>
+{
+    std::vector<uint32_t> values;
+    values.reserve( cardinality( bytes ) );
+    const auto containers = bitmapContainerCount( bytes );
+    for ( size_t index = 0; index < containers; ++index )
+    {
+        const auto container = bitmapContainerAt( bytes, containers, index );
+        const auto high = static_cast<uint32_t>( container.key ) << 16U;
+        if ( !container.isBitset() )
+        {
+            for ( size_t i = 0; i < container.cardinality; ++i )
+            {
+                values.push_back( high | arrayValueAt( container.data, i ) );
+            }
+            continue;
+        }
+        for ( size_t word = 0; word < kBitsetWords; ++word )
+        {
+            for ( auto bits = bitmapLoad<uint64_t>( container.data + word * sizeof( uint64_t ) ); bits != 0U; bits &= bits - 1U )
+            {
+                values.push_back( high | static_cast<uint32_t>( word * 64U + static_cast<size_t>( __builtin_ctzll( bits ) ) ) );
+            }
+        }
+    }
+    return values;
+}
+
+auto RoaringBitmap::isaName() -> std::string_view
+{
+    return bitsetKernel().name;
+}
@@ -3,6 +3,7 @@
 
 #include "axoncache/transformer/StringListToString.h"
 #include <cstdint>
+#include <cstring>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -12,10 +13,12 @@
 
 using namespace axoncache;
 
-auto StringListToString::transform( const std::vector<std::string_view> & input ) -> std::string
+namespace
 {
-    std::string result;
+constexpr size_t kIndexedHeaderSize = sizeof( uint16_t ) + sizeof( uint32_t );
 
+auto checkStringList( const std::vector<std::string_view> & input ) -> void
+{
     if ( input.size() > Constants::Limit::kVectorLength )
     {
         std::ostringstream oss;
@@ -26,9 +29,6 @@ auto StringListToString::transform( const std::vector<std::string_view> & input
         throw std::runtime_error( "input vector size " + std::to_string( input.size() ) + " too large. max=" + std::to_string( Constants::Limit::kVectorLength ) );
     }
 
-    auto numberOfElements = static_cast<uint16_t>( input.size() );
-    result.append( ( const char * )( &numberOfElements ), sizeof( uint16_t ) );
-
     for ( const auto & s : input )
     {
         if ( s.size() > Constants::Limit::kVectorElementLength )
@@ -40,7 +40,42 @@ auto StringListToString::transform( const std::vector<std::string_view> & input
 
             throw std::runtime_error( "input vector element " + std::to_string( s.size() ) + " too large. max=" + std::to_string( Constants::Limit::kVectorElementLength ) );
         }
+    }
+}
+
+auto isIndexed( std::string_view input ) -> bool
+{
+    return input.size() > sizeof( uint16_t ) && input[0] == '\0' && input[1] == '\0';
+}
+
+auto loadUint32( const char * data ) -> uint32_t
+{
+    uint32_t value = 0;
+    std::memcpy( &value, data, sizeof( value ) );
+    return value;
+}
+
+// Element index of an indexed encoding of count elements
+auto indexedAt( std::string_view input, uint32_t count, size_t index ) -> std::string_view
+{
+    const auto * ends = input.data() + kIndexedHeaderSize;
+    const auto * elements = ends + count * sizeof( uint32_t );
+    const auto begin = index == 0U ? 0U : loadUint32( ends + ( index - 1U ) * sizeof( uint32_t ) );
+    const auto end = loadUint32( ends + index * sizeof( uint32_t ) );
+    return { elements + begin, end - begin - 1U };
+}
+}
 
+auto StringListToString::transform( const std::vector<std::string_view> & input ) -> std::string
+{
+    checkStringList( input );
+
+    std::string result;
+    auto numberOfElements = static_cast<uint16_t>( input.size() );
+    result.append( ( const char * )( &numberOfElements ), sizeof( uint16_t ) );
+
+    for ( const auto & s : input )
+    {
         auto elemLength = static_cast<uint16_t>( s.size() );
         result.append( ( const char * )( &elemLength ), sizeof( uint16_t ) );
         result.append( s.data(), s.size() );
@@ -50,10 +85,49 @@ auto StringListToString::transform( const std::vector<std::string_view> & input
     return result;
 }
 
+auto StringListToString::transformIndexed( const std::vector<std::string_view> & input ) -> std::string
+{
+    if ( input.empty() )
+    {
+        return transform( input );
+    }
+    checkStringList( input );
+
+    std::string result( kIndexedHeaderSize + input.size() * sizeof( uint32_t ), '\0' );
+    const auto numberOfElements = static_cast<uint32_t>( input.size() );
+    std::memcpy( result.data() + sizeof( uint16_t ), &numberOfElements, sizeof( numberOfElements ) );
+
+    uint32_t end = 0;
+    for ( size_t elemIx = 0; elemIx < input.size(); ++elemIx )
+    {
+        end += static_cast<uint32_t>( input[elemIx].size() ) + 1U;
+        std::memcpy( result.data() + kIndexedHeaderSize + elemIx * sizeof( uint32_t ), &end, sizeof( end ) );
+    }
+    result.reserve( result.size() + end );
+    for ( const auto & s : input )
+    {
+        result.append( s.data(), s.size() );
+        result.push_back( '\0' ); // Always null terminated
+    }
+
+    return result;
+}
+
 auto StringListToString::transform( std::string_view input ) -> std::vector<std::string_view>
 {
-    const auto numberOfElements = *( ( uint16_t * )input.data() );
     std::vector<std::string_view> result;
+    if ( isIndexed( input ) )
+    {
+        const auto numberOfElements = loadUint32( input.data() + sizeof( uint16_t ) );
+        result.reserve( numberOfElements );
+        for ( auto elemIx = 0UL; elemIx < numberOfElements; ++elemIx )
+        {
+            result.push_back( indexedAt( input, numberOfElements, elemIx ) );
+        }
+        return result;
+    }
+
+    const auto numberOfElements = *( ( uint16_t * )input.data() );
     result.reserve( numberOfElements );
 
     const auto * dataPtr = input.data() + sizeof( uint16_t );
@@ -67,3 +141,39 @@ auto StringListToString::transform( std::string_view input ) -> std::vector<std:
 
     return result;
 }
+
+auto StringListToString::size( std::string_view input ) -> size_t
+{
+    if ( input.size() < sizeof( uint16_t ) )
+    {
+        return 0U;
+    }
+    if ( isIndexed( input ) )
+    {
+        return loadUint32( input.data() + sizeof( uint16_t ) );
+    }
+    uint16_t numberOfElements = 0;
+    std::memcpy( &numberOfElements, input.data(), sizeof( numberOfElements ) );
+    return numberOfElements;
+}
+
+auto StringListToString::at( std::string_view input, size_t index ) -> std::string_view
+{
+    if ( isIndexed( input ) )
+    {
+        return indexedAt( input, loadUint32( input.data() + sizeof( uint16_t ) ), index );
+    }
+
+    const auto * dataPtr = input.data() + sizeof( uint16_t );
+    uint16_t elemLength = 0;
+    for ( size_t elemIx = 0; ; ++elemIx )
+    {
+        std::memcpy( &elemLength, dataPtr, sizeof( elemLength ) );
+        dataPtr += sizeof( uint16_t );
+        if ( elemIx == index )
+        {
+            return { dataPtr, elemLength };
+        }
+        dataPtr += elemLength + 1;
+    }
+}
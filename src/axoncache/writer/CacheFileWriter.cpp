@@ -30,6 +30,7 @@ CacheFileWriter::~CacheFileWriter()
 auto CacheFileWriter::startWrite() -> void
 {
     GenerateHeader generator;
+    cache()->finalize();
     AL_LOG_INFO( "Writing " + mFullCacheFileName );
     generator.write( cache(), cacheName(), mOutput );
 }
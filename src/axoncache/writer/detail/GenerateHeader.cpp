@@ -30,7 +30,7 @@ auto GenerateHeader::write( const CacheBase * cache, std::string_view cacheName,
      * - offsetBits       (2)
      * - hashFuncId       (2)
      *
-     * - reserved         (4)
+     * - flags            (4)
      * - maxCollisions    (4)
      *
      * - maxLoafFactor    (8)
@@ -46,14 +46,14 @@ auto GenerateHeader::write( const CacheBase * cache, std::string_view cacheName,
     info.magicNumber = Constants::kCacheHeaderMagicNumber;
     info.headerSize = headerSize;
     info.nameStart = offsetof( CacheHeader, cacheName );
-    info.version = cache->version();
+    info.version = cache->formatVersion();
 
     info.cacheType = static_cast<uint16_t>( cache->type() );
     info.hashcodeBits = cache->hashcodeBits();
     info.offsetBits = cache->offsetBits();
     info.hashFuncId = cache->hashFuncId();
 
-    info.reserved = 0U;
+    info.flags = cache->headerFlags();
     info.maxCollisions = cache->maxCollisions();
 
     info.maxLoadFactor = cache->maxLoadFactor();
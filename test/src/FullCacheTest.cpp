@@ -8,10 +8,14 @@
 #include <axoncache/Constants.h>
 #include <axoncache/loader/CacheOneTimeLoader.h>
 #include <axoncache/cache/BucketChainCache.h>
+#include <axoncache/cache/CuckooCache.h>
 #include <axoncache/memory/MallocMemoryHandler.h>
 #include <axoncache/cache/LinearProbeCache.h>
 #include <axoncache/cache/LinearProbeDedupCache.h>
+#include <axoncache/cache/LinearProbeSimdCache.h>
 #include <axoncache/cache/MapCache.h>
+#include <axoncache/cache/PerfectHashCache.h>
+#include <axoncache/cache/probe/SlotMapping.h>
 #include "axoncache/common/SharedSettingsProvider.h"
 #include "axoncache/cache/factory/CacheFactory.h"
 #include "axoncache/parser/CacheValueParser.h"
@@ -142,7 +146,11 @@ static auto VerifyCache( const std::string & dataFile, const std::string & cache
     CHECK( inputFile.is_open() );
     auto parser = std::make_unique<CacheValueParser>( &settings );
     std::unordered_set<std::string> keySets;
+    std::vector<std::string> stringKeys;
+    std::vector<std::string> stringValues;
     const char controlLine = settings.getChar( Constants::ConfKey::kControlCharLine, Constants::ConfDefault::kControlCharLine );
+    // Compressed values are only read into a buffer
+    std::string buffer;
     while ( std::getline( inputFile, line, controlLine ) )
     {
         auto pair = parser->parseValue( line.data(), line.size() );
@@ -152,8 +160,10 @@ static auto VerifyCache( const std::string & dataFile, const std::string & cache
         }
         if ( pair.second.type() == CacheValueType::String )
         {
-            auto value = cache->get( pair.first );
+            auto value = cache->hasCompressedValues() ? cache->getString( pair.first, buffer ).first : cache->get( pair.first );
             CHECK( pair.second.asString() == value );
+            stringKeys.emplace_back( pair.first );
+            stringValues.emplace_back( value );
         }
         else if ( pair.second.type() == CacheValueType::StringList )
         {
@@ -172,6 +182,19 @@ static auto VerifyCache( const std::string & dataFile, const std::string & cache
         }
     }
 
+    // Batched lookups return the same values as one at a time, misses included
+    stringKeys.emplace_back( "alcache_test_missing_key" );
+    stringValues.emplace_back( "missing" );
+    const std::vector<std::string_view> manyKeys( stringKeys.begin(), stringKeys.end() );
+    std::vector<std::string> buffers;
+    const auto manyValues = cache->hasCompressedValues() ? cache->getMany( manyKeys, buffers, "missing" ) : cache->getMany( manyKeys, "missing" );
+    CHECK( manyValues.size() == manyKeys.size() );
+    for ( auto i = 0U; i < manyValues.size(); i++ )
+    {
+        CHECK( manyValues[i].first == stringValues[i] );
+        CHECK( manyValues[i].second == ( i + 1 < manyValues.size() ) );
+    }
+
     // Check duplicated values
     if constexpr ( std::is_same_v<Cache, axoncache::LinearProbeDedupCache> )
     {
@@ -189,7 +212,7 @@ static auto VerifyCache( const std::string & dataFile, const std::string & cache
 }
 
 template<typename Cache>
-static auto fullCacheTester( uint16_t offsetBits, double maxLoadFactor, uint64_t numberOfStringKeys, uint64_t numberOfStringListKeys, uint64_t numberOfKeySlots, const std::string & testName, uint64_t numberOfStringValues = 0UL, uint64_t numberOfStringListValues = 0UL, axoncache::CacheType cacheType = axoncache::CacheType::NONE ) -> void
+static auto fullCacheTester( uint16_t offsetBits, double maxLoadFactor, uint64_t numberOfStringKeys, uint64_t numberOfStringListKeys, uint64_t numberOfKeySlots, const std::string & testName, uint64_t numberOfStringValues = 0UL, uint64_t numberOfStringListValues = 0UL, axoncache::CacheType cacheType = axoncache::CacheType::NONE, uint32_t headerFlags = 0U ) -> void
 {
     auto startMs = currentTimeMillis();
     std::string cacheName = "alcache_test_" + testName;
@@ -207,6 +230,18 @@ static auto fullCacheTester( uint16_t offsetBits, double maxLoadFactor, uint64_t
         {
             cacheType = axoncache::CacheType::LINEAR_PROBE_DEDUP;
         }
+        else if constexpr ( std::is_same_v<Cache, axoncache::LinearProbeSimdCache> )
+        {
+            cacheType = axoncache::CacheType::LINEAR_PROBE_SIMD;
+        }
+        else if constexpr ( std::is_same_v<Cache, axoncache::CuckooCache> )
+        {
+            cacheType = axoncache::CacheType::CUCKOO;
+        }
+        else if constexpr ( std::is_same_v<Cache, axoncache::PerfectHashCache> )
+        {
+            cacheType = axoncache::CacheType::PERFECT_HASH;
+        }
     }
 
     // write data file
@@ -242,6 +277,13 @@ static auto fullCacheTester( uint16_t offsetBits, double maxLoadFactor, uint64_t
     settings.setSetting( axoncache::Constants::ConfKey::kControlCharLine, "\n" );
     settings.setSetting( axoncache::Constants::ConfKey::kControlCharVectorType, "\t" );
     settings.setSetting( axoncache::Constants::ConfKey::kMaxLoadFactor + "." + cacheName, std::to_string( maxLoadFactor ) );
+    settings.setSetting( axoncache::Constants::ConfKey::kRobinHood + "." + cacheName, ( headerFlags & Constants::HeaderFlag::kRobinHood ) != 0U ? "true" : "false" );
+    settings.setSetting( axoncache::Constants::ConfKey::kNegativeLookupFilter + "." + cacheName, ( headerFlags & Constants::HeaderFlag::kNegativeLookupFilter ) != 0U ? "true" : "false" );
+    settings.setSetting( axoncache::Constants::ConfKey::kNamespacePrefix + "." + cacheName, ( headerFlags & Constants::HeaderFlag::kNamespacePrefix ) != 0U ? "true" : "false" );
+    settings.setSetting( axoncache::Constants::ConfKey::kKeyFingerprint + "." + cacheName, ( headerFlags & Constants::HeaderFlag::kKeyFingerprint ) != 0U ? "true" : "false" );
+    settings.setSetting( axoncache::Constants::ConfKey::kCompressedValues + "." + cacheName, ( headerFlags & Constants::HeaderFlag::kCompressedValues ) != 0U ? "true" : "false" );
+    const auto slotMapping = toSlotMapping( headerFlags );
+    settings.setSetting( axoncache::Constants::ConfKey::kSlotMapping + "." + cacheName, slotMapping == SlotMapping::FAST_RANGE ? "fastrange" : ( slotMapping == SlotMapping::POW2_MASK ? "pow2" : "modulo" ) );
 
     fullCacheTestWriteData( dataFile, numberOfStringKeys, numberOfStringListKeys, numberOfStringValues, numberOfStringListValues, &settings );
 
@@ -267,7 +309,13 @@ static auto fullCacheTester( uint16_t offsetBits, double maxLoadFactor, uint64_t
 
     auto cache = loader.loadLatest<Cache>( cacheName );
     CHECK( cache->creationTimeMs() >= startMs );
+    CHECK( cache->headerFlags() == headerFlags );
     CHECK( loader.getTimestamp() == currentMsStr );
+    // Files that 2.5 readers would misread carry the runtime version, which those readers refuse
+    constexpr uint32_t kFlagsMisreadByBaseReaders = Constants::HeaderFlag::kSlotMappingFastRange | Constants::HeaderFlag::kSlotMappingPow2Mask | Constants::HeaderFlag::kNamespacePrefix | Constants::HeaderFlag::kKeyFingerprint | Constants::HeaderFlag::kCompressedValues | Constants::HeaderFlag::kIndexedStringLists | Constants::HeaderFlag::kSharedValues;
+    const auto isBaseCacheType = cacheType == axoncache::CacheType::BUCKET_CHAIN || cacheType == axoncache::CacheType::LINEAR_PROBE || cacheType == axoncache::CacheType::LINEAR_PROBE_DEDUP || cacheType == axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED;
+    const auto isBaseFormat = isBaseCacheType && ( headerFlags & kFlagsMisreadByBaseReaders ) == 0U;
+    CHECK( loader.loadHeader( latestCacheFile ).second.version == ( isBaseFormat ? Constants::kBaseFormatVersion : cache->version() ) );
 
     std::filesystem::remove( dataFile );
     std::filesystem::remove( latestTimestampFile );
@@ -383,6 +431,144 @@ TEST_CASE( "LinearProbeCacheBigOffsetTest" )
     fullCacheTester<axoncache::LinearProbeDedupCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "linear_probe35_big", 0UL, 0UL, axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED );
 }
 
+TEST_CASE( "LinearProbeSimdCacheTest" )
+{
+    const auto maxLoadFactor = 0.5;
+    const auto numberOfStringKeys = 20000;
+    const auto numberOfStringListKeys = 2000;
+    const auto numberOfKeys = numberOfStringKeys + numberOfStringListKeys;
+    const auto numberOfKeySlots = static_cast<uint64_t>( std::ceil( static_cast<double>( numberOfKeys ) / maxLoadFactor ) );
+
+    fullCacheTester<axoncache::LinearProbeSimdCache>( 16U, maxLoadFactor, 5, 5, 20, "linear_probe_simd16" );
+    fullCacheTester<axoncache::LinearProbeSimdCache>( 35U, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "linear_probe_simd35" );
+}
+
+TEST_CASE( "PerfectHashCacheTest" )
+{
+    const auto maxLoadFactor = 0.5;
+    const auto numberOfStringKeys = 20000;
+    const auto numberOfStringListKeys = 2000;
+    const auto numberOfKeys = numberOfStringKeys + numberOfStringListKeys;
+    const auto numberOfKeySlots = static_cast<uint64_t>( std::ceil( static_cast<double>( numberOfKeys ) / maxLoadFactor ) );
+
+    fullCacheTester<axoncache::PerfectHashCache>( 16U, maxLoadFactor, 5, 5, 20, "perfect_hash16" );
+    fullCacheTester<axoncache::PerfectHashCache>( 35U, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "perfect_hash35" );
+}
+
+TEST_CASE( "CuckooCacheTest" )
+{
+    const auto maxLoadFactor = 0.9;
+    const auto numberOfStringKeys = 20000;
+    const auto numberOfStringListKeys = 2000;
+    const auto numberOfKeys = numberOfStringKeys + numberOfStringListKeys;
+    const auto numberOfKeySlots = static_cast<uint64_t>( std::ceil( static_cast<double>( numberOfKeys ) / maxLoadFactor ) );
+
+    fullCacheTester<axoncache::CuckooCache>( 16U, maxLoadFactor, 5, 5, 20, "cuckoo16" );
+    fullCacheTester<axoncache::CuckooCache>( 35U, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "cuckoo35" );
+}
+
+TEST_CASE( "LinearProbeRobinHoodCacheTest" )
+{
+    const uint16_t offsetBits = 28U;
+    const auto maxLoadFactor = 0.8;
+    const auto numberOfStringKeys = 20000;
+    const auto numberOfStringListKeys = 2000;
+    const auto numberOfKeys = numberOfStringKeys + numberOfStringListKeys;
+    const auto numberOfKeySlots = static_cast<uint64_t>( std::ceil( static_cast<double>( numberOfKeys ) / maxLoadFactor ) );
+
+    fullCacheTester<axoncache::LinearProbeCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "robin_hood", 0UL, 0UL, axoncache::CacheType::NONE, Constants::HeaderFlag::kRobinHood );
+    fullCacheTester<axoncache::LinearProbeDedupCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "robin_hood", 0UL, 0UL, axoncache::CacheType::NONE, Constants::HeaderFlag::kRobinHood );
+    fullCacheTester<axoncache::LinearProbeDedupCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "robin_hood", 0UL, 0UL, axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED, Constants::HeaderFlag::kRobinHood );
+    fullCacheTester<axoncache::LinearProbeSimdCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "robin_hood", 0UL, 0UL, axoncache::CacheType::NONE, Constants::HeaderFlag::kRobinHood );
+    fullCacheTester<axoncache::LinearProbeSimdCache>( 16U, maxLoadFactor, 5, 5, 20, "robin_hood16", 0UL, 0UL, axoncache::CacheType::NONE, Constants::HeaderFlag::kRobinHood );
+}
+
+TEST_CASE( "LinearProbeSlotMappingCacheTest" )
+{
+    const uint16_t offsetBits = 28U;
+    const auto maxLoadFactor = 0.5;
+    const auto numberOfStringKeys = 20000;
+    const auto numberOfStringListKeys = 2000;
+    const auto numberOfKeys = numberOfStringKeys + numberOfStringListKeys;
+    const auto numberOfKeySlots = static_cast<uint64_t>( std::ceil( static_cast<double>( numberOfKeys ) / maxLoadFactor ) );
+    const auto fastRange = Constants::HeaderFlag::kSlotMappingFastRange;
+    const auto pow2Mask = Constants::HeaderFlag::kSlotMappingPow2Mask;
+
+    fullCacheTester<axoncache::LinearProbeCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "fast_range", 0UL, 0UL, axoncache::CacheType::NONE, fastRange );
+    fullCacheTester<axoncache::LinearProbeCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "pow2_mask", 0UL, 0UL, axoncache::CacheType::NONE, pow2Mask );
+    fullCacheTester<axoncache::LinearProbeDedupCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "fast_range", 0UL, 0UL, axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED, fastRange | Constants::HeaderFlag::kRobinHood );
+    fullCacheTester<axoncache::LinearProbeSimdCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "fast_range", 0UL, 0UL, axoncache::CacheType::NONE, fastRange );
+    fullCacheTester<axoncache::LinearProbeSimdCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "pow2_mask", 0UL, 0UL, axoncache::CacheType::NONE, pow2Mask | Constants::HeaderFlag::kRobinHood );
+}
+
+TEST_CASE( "LinearProbeNegativeLookupFilterCacheTest" )
+{
+    const uint16_t offsetBits = 28U;
+    const auto maxLoadFactor = 0.5;
+    const auto numberOfStringKeys = 20000;
+    const auto numberOfStringValues = 2000;
+    const auto numberOfStringListKeys = 2000;
+    const auto numberOfStringListValues = 200;
+    const auto numberOfKeys = numberOfStringKeys + numberOfStringListKeys;
+    const auto numberOfKeySlots = static_cast<uint64_t>( std::ceil( static_cast<double>( numberOfKeys ) / maxLoadFactor ) );
+    const auto filter = Constants::HeaderFlag::kNegativeLookupFilter;
+
+    fullCacheTester<axoncache::LinearProbeCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "negative_lookup_filter", 0UL, 0UL, axoncache::CacheType::NONE, filter );
+    fullCacheTester<axoncache::LinearProbeDedupCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "negative_lookup_filter", numberOfStringValues, numberOfStringListValues, axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED, filter | Constants::HeaderFlag::kRobinHood );
+    fullCacheTester<axoncache::LinearProbeSimdCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "negative_lookup_filter", 0UL, 0UL, axoncache::CacheType::NONE, filter );
+}
+
+TEST_CASE( "LinearProbeNamespacePrefixCacheTest" )
+{
+    const uint16_t offsetBits = 28U;
+    const auto maxLoadFactor = 0.5;
+    const auto numberOfStringKeys = 20000;
+    const auto numberOfStringValues = 2000;
+    const auto numberOfStringListKeys = 2000;
+    const auto numberOfStringListValues = 200;
+    const auto numberOfKeys = numberOfStringKeys + numberOfStringListKeys;
+    const auto numberOfKeySlots = static_cast<uint64_t>( std::ceil( static_cast<double>( numberOfKeys ) / maxLoadFactor ) );
+    const auto namespacePrefix = Constants::HeaderFlag::kNamespacePrefix;
+
+    fullCacheTester<axoncache::LinearProbeCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "namespace_prefix", 0UL, 0UL, axoncache::CacheType::NONE, namespacePrefix );
+    fullCacheTester<axoncache::LinearProbeDedupCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "namespace_prefix", numberOfStringValues, numberOfStringListValues, axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED, namespacePrefix | Constants::HeaderFlag::kNegativeLookupFilter );
+    fullCacheTester<axoncache::LinearProbeSimdCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "namespace_prefix", 0UL, 0UL, axoncache::CacheType::NONE, namespacePrefix | Constants::HeaderFlag::kRobinHood );
+}
+
+TEST_CASE( "LinearProbeKeyFingerprintCacheTest" )
+{
+    const uint16_t offsetBits = 28U;
+    const auto maxLoadFactor = 0.5;
+    const auto numberOfStringKeys = 20000;
+    const auto numberOfStringValues = 2000;
+    const auto numberOfStringListKeys = 2000;
+    const auto numberOfStringListValues = 200;
+    const auto numberOfKeys = numberOfStringKeys + numberOfStringListKeys;
+    const auto numberOfKeySlots = static_cast<uint64_t>( std::ceil( static_cast<double>( numberOfKeys ) / maxLoadFactor ) );
+    const auto keyFingerprint = Constants::HeaderFlag::kKeyFingerprint;
+
+    fullCacheTester<axoncache::LinearProbeCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "key_fingerprint", 0UL, 0UL, axoncache::CacheType::NONE, keyFingerprint | Constants::HeaderFlag::kRobinHood );
+    fullCacheTester<axoncache::LinearProbeDedupCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "key_fingerprint", numberOfStringValues, numberOfStringListValues, axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED, keyFingerprint | Constants::HeaderFlag::kNegativeLookupFilter );
+    fullCacheTester<axoncache::LinearProbeSimdCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "key_fingerprint", 0UL, 0UL, axoncache::CacheType::NONE, keyFingerprint );
+}
+
+TEST_CASE( "LinearProbeCompressedValuesCacheTest" )
+{
+    const uint16_t offsetBits = 28U;
+    const auto maxLoadFactor = 0.5;
+    const auto numberOfStringKeys = 20000;
+    const auto numberOfStringValues = 2000;
+    const auto numberOfStringListKeys = 2000;
+    const auto numberOfStringListValues = 200;
+    const auto numberOfKeys = numberOfStringKeys + numberOfStringListKeys;
+    const auto numberOfKeySlots = static_cast<uint64_t>( std::ceil( static_cast<double>( numberOfKeys ) / maxLoadFactor ) );
+    const auto compressedValues = Constants::HeaderFlag::kCompressedValues;
+
+    fullCacheTester<axoncache::LinearProbeCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "compressed_values", 0UL, 0UL, axoncache::CacheType::NONE, compressedValues | Constants::HeaderFlag::kRobinHood | Constants::HeaderFlag::kNegativeLookupFilter );
+    fullCacheTester<axoncache::LinearProbeDedupCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "compressed_values", numberOfStringValues, numberOfStringListValues, axoncache::CacheType::LINEAR_PROBE_DEDUP_TYPED, compressedValues | Constants::HeaderFlag::kNamespacePrefix );
+    fullCacheTester<axoncache::LinearProbeSimdCache>( offsetBits, maxLoadFactor, numberOfStringKeys, numberOfStringListKeys, numberOfKeySlots, "compressed_values", 0UL, 0UL, axoncache::CacheType::NONE, compressedValues );
+}
+
 TEST_CASE( "LinearProbeDedupCacheOfs28Test" )
 {
     const uint16_t offsetBits = 28U;
@@ -417,6 +603,40 @@ TEST_CASE( "LinearProbeForwardIncompatibility" )
     std::filesystem::remove( cacheFile );
 }
 
+TEST_CASE( "LinearProbeFormatVersionIncompatibility" )
+{
+    const auto runtimeVersion = static_cast<uint16_t>( ( AXONCACHE_VERSION_MAJOR * 1000 ) + ( AXONCACHE_VERSION_MINOR * 10 ) + AXONCACHE_VERSION_PATCH );
+    const std::string cacheName = "test_format_version";
+    const std::string cacheFile = std::filesystem::temp_directory_path().string() + std::filesystem::path::preferred_separator + cacheName + std::string{ Constants::kCacheFileNameSuffix };
+    auto writeHeader = [&]( uint16_t version, uint32_t flags )
+    {
+        CacheHeader header{};
+        header.magicNumber = Constants::kCacheHeaderMagicNumber;
+        header.version = version;
+        header.cacheType = static_cast<uint16_t>( axoncache::CacheType::LINEAR_PROBE );
+        header.offsetBits = static_cast<uint16_t>( 20 );
+        header.flags = flags;
+        header.headerSize = sizeof( CacheHeader );
+        header.nameStart = offsetof( CacheHeader, cacheName );
+        snprintf( header.cacheName, std::min( cacheName.size() + 1, Constants::kMaxCacheNameSize ), "%s", cacheName.data() );
+        std::fstream output = std::fstream( cacheFile, std::ios::out | std::ios::binary );
+        output.write( reinterpret_cast<const char *>( &header ), sizeof( CacheHeader ) );
+        output.put( 0 );
+        output.close();
+    };
+    axoncache::CacheOneTimeLoader loader( nullptr );
+
+    writeHeader( Constants::kBaseFormatVersion - 10U, 0U );
+    CHECK_THROWS_WITH( loader.loadAbsolutePath<axoncache::LinearProbeCache>( cacheName, cacheFile, false ),
+                       ( "trying to load file version " + std::to_string( Constants::kBaseFormatVersion - 10U ) + " with a runtime version " + std::to_string( runtimeVersion ) ).c_str() );
+    writeHeader( runtimeVersion + 10U, 0U );
+    CHECK_THROWS_WITH( loader.loadAbsolutePath<axoncache::LinearProbeCache>( cacheName, cacheFile, false ),
+                       ( "trying to load file version " + std::to_string( runtimeVersion + 10U ) + " with a runtime version " + std::to_string( runtimeVersion ) ).c_str() );
+    writeHeader( runtimeVersion, Constants::HeaderFlag::kRobinHood | ( 1U << 31U ) );
+    CHECK_THROWS_WITH( loader.loadAbsolutePath<axoncache::LinearProbeCache>( cacheName, cacheFile, false ), "trying to load file with unknown header flags 2147483648" );
+    std::filesystem::remove( cacheFile );
+}
+
 TEST_CASE( "LinearProbeDedupSetDuplicatedValues" )
 {
     const uint16_t offsetBits = 28U;
@@ -429,7 +649,7 @@ TEST_CASE( "LinearProbeDedupSetDuplicatedValues" )
     // Check setDuplicatedValues API
     std::vector<std::string> duplicatedValues = { "value1", "value2" };
     auto cacheBase = CacheFactory::createCache( offsetBits, numberOfKeySlots, maxLoadFactor, axoncache::CacheType::LINEAR_PROBE_DEDUP );
-    CHECK_THROWS_WITH( ( ( LinearProbeDedupCache * )cacheBase.get() )->setDuplicatedValues( std::vector<std::string>( 70000 ) ), "Should not set more than 65536 duplicated values" );
+    CHECK_THROWS_WITH( ( ( LinearProbeDedupCache * )cacheBase.get() )->setDuplicatedValues( std::vector<std::string>( Constants::Limit::kFrequentValues + 1U ) ), "Should not set more than 1048576 duplicated values" );
     ( ( LinearProbeDedupCache * )cacheBase.get() )->setDuplicatedValues( duplicatedValues );
     CHECK_THROWS_WITH( ( ( LinearProbeDedupCache * )cacheBase.get() )->setDuplicatedValues( duplicatedValues ), "Values already set, call this API only once" );
 }
@@ -8,6 +8,6 @@
 
 TEST_CASE( "AxonCache version" )
 {
-    static_assert( std::string_view( AXONCACHE_VERSION ) == std::string_view( "2.5" ) );
-    CHECK( std::string( AXONCACHE_VERSION ) == std::string( "2.5" ) );
+    static_assert( std::string_view( AXONCACHE_VERSION ) == std::string_view( "2.6" ) );
+    CHECK( std::string( AXONCACHE_VERSION ) == std::string( "2.6" ) );
 }
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include <axoncache/cache/EmbeddingCache.h>
+#include <axoncache/cache/LinearProbeCache.h>
+#include <axoncache/cache/factory/CacheFactory.h>
+#include <axoncache/memory/MallocMemoryHandler.h>
+#include "doctest/doctest.h"
+#include "CacheTestUtils.h"
+#include "axoncache/Constants.h"
+
+using namespace axoncache;
+
+namespace
+{
+auto reload( EmbeddingCache & cache ) -> std::unique_ptr<EmbeddingCache>
+{
+    CacheHeader header{};
+    header.cacheType = static_cast<uint16_t>( cache.type() );
+    header.hashFuncId = cache.hashFuncId();
+    header.flags = cache.headerFlags();
+    header.offsetBits = cache.offsetBits();
+    header.numberOfKeySlots = cache.numberOfKeySlots();
+    header.numberOfEntries = cache.numberOfEntries();
+    header.maxCollisions = cache.maxCollisions();
+    const auto size = cache.size() - sizeof( CacheHeader );
+    auto memory = std::make_unique<MallocMemoryHandler>();
+    std::memcpy( memory->grow( size ), cache.getKeySpacePtr(), size );
+    return std::make_unique<EmbeddingCache>( header, std::move( memory ) );
+}
+
+auto rowFor( size_t ix, size_t dimension ) -> std::vector<float>
+{
+    std::vector<float> row( dimension );
+    for ( size_t i = 0; i < dimension; ++i )
+    {
+        row[i] = static_cast<float>( ix ) + static_cast<float>( i ) / 64.0F;
+    }
+    return row;
+}
+}
+
+TEST_CASE( "EmbeddingCacheTestPutGet" )
+{
+    // 20 floats pad rows to 24, 32 floats need no padding
+    for ( const size_t dimension : { 20UL, 32UL } )
+    {
+        for ( const auto headerFlags : { 0U, Constants::HeaderFlag::kSlotMappingFastRange, Constants::HeaderFlag::kSlotMappingPow2Mask } )
+        {
+            EmbeddingCache cache( 30U, 4000UL, 0.5, std::make_unique<MallocMemoryHandler>(), headerFlags );
+            CHECK( cache.dimension() == 0U );
+            const auto keys = test_utils::gen_random_str_map( cache.maxNumberEntries() );
+            size_t ix = 0;
+            for ( const auto & [key, value] : keys )
+            {
+                REQUIRE( cache.put( key, rowFor( ix++, dimension ) ).first );
+            }
+            CHECK_THROWS_WITH( cache.put( "one_too_many", rowFor( 0, dimension ) ), "keySpace is full" );
+            cache.finalize();
+            CHECK( cache.dimension() == dimension );
+            CHECK( cache.numberOfRows() == keys.size() );
+            CHECK( cache.numberOfEntries() == keys.size() );
+
+            // Rows start 32-byte aligned in the file, which the header precedes
+            for ( const auto & [key, value] : keys )
+            {
+                const auto offset = reinterpret_cast<const uint8_t *>( cache.getRow( key ).data() ) - cache.getKeySpacePtr();
+                CHECK( ( sizeof( CacheHeader ) + offset ) % embedding::kRowAlignment == 0U );
+            }
+
+            const auto reader = reload( cache );
+            for ( const auto * embedding : { static_cast<const EmbeddingCache *>( &cache ), static_cast<const EmbeddingCache *>( reader.get() ) } )
+            {
+                ix = 0;
+                for ( const auto & [key, value] : keys )
+                {
+                    const auto expected = rowFor( ix++, dimension );
+                    CHECK( embedding->contains( key ) );
+                    CHECK( embedding->contains( key, EmbeddingCache::hashKey( key ) ) );
+                    CHECK( std::vector<float>( embedding->getRow( key ).begin(), embedding->getRow( key ).end() ) == expected );
+                    CHECK( embedding->getFloatVector( key ) == expected );
+                    CHECK( embedding->getFloatVector( key, EmbeddingCache::hashKey( key ) ) == expected );
+                    CHECK( embedding->getKeyType( key ) == "FloatList" );
+                }
+                uint64_t foundHash = 1U;
+                CHECK_FALSE( embedding->contains( "embedding_missing_key", &foundHash ) );
+                CHECK( foundHash == 0U );
+                CHECK( embedding->getRow( "embedding_missing_key" ).empty() );
+                CHECK( embedding->getFloatVector( "embedding_missing_key" ).empty() );
+            }
+        }
+    }
+}
+
+TEST_CASE( "EmbeddingCacheTestGatherRows" )
+{
+    auto cache = CacheFactory::createCache( 30U, 200UL, 0.5, CacheType::EMBEDDING );
+    auto & embedding = dynamic_cast<EmbeddingCache &>( *cache );
+    std::vector<std::string> keys;
+    for ( size_t ix = 0; ix < 80; ++ix )
+    {
+        keys.push_back( "row_" + std::to_string( ix ) );
+        embedding.put( keys.back(), rowFor( ix, 12 ) );
+    }
+    embedding.finalize();
+
+    // More keys than one batch, with missing keys in between
+    std::vector<std::string_view> batch;
+    for ( size_t ix = 0; ix < 90; ++ix )
+    {
+        batch.emplace_back( ix % 9 == 4 ? std::string_view{ "missing" } : std::string_view{ keys[( ix * 7 ) % keys.size()] } );
+    }
+    std::vector<float> out( batch.size() * 12U, -1.0F );
+    const auto found = std::make_unique<bool[]>( batch.size() );
+    CHECK( embedding.gatherRows( batch, out.data(), found.get() ) == 80U );
+    for ( size_t ix = 0; ix < batch.size(); ++ix )
+    {
+        const std::vector<float> row( out.begin() + static_cast<std::ptrdiff_t>( ix * 12U ), out.begin() + static_cast<std::ptrdiff_t>( ( ix + 1U ) * 12U ) );
+        CHECK( found[ix] == ( ix % 9 != 4 ) );
+        CHECK( row == ( ix % 9 == 4 ? std::vector<float>( 12U, 0.0F ) : rowFor( ( ix * 7 ) % keys.size(), 12 ) ) );
+    }
+    CHECK( embedding.gatherRows( {}, out.data() ) == 0U );
+
+    // The rows score like FloatList values of any other cache
+    const std::vector<float> query( 12U, 1.0F );
+    CHECK( embedding.dotProduct( "row_1", query ).second );
+    CHECK_FALSE( embedding.dotProduct( "missing", query ).second );
+    const std::vector<std::string_view> candidates{ "row_3", "missing", "row_9" };
+    CHECK( embedding.topK( candidates, query, 1U ) == std::vector<std::pair<uint32_t, float>>{ { 2U, embedding.dotProduct( "row_9", query ).first } } );
+}
+
+TEST_CASE( "EmbeddingCacheTestSemantics" )
+{
+    EmbeddingCache embedding( 30U, 100UL, 0.5, std::make_unique<MallocMemoryHandler>() );
+    CHECK( embedding.put( "first", std::vector<float>{ 1.0F, 2.0F, 3.0F } ).first );
+    CHECK_FALSE( embedding.put( "first", std::vector<float>{ 4.0F, 5.0F, 6.0F } ).first );
+    CHECK_THROWS_WITH( embedding.put( "short", std::vector<float>{ 1.0F } ), "EMBEDDING cache rows have 3 floats, key short has 1" );
+    CHECK_THROWS_WITH( embedding.put( "string", std::string{ "x" } ), "EMBEDDING caches only store non empty FloatList values, key string has a String value" );
+    CHECK_THROWS_WITH( embedding.put( "fp16", std::vector<float>{ 1.0F, 2.0F, 3.0F }, CacheValueType::Float16List ), "EMBEDDING caches only store non empty FloatList values, key fp16 has a Float16List value" );
+    embedding.finalize();
+
+    CHECK( embedding.getFloatVector( "first" ) == std::vector<float>{ 1.0F, 2.0F, 3.0F } );
+    CHECK( embedding.getFloatSpan( "first" ).size() == 3U );
+    CHECK( embedding.getWithType( "first" ).second == CacheValueType::FloatList );
+    CHECK( embedding.getFloatAtIndex( "first", 2 ) == 3.0F );
+    CHECK( embedding.getString( "first", "default" ) == std::make_pair( std::string_view{ "default" }, false ) );
+    CHECK( embedding.getInt64( "first", 5 ).second == false );
+    CHECK( embedding.getVector( "first" ).empty() );
+
+    CHECK_THROWS_WITH( EmbeddingCache( 30U, 100UL, 0.5, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kNegativeLookupFilter ),
+                       "Only slot mapping header flags are supported by EMBEDDING caches" );
+}
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <axoncache/cache/HotKeyCache.h>
+#include <axoncache/cache/LinearProbeDedupCache.h>
+#include <axoncache/memory/MallocMemoryHandler.h>
+#include "doctest/doctest.h"
+#include "CacheTestUtils.h"
+
+using namespace axoncache;
+
+namespace
+{
+auto makeCache( std::string_view suffix ) -> std::unique_ptr<LinearProbeDedupCache>
+{
+    auto cache = std::make_unique<LinearProbeDedupCache>( 30U, 1000UL, 0.5, std::make_unique<MallocMemoryHandler>(), CacheType::LINEAR_PROBE_DEDUP_TYPED );
+    cache->put( "string", std::string{ "value" } + std::string{ suffix } );
+    cache->put( "empty", std::string_view{} );
+    int64_t number = 42;
+    cache->put( "int64", number );
+    bool flag = true;
+    cache->put( "bool", flag );
+    double real = 2.5;
+    cache->put( "double", real );
+    cache->put( "list", std::vector<std::string_view>{ "a", "b" } );
+    cache->put( "a_key_longer_than_the_hot_key_cache_entries", std::string{ "long" } + std::string{ suffix } );
+    cache->finalize();
+    return cache;
+}
+}
+
+TEST_CASE( "HotKeyCacheTestSameResults" )
+{
+    const auto cache = makeCache( "" );
+    HotKeyCache<LinearProbeDedupCache>::clear();
+    const HotKeyCache hotKeys( *cache );
+
+    // First round fills the entries, the second one is served from them
+    for ( int round = 0; round < 2; ++round )
+    {
+        CHECK( hotKeys.getString( "string" ) == cache->getString( "string" ) );
+        std::string buffer;
+        CHECK( hotKeys.getString( "string", buffer ) == cache->getString( "string", buffer ) );
+        CHECK( hotKeys.getString( "empty", "default" ) == cache->getString( "empty", "default" ) );
+        CHECK( hotKeys.getString( "int64", "default" ) == std::make_pair( std::string_view{}, true ) );
+        CHECK( hotKeys.getString( "list", "default" ) == std::make_pair( std::string_view{}, true ) );
+        CHECK( hotKeys.getString( "missing", "default" ) == std::make_pair( std::string_view{ "default" }, false ) );
+        CHECK( hotKeys.getString( "a_key_longer_than_the_hot_key_cache_entries" ) == cache->getString( "a_key_longer_than_the_hot_key_cache_entries" ) );
+        CHECK( hotKeys.getInt64( "int64" ) == std::make_pair( int64_t{ 42 }, true ) );
+        CHECK( hotKeys.getInt64( "missing", 7 ) == std::make_pair( int64_t{ 7 }, false ) );
+        CHECK( hotKeys.getBool( "bool" ) == std::make_pair( true, true ) );
+        CHECK( hotKeys.getDouble( "double" ) == std::make_pair( 2.5, true ) );
+        CHECK( hotKeys.getWithType( "int64" ) == cache->getWithType( "int64" ) );
+        CHECK( hotKeys.contains( "empty" ) );
+        CHECK_FALSE( hotKeys.contains( "missing" ) );
+    }
+}
+
+TEST_CASE( "HotKeyCacheTestSwappedCache" )
+{
+    HotKeyCache<LinearProbeDedupCache>::clear();
+    auto cache = makeCache( "_old" );
+    CHECK( HotKeyCache( *cache ).getString( "string" ).first == "value_old" );
+    CHECK( HotKeyCache( *cache ).getString( "string" ).first == "value_old" );
+
+    // The new cache may reuse the address of the old one, its entries still start cold
+    const auto oldInstanceId = cache->instanceId();
+    cache.reset();
+    cache = makeCache( "_new" );
+    CHECK( cache->instanceId() != oldInstanceId );
+    CHECK( HotKeyCache( *cache ).getString( "string" ).first == "value_new" );
+}
+
+TEST_CASE( "HotKeyCacheTestCompressedValues" )
+{
+    LinearProbeDedupCache cache( 30U, 1000UL, 0.5, std::make_unique<MallocMemoryHandler>(), CacheType::LINEAR_PROBE_DEDUP_TYPED, Constants::HeaderFlag::kCompressedValues );
+    cache.put( "string", std::string{ "value" } );
+    cache.finalize();
+    CHECK_THROWS_WITH( static_cast<void>( HotKeyCache<LinearProbeDedupCache>{ cache } ), "Caches with compressed values can't be fronted" );
+}
+
+TEST_CASE( "HotKeyCacheTestAdmission" )
+{
+    // A single entry, every key lands on it
+    using SingleEntry = HotKeyCache<LinearProbeDedupCache, 1>;
+    const auto cache = makeCache( "" );
+    SingleEntry::clear();
+    const SingleEntry hotKeys( *cache );
+
+    for ( int hit = 0; hit < 3; ++hit )
+    {
+        CHECK( hotKeys.getString( "string" ).first == "value" );
+    }
+    // A cold key has to miss as many times as the hot one was hit to take its entry
+    for ( int miss = 0; miss < 5; ++miss )
+    {
+        CHECK( hotKeys.getInt64( "int64" ).first == 42 );
+    }
+    CHECK( hotKeys.getString( "string" ).first == "value" );
+
+    // Entries are per thread
+    std::thread other( [&]()
+                       { CHECK( SingleEntry( *cache ).getDouble( "double" ).first == 2.5 ); } );
+    other.join();
+    CHECK( hotKeys.getBool( "bool" ).first );
+}
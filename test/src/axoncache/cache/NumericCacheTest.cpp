@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <axoncache/cache/HotKeyCache.h>
+#include <axoncache/cache/LinearProbeCache.h>
+#include <axoncache/cache/NumericCache.h>
+#include <axoncache/cache/factory/CacheFactory.h>
+#include <axoncache/memory/MallocMemoryHandler.h>
+#include "doctest/doctest.h"
+#include "CacheTestUtils.h"
+#include "axoncache/Constants.h"
+
+using namespace axoncache;
+
+namespace
+{
+auto reload( NumericCache & cache ) -> std::unique_ptr<NumericCache>
+{
+    CacheHeader header{};
+    header.cacheType = static_cast<uint16_t>( cache.type() );
+    header.hashFuncId = cache.hashFuncId();
+    header.flags = cache.headerFlags();
+    header.offsetBits = cache.offsetBits();
+    header.numberOfKeySlots = cache.numberOfKeySlots();
+    header.numberOfEntries = cache.numberOfEntries();
+    header.maxCollisions = cache.maxCollisions();
+    const auto size = cache.size() - sizeof( CacheHeader );
+    auto memory = std::make_unique<MallocMemoryHandler>();
+    std::memcpy( memory->grow( size ), cache.getKeySpacePtr(), size );
+    return std::make_unique<NumericCache>( header, std::move( memory ) );
+}
+}
+
+TEST_CASE( "NumericCacheTestPutGet" )
+{
+    for ( const auto headerFlags : { 0U, Constants::HeaderFlag::kSlotMappingFastRange, Constants::HeaderFlag::kSlotMappingPow2Mask } )
+    {
+        NumericCache cache( 30U, 4000UL, 0.5, std::make_unique<MallocMemoryHandler>(), headerFlags );
+        const auto keys = test_utils::gen_random_str_map( cache.maxNumberEntries() );
+        int64_t ix = 0;
+        for ( const auto & [key, value] : keys )
+        {
+            if ( ix % 3 == 0 )
+            {
+                int64_t number = -ix * 1000003;
+                REQUIRE( cache.put( key, number ).first );
+            }
+            else if ( ix % 3 == 1 )
+            {
+                double real = static_cast<double>( ix ) / 7.0;
+                REQUIRE( cache.put( key, real ).first );
+            }
+            else
+            {
+                bool flag = ix % 2 == 0;
+                REQUIRE( cache.put( key, flag ).first );
+            }
+            ++ix;
+        }
+        CHECK_THROWS_WITH( cache.put( "one_too_many", std::string{ "x" } ), "NUMERIC caches only store Int64, Double and Bool values, key one_too_many has a String value" );
+        CHECK_THROWS_WITH( cache.put( "one_too_many", std::vector<float>{ 1.0F } ), "NUMERIC caches only store Int64, Double and Bool values, key one_too_many has a FloatList value" );
+        int64_t extra = 1;
+        CHECK_THROWS_WITH( cache.put( "one_too_many", extra ), "keySpace is full" );
+        cache.finalize();
+        CHECK( cache.numberOfEntries() == keys.size() );
+        CHECK( cache.size() == sizeof( CacheHeader ) + cache.numberOfKeySlots() * sizeof( numeric::Entry ) );
+
+        const auto reader = reload( cache );
+        for ( const auto * numeric : { static_cast<const NumericCache *>( &cache ), static_cast<const NumericCache *>( reader.get() ) } )
+        {
+            ix = 0;
+            for ( const auto & [key, value] : keys )
+            {
+                CHECK( numeric->contains( key ) );
+                CHECK( numeric->contains( key, NumericCache::hashKey( key ) ) );
+                if ( ix % 3 == 0 )
+                {
+                    CHECK( numeric->getInt64( key ) == std::make_pair( -ix * 1000003, true ) );
+                    CHECK( numeric->getInt64( key, NumericCache::hashKey( key ) ) == std::make_pair( -ix * 1000003, true ) );
+                    CHECK( numeric->getWithType( key ).second == CacheValueType::Int64 );
+                }
+                else if ( ix % 3 == 1 )
+                {
+                    CHECK( numeric->getDouble( key ) == std::make_pair( static_cast<double>( ix ) / 7.0, true ) );
+                    CHECK( numeric->getDouble( key, NumericCache::hashKey( key ) ) == std::make_pair( static_cast<double>( ix ) / 7.0, true ) );
+                }
+                else
+                {
+                    CHECK( numeric->getBool( key ) == std::make_pair( ix % 2 == 0, true ) );
+                    CHECK( numeric->getBool( key, NumericCache::hashKey( key ) ) == std::make_pair( ix % 2 == 0, true ) );
+                    CHECK( numeric->getKeyType( key ) == "Bool" );
+                }
+                ++ix;
+            }
+            uint64_t foundHash = 1U;
+            CHECK_FALSE( numeric->contains( "numeric_missing_key", &foundHash ) );
+            CHECK( foundHash == 0U );
+            CHECK( numeric->getInt64( "numeric_missing_key", 7 ) == std::make_pair( int64_t{ 7 }, false ) );
+            CHECK( numeric->getDouble( "numeric_missing_key", 0.5 ) == std::make_pair( 0.5, false ) );
+            CHECK( numeric->getBool( "numeric_missing_key", true ) == std::make_pair( true, false ) );
+        }
+    }
+}
+
+TEST_CASE( "NumericCacheTestSemantics" )
+{
+    auto cache = CacheFactory::createCache( 30U, 100UL, 0.5, CacheType::NUMERIC );
+    auto & numeric = dynamic_cast<NumericCache &>( *cache );
+    int64_t number = 42;
+    double real = 2.5;
+    bool flag = true;
+    CHECK( numeric.put( "int64", number ).first );
+    CHECK( numeric.put( "double", real ).first );
+    CHECK( numeric.put( "bool", flag ).first );
+    CHECK( numeric.put( "zero", number = 0 ).first );
+    CHECK_FALSE( numeric.put( "int64", number ).first );
+    CHECK_FALSE( numeric.put( "int64", real ).first );
+    numeric.finalize();
+
+    // Same results as a LINEAR_PROBE cache holding the same values
+    LinearProbeCache linearProbe( 30U, 100UL, 0.5, std::make_unique<MallocMemoryHandler>() );
+    linearProbe.put( "int64", number = 42 );
+    linearProbe.put( "double", real );
+    linearProbe.put( "bool", flag );
+    linearProbe.put( "zero", number = 0 );
+    linearProbe.finalize();
+    for ( const auto * key : { "int64", "double", "bool", "zero", "missing" } )
+    {
+        CHECK( numeric.getInt64( key, 5 ) == linearProbe.getInt64( key, 5 ) );
+        CHECK( numeric.getDouble( key, 0.5 ) == linearProbe.getDouble( key, 0.5 ) );
+        CHECK( numeric.getBool( key, true ) == linearProbe.getBool( key, true ) );
+        CHECK( numeric.getKeyType( key ) == linearProbe.getKeyType( key ) );
+        CHECK( numeric.get( key, "default" ) == "default" );
+        CHECK( numeric.getString( key, "default" ) == std::make_pair( std::string_view{ "default" }, false ) );
+        CHECK( numeric.getVector( key ).empty() );
+        CHECK( numeric.getFloatVector( key ).empty() );
+    }
+
+    const HotKeyCache<NumericCache> hotKeyCache( numeric );
+    for ( auto pass = 0; pass < 2; ++pass )
+    {
+        CHECK( hotKeyCache.getInt64( "int64" ) == std::make_pair( int64_t{ 42 }, true ) );
+        CHECK( hotKeyCache.getDouble( "double" ) == std::make_pair( 2.5, true ) );
+        CHECK( hotKeyCache.getBool( "bool" ) == std::make_pair( true, true ) );
+        CHECK( hotKeyCache.getInt64( "missing", 3 ) == std::make_pair( int64_t{ 3 }, false ) );
+    }
+
+    CHECK_THROWS_WITH( NumericCache( 30U, 100UL, 0.5, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kNegativeLookupFilter ),
+                       "Only slot mapping header flags are supported by NUMERIC caches" );
+}
+
+TEST_CASE( "NumericCacheTestDataSize" )
+{
+    NumericCache numeric( 30U, 20000UL, 0.8, std::make_unique<MallocMemoryHandler>() );
+    LinearProbeCache linearProbe( 30U, 20000UL, 0.8, std::make_unique<MallocMemoryHandler>() );
+    for ( const auto & [key, value] : test_utils::gen_random_str_map( numeric.maxNumberEntries() ) )
+    {
+        int64_t number = static_cast<int64_t>( value.size() );
+        numeric.put( key, number );
+        linearProbe.put( key, number );
+    }
+    numeric.finalize();
+    linearProbe.finalize();
+
+    // 24 bytes per slot against 8 bytes per slot plus a 14 byte record and the key, for keys of 10 to 19 bytes
+    CHECK( numeric.size() < linearProbe.size() );
+}
@@ -358,3 +358,66 @@ TEST_CASE( "FoundHashBucketChainExistingAndMissing" )
     CHECK( cache.get( std::string_view{ "nope" }, {}, &missHash ).empty() );
     CHECK( missHash == expectedHash( "nope" ) );
 }
+
+TEST_CASE( "KeyHashLookupAcrossCaches" )
+{
+    // One hashKey feeds the KeyHash overloads of every cache, whatever its probe
+    const auto numberOfKeySlots = 1000UL;
+    LinearProbeCache current( kOffsetBits, numberOfKeySlots, 0.5, std::make_unique<MallocMemoryHandler>() );
+    LinearProbeCache fallback( kOffsetBits, numberOfKeySlots, 0.5, std::make_unique<MallocMemoryHandler>() );
+    LinearProbeDedupCache typed( kOffsetBits, numberOfKeySlots, 0.5, std::make_unique<MallocMemoryHandler>(), CacheType::LINEAR_PROBE_DEDUP_TYPED );
+    BucketChainCache chained( 64U, numberOfKeySlots, 1.0, std::make_unique<MallocMemoryHandler>() );
+
+    current.put( std::string_view{ "skey" }, std::string_view{ "current" } );
+    fallback.put( std::string_view{ "skey" }, std::string_view{ "fallback" } );
+    typed.put( std::string_view{ "skey" }, std::string_view{ "typed" } );
+    chained.put( std::string_view{ "skey" }, std::string_view{ "chained" } );
+
+    const auto hash = LinearProbeCache::hashKey( "skey" );
+    CHECK( hash.value == expectedHash( "skey" ) );
+    CHECK( current.get( "skey", hash ) == "current" );
+    CHECK( fallback.getString( "skey", hash ) == std::make_pair( std::string_view{ "fallback" }, true ) );
+    CHECK( typed.getString( "skey", hash ) == std::make_pair( std::string_view{ "typed" }, true ) );
+    CHECK( chained.getString( "skey", hash ) == std::make_pair( std::string_view{ "chained" }, true ) );
+    CHECK( current.contains( "skey", hash ) );
+    CHECK( chained.contains( "skey", hash ) );
+
+    const auto missHash = LinearProbeCache::hashKey( "nope" );
+    CHECK( current.get( "nope", missHash, "default" ) == "default" );
+    CHECK( typed.getString( "nope", missHash, "default" ) == std::make_pair( std::string_view{ "default" }, false ) );
+    CHECK_FALSE( current.contains( "nope", missHash ) );
+    CHECK_FALSE( chained.contains( "nope", missHash ) );
+}
+
+TEST_CASE( "KeyHashTypedGetters" )
+{
+    const auto numberOfKeySlots = 1000UL;
+    LinearProbeCache cache( kOffsetBits, numberOfKeySlots, 0.5, std::make_unique<MallocMemoryHandler>() );
+    LinearProbeDedupCache typed( kOffsetBits, numberOfKeySlots, 0.5, std::make_unique<MallocMemoryHandler>(), CacheType::LINEAR_PROBE_DEDUP_TYPED );
+
+    bool boolValue = true;
+    int64_t int64Value = -42;
+    double doubleValue = 2.5;
+    const std::vector<float> floats{ 1.f, 2.f, 3.f };
+    const std::vector<std::string_view> strings{ "a", "bc" };
+    for ( auto * target : { static_cast<LinearProbeCache *>( &cache ), static_cast<LinearProbeCache *>( &typed ) } )
+    {
+        target->put( "bool", boolValue );
+        target->put( "int64", int64Value );
+        target->put( "double", doubleValue );
+        target->put( "floats", floats );
+        target->put( "strings", strings );
+
+        CHECK( target->getBool( "bool", LinearProbeCache::hashKey( "bool" ) ) == std::make_pair( true, true ) );
+        CHECK( target->getInt64( "int64", LinearProbeCache::hashKey( "int64" ) ) == std::make_pair( int64_t{ -42 }, true ) );
+        CHECK( target->getDouble( "double", LinearProbeCache::hashKey( "double" ) ) == std::make_pair( 2.5, true ) );
+        CHECK( target->getFloatVector( "floats", LinearProbeCache::hashKey( "floats" ) ) == floats );
+        CHECK( target->getFloatSpan( "floats", LinearProbeCache::hashKey( "floats" ) ).size() == floats.size() );
+        CHECK( target->getVector( "strings", LinearProbeCache::hashKey( "strings" ) ) == strings );
+        CHECK( target->getWithType( "int64", LinearProbeCache::hashKey( "int64" ) ).second == CacheValueType::Int64 );
+
+        // The hash of another key finds nothing, and the overloads fall back to their defaults
+        CHECK( target->getInt64( "int64", LinearProbeCache::hashKey( "bool" ), 7 ) == std::make_pair( int64_t{ 7 }, false ) );
+        CHECK( target->getBool( "missing", LinearProbeCache::hashKey( "missing" ), true ) == std::make_pair( true, false ) );
+    }
+}
@@ -1,17 +1,25 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2025 AppLovin. All rights reserved.
 
+#include <algorithm>
 #include <string>
 #include <string_view>
 #include <memory>
+#include <span>
 #include <utility>
 #include <axoncache/Constants.h>
+#include <axoncache/cache/BucketChainCache.h>
 #include <axoncache/cache/LinearProbeCache.h>
+#include <axoncache/cache/LinearProbeDedupCache.h>
 #include <axoncache/memory/MallocMemoryHandler.h>
 #include "doctest/doctest.h"
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <map>
 #include <ostream>
+#include <random>
+#include <sstream>
 #include <set>
 #include <stdexcept>
 #include <vector>
@@ -19,6 +27,7 @@
 #include "axoncache/common/StringUtils.h"
 #include "axoncache/cache/CacheType.h"
 #include "axoncache/domain/CacheValue.h"
+#include "axoncache/transformer/FloatListQuantizer.h"
 #include "axoncache/transformer/TypeToString.h"
 
 using namespace axoncache;
@@ -89,6 +98,503 @@ TEST_CASE( "LinearProbeCacheBaseTest" )
     }
 }
 
+TEST_CASE( "LinearProbeCacheBaseTestGetMany" )
+{
+    const auto numberOfKeysSlots = 1000UL;
+    const auto maxLoadFactor = 0.5f;
+    LinearProbeCache cache( 30U, numberOfKeysSlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>() );
+    const auto strMap = axoncache::test_utils::gen_random_str_map( cache.maxNumberEntries() );
+
+    std::vector<std::string_view> keys;
+    for ( const auto & [key, value] : strMap )
+    {
+        cache.put( key, value );
+        keys.emplace_back( key );
+        keys.emplace_back( "missing" );
+    }
+
+    CHECK( cache.getMany( {} ).empty() );
+
+    const auto results = cache.getMany( keys, "default" );
+    CHECK( results.size() == keys.size() );
+    for ( auto ix = 0U; ix < keys.size(); ++ix )
+    {
+        CHECK( results[ix] == cache.getString( keys[ix], "default" ) );
+    }
+    CHECK( results[0].second );
+    CHECK( results[1] == std::make_pair( std::string_view{ "default" }, false ) );
+}
+
+TEST_CASE( "LinearProbeCacheBaseTestRobinHood" )
+{
+    const auto numberOfKeysSlots = 10000UL;
+    const auto maxLoadFactor = 0.8;
+    LinearProbeCache firstCome( 30U, numberOfKeysSlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>() );
+    LinearProbeCache robinHood( 30U, numberOfKeysSlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kRobinHood );
+    CHECK( firstCome.headerFlags() == 0U );
+    CHECK( robinHood.headerFlags() == Constants::HeaderFlag::kRobinHood );
+
+    const auto strMap = axoncache::test_utils::gen_random_str_map( robinHood.maxNumberEntries() );
+    for ( const auto & [key, value] : strMap )
+    {
+        firstCome.put( key, value );
+        robinHood.put( key, value );
+    }
+    CHECK( robinHood.maxCollisions() == firstCome.maxCollisions() );
+
+    robinHood.finalize();
+    CHECK( robinHood.maxCollisions() < firstCome.maxCollisions() );
+    CHECK( robinHood.numberOfEntries() == strMap.size() );
+    for ( const auto & [key, value] : strMap )
+    {
+        CHECK( robinHood.get( key ) == std::string_view{ value } );
+        CHECK_FALSE( robinHood.contains( key + "_missing" ) );
+    }
+
+    // Reordering only moves slots within their cluster, so the same slots stay filled
+    const auto * firstComeSlots = reinterpret_cast<const uint64_t *>( firstCome.getKeySpacePtr() );
+    const auto * robinHoodSlots = reinterpret_cast<const uint64_t *>( robinHood.getKeySpacePtr() );
+    for ( auto slotId = 0U; slotId < numberOfKeysSlots; ++slotId )
+    {
+        CHECK( ( firstComeSlots[slotId] == 0U ) == ( robinHoodSlots[slotId] == 0U ) );
+    }
+
+    CHECK_THROWS_WITH( BucketChainCache( 64U, numberOfKeysSlots, 1.0, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kRobinHood ),
+                       "Robin Hood placement and slot mapping are only supported by linear probe caches" );
+}
+
+TEST_CASE( "LinearProbeCacheBaseTestNegativeLookupFilter" )
+{
+    const auto numberOfKeysSlots = 4000UL;
+    LinearProbeCache cache( 30U, numberOfKeysSlots, 0.8, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kNegativeLookupFilter );
+    const auto strMap = axoncache::test_utils::gen_random_str_map( cache.maxNumberEntries() / 2 );
+    for ( const auto & [key, value] : strMap )
+    {
+        cache.put( key, value );
+    }
+    const auto dataSize = cache.dataSize();
+
+    cache.finalize();
+    CHECK( cache.dataSize() == dataSize );
+    for ( const auto & [key, value] : strMap )
+    {
+        CHECK( cache.get( key ) == std::string_view{ value } );
+        CHECK( cache.contains( key, LinearProbeCache::hashKey( key ) ) );
+    }
+    CHECK_FALSE( cache.contains( "negative_lookup_missing_key" ) );
+    CHECK( cache.getString( "negative_lookup_missing_key", "missing" ) == std::make_pair( std::string_view{ "missing" }, false ) );
+    CHECK_THROWS_WITH( cache.put( "negative_lookup_new_key", "value" ), "can't put into a cache once its negative lookup filter is built" );
+
+    // A reader that ignores the flag steps over the filter through the slot offsets
+    CacheHeader header{};
+    header.offsetBits = cache.offsetBits();
+    header.numberOfKeySlots = cache.numberOfKeySlots();
+    header.numberOfEntries = cache.numberOfEntries();
+    auto memory = std::make_unique<MallocMemoryHandler>();
+    const auto * data = cache.getKeySpacePtr();
+    const auto size = cache.size() - sizeof( CacheHeader );
+    std::memcpy( memory->grow( size ), data, size );
+    const LinearProbeCache oldReader( header, std::move( memory ) );
+    for ( const auto & [key, value] : strMap )
+    {
+        CHECK( oldReader.get( key ) == std::string_view{ value } );
+    }
+
+    CHECK_THROWS_WITH( BucketChainCache( 64U, numberOfKeysSlots, 1.0, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kNegativeLookupFilter ),
+                       "The negative lookup filter is only supported by linear probe caches" );
+}
+
+TEST_CASE( "LinearProbeCacheBaseTestNamespacePrefix" )
+{
+    const auto numberOfKeysSlots = 4000UL;
+    const auto flags = Constants::HeaderFlag::kNamespacePrefix | Constants::HeaderFlag::kRobinHood | Constants::HeaderFlag::kNegativeLookupFilter;
+    LinearProbeCache cache( 30U, numberOfKeysSlots, 0.8, std::make_unique<MallocMemoryHandler>(), flags );
+    LinearProbeCache plainCache( 30U, numberOfKeysSlots, 0.8, std::make_unique<MallocMemoryHandler>() );
+    std::map<std::string, std::string> strMap;
+    for ( const auto & [key, value] : axoncache::test_utils::gen_random_str_map_alpha_numeric( cache.maxNumberEntries() / 2 ) )
+    {
+        strMap.emplace( "resource_" + std::to_string( strMap.size() % 10 ) + "_with_a_long_prefix." + key, value );
+    }
+    strMap.emplace( "no_separator", "value" );
+    strMap.emplace( ".empty_namespace", "value" );
+    strMap.emplace( "two.separators.key", "value" );
+    for ( const auto & [key, value] : strMap )
+    {
+        CHECK( cache.put( key, value ).first );
+        plainCache.put( key, value );
+    }
+    CHECK_FALSE( cache.put( strMap.begin()->first, "again" ).first );
+    CHECK( cache.get( strMap.begin()->first ) == std::string_view{ strMap.begin()->second } );
+
+    cache.finalize();
+    plainCache.finalize();
+    CHECK( cache.dataSize() < plainCache.dataSize() * 3 / 4 );
+    for ( const auto & [key, value] : strMap )
+    {
+        CHECK( cache.get( key ) == std::string_view{ value } );
+        CHECK( cache.contains( key, LinearProbeCache::hashKey( key ) ) );
+    }
+    CHECK_FALSE( cache.contains( "resource_1_with_a_long_prefix.missing_key" ) );
+    CHECK_FALSE( cache.contains( "missing_namespace.key" ) );
+    CHECK_FALSE( cache.contains( "two.separators" ) );
+
+    // A reader finds the namespaces after the filter
+    CacheHeader header{};
+    header.flags = cache.headerFlags();
+    header.offsetBits = cache.offsetBits();
+    header.numberOfKeySlots = cache.numberOfKeySlots();
+    header.numberOfEntries = cache.numberOfEntries();
+    header.maxCollisions = cache.maxCollisions();
+    auto memory = std::make_unique<MallocMemoryHandler>();
+    const auto size = cache.size() - sizeof( CacheHeader );
+    std::memcpy( memory->grow( size ), cache.getKeySpacePtr(), size );
+    const LinearProbeCache reader( header, std::move( memory ) );
+    CHECK( reader.dataSize() == cache.dataSize() );
+    for ( const auto & [key, value] : strMap )
+    {
+        CHECK( reader.get( key ) == std::string_view{ value } );
+    }
+    CHECK_FALSE( reader.contains( "missing_namespace.key" ) );
+
+    CHECK_THROWS_WITH( BucketChainCache( 64U, numberOfKeysSlots, 1.0, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kNamespacePrefix ),
+                       "Namespace prefixes are only supported by linear probe caches" );
+}
+
+TEST_CASE( "LinearProbeCacheBaseTestKeyFingerprint" )
+{
+    const auto numberOfKeysSlots = 4000UL;
+    const auto flags = Constants::HeaderFlag::kKeyFingerprint | Constants::HeaderFlag::kRobinHood | Constants::HeaderFlag::kNegativeLookupFilter;
+    LinearProbeCache cache( 30U, numberOfKeysSlots, 0.8, std::make_unique<MallocMemoryHandler>(), flags );
+    LinearProbeCache plainCache( 30U, numberOfKeysSlots, 0.8, std::make_unique<MallocMemoryHandler>() );
+    std::map<std::string, std::string> strMap;
+    for ( const auto & [key, value] : axoncache::test_utils::gen_random_str_map_alpha_numeric( cache.maxNumberEntries() / 2 ) )
+    {
+        strMap.emplace( std::string( 100, 'k' ) + key, value );
+    }
+    strMap.emplace( "", "empty" );
+    for ( const auto & [key, value] : strMap )
+    {
+        CHECK( cache.put( key, value ).first );
+        plainCache.put( key, value );
+    }
+    CHECK_FALSE( cache.put( strMap.begin()->first, "again" ).first );
+
+    cache.finalize();
+    plainCache.finalize();
+    CHECK( cache.dataSize() < plainCache.dataSize() / 2 );
+    for ( const auto & [key, value] : strMap )
+    {
+        CHECK( cache.get( key ) == std::string_view{ value } );
+        CHECK( cache.contains( key, LinearProbeCache::hashKey( key ) ) );
+    }
+    CHECK_FALSE( cache.contains( std::string( 100, 'k' ) + "missing_key" ) );
+
+    // Records only hold fingerprints, a reader needs the flag to find any key
+    CacheHeader header{};
+    header.flags = cache.headerFlags();
+    header.offsetBits = cache.offsetBits();
+    header.numberOfKeySlots = cache.numberOfKeySlots();
+    header.numberOfEntries = cache.numberOfEntries();
+    header.maxCollisions = cache.maxCollisions();
+    auto memory = std::make_unique<MallocMemoryHandler>();
+    const auto size = cache.size() - sizeof( CacheHeader );
+    std::memcpy( memory->grow( size ), cache.getKeySpacePtr(), size );
+    const LinearProbeCache reader( header, std::move( memory ) );
+    for ( const auto & [key, value] : strMap )
+    {
+        CHECK( reader.get( key ) == std::string_view{ value } );
+    }
+
+    CHECK_THROWS_WITH( LinearProbeCache( 30U, numberOfKeysSlots, 0.5, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kKeyFingerprint | Constants::HeaderFlag::kNamespacePrefix ),
+                       "Key fingerprints and namespace prefixes can't be combined" );
+    CHECK_THROWS_WITH( BucketChainCache( 64U, numberOfKeysSlots, 1.0, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kKeyFingerprint ),
+                       "Key fingerprints are only supported by linear probe caches" );
+}
+
+TEST_CASE( "LinearProbeCacheBaseTestCompressedValues" )
+{
+    const auto numberOfKeysSlots = 4000UL;
+    const auto flags = Constants::HeaderFlag::kCompressedValues | Constants::HeaderFlag::kNegativeLookupFilter;
+    LinearProbeCache cache( 30U, numberOfKeysSlots, 0.5, std::make_unique<MallocMemoryHandler>(), flags );
+    LinearProbeCache plainCache( 30U, numberOfKeysSlots, 0.5, std::make_unique<MallocMemoryHandler>() );
+    CHECK( cache.hasCompressedValues() );
+    // Seeded, so that the size ratio below does not depend on the tests run before this one
+    std::mt19937_64 random( 42 );
+    auto randomString = [&random]()
+    {
+        static constexpr std::string_view kAlphaNumeric = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+        std::string str( 10U + random() % 10U, ' ' );
+        for ( auto & c : str )
+        {
+            c = kAlphaNumeric[random() % kAlphaNumeric.size()];
+        }
+        return str;
+    };
+    std::map<std::string, std::string> strMap;
+    while ( strMap.size() < cache.maxNumberEntries() - 3 )
+    {
+        strMap.emplace( randomString(), R"({"campaign_id":")" + randomString() + R"(","country":"US","platform":"android","bid_floor":0.25,"creative_type":"video","enabled":true})" );
+    }
+    strMap.emplace( "short", "x" );
+    strMap.emplace( "empty", "" );
+    for ( const auto & [key, value] : strMap )
+    {
+        cache.put( key, value );
+        plainCache.put( key, value );
+    }
+    int64_t number = 42;
+    cache.put( "number", number );
+
+    cache.finalize();
+    plainCache.finalize();
+    // About 3x smaller with this template, whatever the seed
+    CHECK( cache.dataSize() * 5U < plainCache.dataSize() * 2U );
+
+    std::vector<std::string_view> keys;
+    std::string buffer;
+    for ( const auto & [key, value] : strMap )
+    {
+        CHECK( cache.getString( key, buffer ) == std::make_pair( std::string_view{ value }, true ) );
+        CHECK( cache.getString( key, LinearProbeCache::hashKey( key ), buffer ).first == std::string_view{ value } );
+        CHECK( cache.getWithType( key, buffer ).first == std::string_view{ value } );
+        CHECK( cache.getKeyType( key ) == "String" );
+        keys.emplace_back( key );
+    }
+    CHECK( cache.getString( "missing_key", buffer, "default" ) == std::make_pair( std::string_view{ "default" }, false ) );
+    CHECK( cache.getInt64( "number" ).first == 42 );
+    CHECK_FALSE( cache.contains( "missing_key" ) );
+
+    // Views of the cache can't hold a compressed value, the getters without a buffer use one of the thread
+    const auto & [longKey, longValue] = *strMap.rbegin();
+    CHECK( cache.get( longKey ) == std::string_view{ longValue } );
+    CHECK( cache.getString( longKey ).first == std::string_view{ longValue } );
+    CHECK( cache.getWithType( longKey ).first == std::string_view{ longValue } );
+
+    // Every value of getMany has a buffer of its own, not only the last decompressed one
+    std::vector<std::string> buffers;
+    const auto results = cache.getMany( keys, buffers );
+    CHECK( buffers.size() == keys.size() );
+    for ( auto ix = 0U; ix < keys.size(); ++ix )
+    {
+        CHECK( results[ix] == std::make_pair( std::string_view{ strMap.at( std::string{ keys[ix] } ) }, true ) );
+    }
+    const auto threadResults = cache.getMany( keys );
+    for ( auto ix = 0U; ix < keys.size(); ++ix )
+    {
+        CHECK( threadResults[ix] == std::make_pair( std::string_view{ strMap.at( std::string{ keys[ix] } ) }, true ) );
+    }
+
+    CacheHeader header{};
+    header.flags = cache.headerFlags();
+    header.offsetBits = cache.offsetBits();
+    header.numberOfKeySlots = cache.numberOfKeySlots();
+    header.numberOfEntries = cache.numberOfEntries();
+    auto memory = std::make_unique<MallocMemoryHandler>();
+    const auto size = cache.size() - sizeof( CacheHeader );
+    std::memcpy( memory->grow( size ), cache.getKeySpacePtr(), size );
+    const LinearProbeCache reader( header, std::move( memory ) );
+    CHECK( reader.dataSize() == cache.dataSize() );
+    for ( const auto & [key, value] : strMap )
+    {
+        CHECK( reader.getString( key, buffer ).first == std::string_view{ value } );
+    }
+    CHECK( reader.getInt64( "number" ).first == 42 );
+
+    CHECK_THROWS_WITH( BucketChainCache( 64U, numberOfKeysSlots, 1.0, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kCompressedValues ),
+                       "Compressed values are only supported by linear probe caches" );
+}
+
+TEST_CASE( "LinearProbeCacheBaseTestSharedValues" )
+{
+    const auto numberOfKeysSlots = 4000UL;
+    for ( const auto flags : { Constants::HeaderFlag::kSharedValues, Constants::HeaderFlag::kSharedValues | Constants::HeaderFlag::kNegativeLookupFilter } )
+    {
+        LinearProbeCache cache( 30U, numberOfKeysSlots, 0.5, std::make_unique<MallocMemoryHandler>(), flags );
+        LinearProbeCache plainCache( 30U, numberOfKeysSlots, 0.5, std::make_unique<MallocMemoryHandler>() );
+        // A long tail of values repeated a few times each, and short ones written again
+        std::map<std::string, std::string> strMap;
+        auto ix = 0U;
+        for ( const auto & [key, value] : axoncache::test_utils::gen_random_str_map_alpha_numeric( cache.maxNumberEntries() - 2 ) )
+        {
+            strMap.emplace( key, ix % 5U == 0U ? std::to_string( ix % 50U ) : "https://cdn.example.com/creative/" + std::to_string( ix % 300U ) + ".mp4" );
+            ++ix;
+        }
+        for ( const auto & [key, value] : strMap )
+        {
+            cache.put( key, value );
+            plainCache.put( key, value );
+        }
+        const std::vector<float> floats{ 1.0F, 2.0F, 3.0F, 4.0F };
+        cache.put( "floats", floats );
+        cache.put( "bf16", floats, CacheValueType::BFloat16List );
+
+        cache.finalize();
+        plainCache.finalize();
+        // About 8 bytes instead of 39 for most records
+        CHECK( cache.dataSize() * 3U < plainCache.dataSize() * 2U );
+
+        CacheHeader header{};
+        header.flags = cache.headerFlags();
+        header.offsetBits = cache.offsetBits();
+        header.numberOfKeySlots = cache.numberOfKeySlots();
+        header.numberOfEntries = cache.numberOfEntries();
+        auto memory = std::make_unique<MallocMemoryHandler>();
+        const auto size = cache.size() - sizeof( CacheHeader );
+        std::memcpy( memory->grow( size ), cache.getKeySpacePtr(), size );
+        const LinearProbeCache reader( header, std::move( memory ) );
+        for ( const auto * linearProbe : { static_cast<const LinearProbeCache *>( &cache ), &reader } )
+        {
+            std::map<std::string, const char *> valueData;
+            for ( const auto & [key, value] : strMap )
+            {
+                const auto found = linearProbe->get( key );
+                CHECK( found == std::string_view{ value } );
+                CHECK( linearProbe->getWithType( key ).first == std::string_view{ value } );
+                // Still a view into the cache, the same one for every key with a long value
+                const auto [iter, isNew] = valueData.emplace( value, found.data() );
+                CHECK( ( isNew || value.size() <= sizeof( int64_t ) || iter->second == found.data() ) );
+            }
+            CHECK( linearProbe->getFloatVector( "floats" ) == floats );
+            CHECK( linearProbe->getFloatVector( "bf16" ) == floats );
+            CHECK( linearProbe->getKeyType( "bf16" ) == "BFloat16List" );
+        }
+    }
+
+    CHECK_THROWS_WITH( LinearProbeCache( 30U, numberOfKeysSlots, 0.5, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kSharedValues | Constants::HeaderFlag::kCompressedValues ),
+                       "Shared values and compressed values can't be combined" );
+    CHECK_THROWS_WITH( BucketChainCache( 64U, numberOfKeysSlots, 1.0, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kSharedValues ),
+                       "Shared values are only supported by linear probe caches" );
+}
+
+TEST_CASE( "LinearProbeCacheBaseTestAlignedValues" )
+{
+    const auto numberOfKeysSlots = 4000UL;
+    for ( const auto flags : { Constants::HeaderFlag::kAlignedValues16,
+                               Constants::HeaderFlag::kAlignedValues8 | Constants::HeaderFlag::kRobinHood | Constants::HeaderFlag::kNamespacePrefix,
+                               Constants::HeaderFlag::kAlignedValues16 | Constants::HeaderFlag::kCompressedValues | Constants::HeaderFlag::kNegativeLookupFilter,
+                               Constants::HeaderFlag::kAlignedValues16 | Constants::HeaderFlag::kSharedValues } )
+    {
+        LinearProbeCache cache( 30U, numberOfKeysSlots, 0.5, std::make_unique<MallocMemoryHandler>(), flags );
+        const auto alignment = ( flags & Constants::HeaderFlag::kAlignedValues16 ) != 0U ? 16U : 8U;
+
+        // Keys of every length, so that packed values would land anywhere
+        std::map<std::string, CacheValue> values;
+        std::vector<std::string> strings;
+        strings.reserve( cache.maxNumberEntries() );
+        auto ix = 0;
+        for ( const auto & [key, value] : axoncache::test_utils::gen_random_str_map_alpha_numeric( cache.maxNumberEntries() ) )
+        {
+            const std::vector<float> floats( static_cast<size_t>( ix % 9 + 1 ), static_cast<float>( ix % 50 ) );
+            strings.emplace_back( R"({"campaign_id":")" + std::to_string( ix % 40 ) + R"(","country":"US","platform":"android"})" );
+            int64_t number = ix;
+            double ratio = ix / 8.0;
+            switch ( ix % 5 )
+            {
+                case 0:
+                    values.emplace( key, CacheValue( number ) );
+                    break;
+                case 1:
+                    values.emplace( key, CacheValue( ratio ) );
+                    break;
+                case 2:
+                    values.emplace( key, CacheValue( floats ) );
+                    break;
+                case 3:
+                    values.emplace( key, CacheValue( floats, CacheValueType::Int8List ) );
+                    break;
+                default:
+                    values.emplace( key, CacheValue( std::string_view{ strings.back() } ) );
+                    break;
+            }
+            ++ix;
+        }
+        for ( const auto & [key, value] : values )
+        {
+            switch ( value.type() )
+            {
+                case CacheValueType::Int64:
+                {
+                    auto number = value.asInt64();
+                    cache.put( key, number );
+                    break;
+                }
+                case CacheValueType::Double:
+                {
+                    auto ratio = value.asDouble();
+                    cache.put( key, ratio );
+                    break;
+                }
+                case CacheValueType::String:
+                    cache.put( key, value.asString() );
+                    break;
+                default:
+                    cache.put( key, value.asFloatList(), value.type() );
+                    break;
+            }
+        }
+        cache.finalize();
+
+        CacheHeader header{};
+        header.flags = cache.headerFlags();
+        header.offsetBits = cache.offsetBits();
+        header.numberOfKeySlots = cache.numberOfKeySlots();
+        header.numberOfEntries = cache.numberOfEntries();
+        header.maxCollisions = cache.maxCollisions();
+        auto memory = std::make_unique<MallocMemoryHandler>();
+        const auto size = cache.size() - sizeof( CacheHeader );
+        std::memcpy( memory->grow( size ), cache.getKeySpacePtr(), size );
+        LinearProbeCache reader( header, std::move( memory ) );
+        std::string buffer;
+        for ( auto * linearProbe : { &cache, &reader } )
+        {
+            for ( const auto & [key, value] : values )
+            {
+                const auto [found, type] = linearProbe->getWithType( key, buffer );
+                REQUIRE( type == value.type() );
+                // Offset in the cache file, the data follows the header
+                const auto fileOffset = sizeof( CacheHeader ) + static_cast<uint64_t>( reinterpret_cast<const uint8_t *>( found.data() ) - linearProbe->getKeySpacePtr() );
+                switch ( type )
+                {
+                    case CacheValueType::Int64:
+                        CHECK( fileOffset % 8U == 0U );
+                        CHECK( linearProbe->getInt64( key ).first == value.asInt64() );
+                        break;
+                    case CacheValueType::Double:
+                        CHECK( fileOffset % 8U == 0U );
+                        CHECK( linearProbe->getDouble( key ).first == value.asDouble() );
+                        break;
+                    case CacheValueType::FloatList:
+                        CHECK( fileOffset % alignment == 0U );
+                        CHECK( std::vector<float>( linearProbe->getFloatSpan( key ).begin(), linearProbe->getFloatSpan( key ).end() ) == value.asFloatList() );
+                        break;
+                    case CacheValueType::Int8List:
+                        CHECK( fileOffset % alignment == 0U );
+                        CHECK( linearProbe->getFloatVector( key ).size() == value.asFloatList().size() );
+                        break;
+                    default:
+                        CHECK( linearProbe->getString( key, buffer ).first == value.asString() );
+                        break;
+                }
+            }
+        }
+    }
+
+    LinearProbeCache packed( 30U, 100UL, 0.5, std::make_unique<MallocMemoryHandler>() );
+    LinearProbeCache aligned( 30U, 100UL, 0.5, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kAlignedValues16 );
+    const std::vector<float> floats{ 1.0F, 2.0F, 3.0F };
+    packed.put( "floats", floats );
+    aligned.put( "floats", floats );
+    CHECK( packed.dataSize() <= aligned.dataSize() );
+    CHECK( aligned.dataSize() < packed.dataSize() + 16U );
+
+    CHECK_THROWS_WITH( LinearProbeCache( 30U, numberOfKeysSlots, 0.5, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kAlignedValues8 | Constants::HeaderFlag::kAlignedValues16 ),
+                       "Only one value alignment can be set in header flags 1536" );
+    CHECK_THROWS_WITH( BucketChainCache( 64U, numberOfKeysSlots, 1.0, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kAlignedValues8 ),
+                       "Aligned values are only supported by linear probe caches" );
+    CHECK( linear::valueAlignmentHeaderFlag( 16 ) == Constants::HeaderFlag::kAlignedValues16 );
+    CHECK_THROWS_WITH( linear::valueAlignmentHeaderFlag( 4 ), "Unknown value alignment 4, expected one of 0, 8, 16" );
+}
+
 TEST_CASE( "LinearProbeCacheBaseTestGetVectorKeyspaceFull" )
 {
     const auto numberOfKeysSlots = 1000UL;
@@ -166,6 +672,39 @@ TEST_CASE( "LinearProbeCacheBaseTestGetVector" )
     }
 }
 
+TEST_CASE( "LinearProbeCacheBaseTestIndexedStringLists" )
+{
+    for ( const auto headerFlags : { 0U, Constants::HeaderFlag::kIndexedStringLists } )
+    {
+        LinearProbeCache cache( 35U, 1000UL, 0.5, std::make_unique<MallocMemoryHandler>(), headerFlags );
+        const auto strMap = axoncache::test_utils::gen_random_str_vec_map( cache.maxNumberEntries() - 1U );
+        for ( const auto & [key, value] : strMap )
+        {
+            cache.put( key, std::vector<std::string_view>( value.begin(), value.end() ) );
+        }
+        cache.put( "empty", std::vector<std::string_view>{} );
+
+        for ( const auto & [key, value] : strMap )
+        {
+            CHECK( cache.getVectorSize( key ) == value.size() );
+            CHECK( cache.getVectorSize( key, LinearProbeCache::hashKey( key ) ) == value.size() );
+            for ( size_t ix = 0; ix < value.size(); ++ix )
+            {
+                CHECK( cache.getVectorElement( key, ix ) == value[ix] );
+                CHECK( cache.getVectorElement( key, LinearProbeCache::hashKey( key ), ix ) == value[ix] );
+            }
+            CHECK( cache.getVectorElement( key, value.size(), "default" ) == "default" );
+            CHECK( cache.getVector( key ) == std::vector<std::string_view>( value.begin(), value.end() ) );
+        }
+        CHECK( cache.getVectorSize( "empty" ) == 0U );
+        CHECK( cache.getVectorElement( "empty", 0, "default" ) == "default" );
+        CHECK( cache.getVectorSize( "missing" ) == 0U );
+        CHECK( cache.getVectorElement( "missing", 0, "default" ) == "default" );
+        // Readers from before the flag would see empty lists
+        CHECK( cache.formatVersion() == ( headerFlags == 0U ? Constants::kBaseFormatVersion : cache.version() ) );
+    }
+}
+
 TEST_CASE( "LinearProbeTestOffsetBitsTooShort" )
 {
     const uint16_t offsetBits = 16U;
@@ -647,3 +1186,389 @@ TEST_CASE( "LinearProbeCachePutAPItest" )
     CHECK( cache.readKey( std::string_view{ "key3.1" } ) == std::string_view{} );
     CHECK( cache.readKeys( std::string_view{ "key3.1" } ) == std::vector<std::string_view>{} );
 }
+
+TEST_CASE( "LinearProbeCacheQuantizedFloatListTest" )
+{
+    LinearProbeCache cache( 35U, 100UL, 0.5, std::make_unique<MallocMemoryHandler>() );
+    LinearProbeCache floatCache( 35U, 100UL, 0.5, std::make_unique<MallocMemoryHandler>() );
+    std::vector<float> values( 64 );
+    for ( size_t i = 0; i < values.size(); ++i )
+    {
+        values[i] = static_cast<float>( i ) * 0.25F - 8.0F;
+    }
+    cache.put( "fp16", values, CacheValueType::Float16List );
+    cache.put( "bf16", values, CacheValueType::BFloat16List );
+    cache.put( "int8", values, CacheValueType::Int8List );
+    cache.put( "fp32", values, CacheValueType::FloatList );
+    floatCache.put( "fp32", values );
+    // Readers of the base format would take the quantized bytes for another type
+    CHECK( cache.formatVersion() == cache.version() );
+    CHECK( floatCache.formatVersion() == Constants::kBaseFormatVersion );
+    CHECK_THROWS_WITH( cache.put( "double", values, CacheValueType::Double ), "Can't store a FloatList as Double" );
+
+    // Multiples of 0.25 within +-8 are exact in fp16 and bf16
+    CHECK( cache.getFloatVector( "fp16" ) == values );
+    CHECK( cache.getFloatVector( "bf16" ) == values );
+    CHECK( cache.getFloatVector( "fp32" ) == values );
+    const auto int8Values = cache.getFloatVector( "int8" );
+    REQUIRE( int8Values.size() == values.size() );
+    for ( size_t i = 0; i < values.size(); ++i )
+    {
+        CHECK( std::fabs( int8Values[i] - values[i] ) <= 8.0F / 127.0F / 2.0F + 1e-6F );
+    }
+
+    for ( const auto * key : { "fp16", "bf16", "int8" } )
+    {
+        CHECK( cache.getFloatAtIndex( key, 5 ) == cache.getFloatVector( key )[5] );
+        CHECK( cache.getFloatAtIndex( key, 64 ) == 0.0F );
+        CHECK( cache.getFloatAtIndex( key, -1 ) == 0.0F );
+        CHECK( cache.getFloatAtIndices( key, { 63, 64, 0 } ) == std::vector<float>{ cache.getFloatVector( key )[63], 0.0F, cache.getFloatVector( key )[0] } );
+        CHECK_THROWS( static_cast<void>( cache.getFloatSpan( key ) ) );
+        CHECK( cache.getVector( key ).empty() );
+    }
+
+    // getWithType gives the quantized bytes and their type
+    CHECK( cache.getWithType( "fp16" ) == std::make_pair( std::string_view{ FloatListQuantizer::quantize( values, CacheValueType::Float16List ) }, CacheValueType::Float16List ) );
+    CHECK( cache.getWithType( "bf16" ).second == CacheValueType::BFloat16List );
+    CHECK( cache.getWithType( "int8" ).second == CacheValueType::Int8List );
+    CHECK( cache.getWithType( "int8" ).first.size() == sizeof( float ) + values.size() );
+    CHECK( cache.getKeyType( "fp16" ) == "Float16List" );
+    CHECK( cache.getKeyType( "fp32" ) == "FloatList" );
+
+    // Quantized values keep their type through the frequent values of a dedup cache
+    LinearProbeDedupCache dedupCache( 35U, 100UL, 0.5, std::make_unique<MallocMemoryHandler>(), CacheType::LINEAR_PROBE_DEDUP );
+    std::vector<std::string> duplicatedValues( 300 );
+    duplicatedValues[2] = FloatListQuantizer::quantize( values, CacheValueType::BFloat16List );
+    duplicatedValues[299] = FloatListQuantizer::quantize( values, CacheValueType::Int8List );
+    dedupCache.setDuplicatedValues( duplicatedValues );
+    dedupCache.put( "bf16", values, CacheValueType::BFloat16List );
+    dedupCache.put( "int8", values, CacheValueType::Int8List );
+    CHECK( dedupCache.getWithType( "bf16" ) == cache.getWithType( "bf16" ) );
+    CHECK( dedupCache.getWithType( "int8" ) == cache.getWithType( "int8" ) );
+    CHECK( dedupCache.getFloatVector( "int8" ) == int8Values );
+}
+
+TEST_CASE( "LinearProbeCacheFloatListScoreTest" )
+{
+    LinearProbeCache cache( 35U, 100UL, 0.5, std::make_unique<MallocMemoryHandler>() );
+    std::vector<float> values( 24 );
+    for ( size_t i = 0; i < values.size(); ++i )
+    {
+        values[i] = static_cast<float>( i ) * 0.25F - 3.0F;
+    }
+    const std::vector<float> query( values.size(), 1.0F );
+    float expectedDot = 0;
+    for ( const auto value : values )
+    {
+        expectedDot += value;
+    }
+    cache.put( "fp32", values );
+    cache.put( "fp16", values, CacheValueType::Float16List );
+    cache.put( "twice", std::vector<float>( values.size(), 2.0F ) );
+    cache.put( "negative", std::vector<float>( values.size(), -1.0F ) );
+    cache.put( "short", std::vector<float>{ 1.0F } );
+    cache.put( "string", std::string_view{ "abc" } );
+
+    // Multiples of 0.25 within +-8 are exact in fp16, so both sum the same floats
+    CHECK( cache.dotProduct( "fp32", query ) == std::make_pair( expectedDot, true ) );
+    CHECK( cache.dotProduct( "fp16", query ) == std::make_pair( expectedDot, true ) );
+    CHECK( std::fabs( cache.cosineSimilarity( "twice", query ).first - 1.0F ) <= 1e-6F );
+    CHECK( std::fabs( cache.cosineSimilarity( "negative", query ).first + 1.0F ) <= 1e-6F );
+    CHECK_FALSE( cache.dotProduct( "short", query ).second );
+    CHECK_FALSE( cache.dotProduct( "string", query ).second );
+    CHECK_FALSE( cache.dotProduct( "missing", query ).second );
+
+    const std::vector<std::string_view> keys{ "negative", "missing", "twice", "fp32", "short", "fp16" };
+    std::vector<float> scores( keys.size() );
+    CHECK( cache.scoreMany( keys, query, scores, FloatListScore::DotProduct, -100.0F ) == 4U );
+    CHECK( scores == std::vector<float>{ -24.0F, -100.0F, 48.0F, expectedDot, -100.0F, expectedDot } );
+    CHECK_THROWS_WITH( cache.scoreMany( keys, query, std::span<float>{ scores.data(), 2U } ), "scoreMany needs one score per key, got 2 for 6 keys" );
+
+    CHECK( cache.topK( keys, query, 2U ) == std::vector<std::pair<uint32_t, float>>{ { 2U, 48.0F }, { 3U, expectedDot } } );
+    CHECK( cache.topK( keys, query, 10U ).size() == 4U );
+    CHECK( cache.topK( keys, query, 10U ).back() == std::make_pair( 0U, -24.0F ) );
+    CHECK( cache.topK( keys, query, 0U ).empty() );
+    const auto byCosine = cache.topK( keys, query, 1U, FloatListScore::Cosine );
+    REQUIRE( byCosine.size() == 1U );
+    CHECK( byCosine[0].first == 2U );
+}
+
+namespace
+{
+auto reloadDedup( const LinearProbeDedupCache & cache ) -> std::unique_ptr<LinearProbeDedupCache>
+{
+    CacheHeader header{};
+    header.cacheType = static_cast<uint16_t>( cache.type() );
+    header.flags = cache.headerFlags();
+    header.offsetBits = cache.offsetBits();
+    header.numberOfKeySlots = cache.numberOfKeySlots();
+    header.numberOfEntries = cache.numberOfEntries();
+    std::ostringstream output;
+    cache.output( output );
+    const auto bytes = output.str();
+    auto memory = std::make_unique<MallocMemoryHandler>();
+    std::memcpy( memory->grow( bytes.size() ), bytes.data(), bytes.size() );
+    return std::make_unique<LinearProbeDedupCache>( header, std::move( memory ) );
+}
+}
+
+TEST_CASE( "LinearProbeDedupCacheFrequentValues" )
+{
+    const auto numberOfKeysSlots = 8000UL;
+    for ( const auto flags : { 0U, Constants::HeaderFlag::kCompressedValues, Constants::HeaderFlag::kSharedValues, Constants::HeaderFlag::kAlignedValues16 } )
+    {
+        LinearProbeDedupCache cache( 30U, numberOfKeysSlots, 0.5, std::make_unique<MallocMemoryHandler>(), CacheType::LINEAR_PROBE_DEDUP_TYPED, flags );
+        LinearProbeDedupCache plainCache( 30U, numberOfKeysSlots, 0.5, std::make_unique<MallocMemoryHandler>(), CacheType::LINEAR_PROBE_DEDUP_TYPED, flags );
+        cache.detectFrequentValues( 16U );
+
+        // A few values shared by most keys, skewed so the sketch has heavy hitters to find
+        std::map<std::string, std::string> strMap;
+        auto ix = 0U;
+        for ( const auto & [key, value] : axoncache::test_utils::gen_random_str_map_alpha_numeric( cache.maxNumberEntries() - 1 ) )
+        {
+            const auto rank = ix % 7U == 0U ? ix : ( ix % 97U ) % ( 1U + ix % 13U );
+            strMap.emplace( key, rank == ix ? value : "https://cdn.example.com/creative/" + std::to_string( rank ) + ".mp4" );
+            ++ix;
+        }
+        for ( const auto & [key, value] : strMap )
+        {
+            cache.put( key, value );
+            plainCache.put( key, value );
+        }
+        const std::vector<std::string_view> list{ "https://cdn.example.com/creative/0.mp4", "android" };
+        cache.put( "list", list );
+        plainCache.put( "list", list );
+
+        cache.finalize();
+        plainCache.finalize();
+        CHECK( cache.getDuplicatedValues().size() == 13U );
+        CHECK( cache.formatVersion() == ( ( flags & Constants::HeaderFlag::kIncompatibleFlags ) == 0U ? Constants::kBaseFormatVersion : cache.version() ) );
+        CHECK( cache.getDuplicatedValues()[0] == std::string{ "https://cdn.example.com/creative/0.mp4" } + '\0' );
+        // Compressed and shared values already save most of the bytes of the frequent ones
+        CHECK( cache.dataSize() * ( flags == 0U ? 2U : 1U ) < plainCache.dataSize() );
+
+        const auto reader = reloadDedup( cache );
+        CHECK( reader->getDuplicatedValues() == cache.getDuplicatedValues() );
+        for ( const auto * dedup : { static_cast<const LinearProbeDedupCache *>( &cache ), static_cast<const LinearProbeDedupCache *>( reader.get() ) } )
+        {
+            for ( const auto & [key, value] : strMap )
+            {
+                CHECK( dedup->get( key ) == std::string_view{ value } );
+                CHECK( dedup->getWithType( key ) == std::make_pair( std::string_view{ value }, CacheValueType::String ) );
+            }
+            CHECK( dedup->getVector( "list" ) == list );
+        }
+    }
+
+    LinearProbeDedupCache cache( 30U, 100UL, 0.5, std::make_unique<MallocMemoryHandler>(), CacheType::LINEAR_PROBE_DEDUP );
+    std::string value = "value";
+    cache.put( "key", value );
+    CHECK_THROWS_WITH( cache.detectFrequentValues( 10U ), "Frequent values must be detected from the first put" );
+    LinearProbeDedupCache detecting( 30U, 100UL, 0.5, std::make_unique<MallocMemoryHandler>(), CacheType::LINEAR_PROBE_DEDUP );
+    detecting.detectFrequentValues( 10U );
+    CHECK_THROWS_WITH( detecting.setDuplicatedValues( { "value" } ), "Frequent values are detected, don't set them" );
+}
+
+TEST_CASE( "LinearProbeDedupCacheManyFrequentValues" )
+{
+    // Indexes from 65536 take a varint, and the count of values a uint32_t
+    std::vector<std::string> duplicatedValues;
+    for ( auto ix = 0U; ix < 70000U; ++ix )
+    {
+        duplicatedValues.push_back( "frequent_" + std::to_string( ix ) + '\0' );
+    }
+    LinearProbeDedupCache cache( 30U, 100UL, 0.5, std::make_unique<MallocMemoryHandler>(), CacheType::LINEAR_PROBE_DEDUP_TYPED );
+    cache.setDuplicatedValues( duplicatedValues );
+    const std::vector<uint32_t> indexes{ 0U, 255U, 256U, 65535U, 65536U, 69999U };
+    for ( const auto index : indexes )
+    {
+        cache.put( "key" + std::to_string( index ), "frequent_" + std::to_string( index ) );
+    }
+    cache.put( "other", std::string{ "not frequent" } );
+    cache.finalize();
+    CHECK( cache.formatVersion() == cache.version() );
+
+    const auto reader = reloadDedup( cache );
+    CHECK( reader->getDuplicatedValues().size() == duplicatedValues.size() );
+    CHECK( reader->formatVersion() == cache.version() );
+    for ( const auto * dedup : { static_cast<const LinearProbeDedupCache *>( &cache ), static_cast<const LinearProbeDedupCache *>( reader.get() ) } )
+    {
+        for ( const auto index : indexes )
+        {
+            CHECK( dedup->get( "key" + std::to_string( index ) ) == "frequent_" + std::to_string( index ) );
+            CHECK( dedup->getKeyType( "key" + std::to_string( index ) ) == "String" );
+        }
+        CHECK( dedup->get( "other" ) == "not frequent" );
+    }
+}
+
+TEST_CASE( "LinearProbeCacheInt64ListTest" )
+{
+    std::vector<std::vector<int64_t>> lists;
+    for ( int64_t ix = 0; ix < 40; ++ix )
+    {
+        std::vector<int64_t> ids;
+        for ( int64_t id = 0; id < ix * 37; ++id )
+        {
+            ids.push_back( ix % 3 == 0 ? 9000000000L + id * ( ix + 5 ) : ( id % 2 == 0 ? -id * ix : id * 1000 ) );
+        }
+        lists.push_back( std::move( ids ) );
+    }
+    for ( const auto flags : { 0U,
+                               Constants::HeaderFlag::kAlignedValues8,
+                               Constants::HeaderFlag::kCompressedValues,
+                               Constants::HeaderFlag::kSharedValues } )
+    {
+        LinearProbeCache cache( 30U, 200UL, 0.5, std::make_unique<MallocMemoryHandler>(), flags );
+        for ( size_t ix = 0; ix < lists.size(); ++ix )
+        {
+            CHECK( cache.put( "ids_" + std::to_string( ix ), lists[ix] ).first );
+        }
+        cache.put( "same_ids", lists[12] );
+        cache.put( "name", std::string{ "not a list" } );
+        int64_t number = 5;
+        cache.put( "number", number );
+        cache.finalize();
+        // Readers of the base format would take the encoded list for an Int64
+        CHECK( cache.formatVersion() == cache.version() );
+
+        CacheHeader header{};
+        header.flags = cache.headerFlags();
+        header.offsetBits = cache.offsetBits();
+        header.numberOfKeySlots = cache.numberOfKeySlots();
+        header.numberOfEntries = cache.numberOfEntries();
+        header.maxCollisions = cache.maxCollisions();
+        auto memory = std::make_unique<MallocMemoryHandler>();
+        const auto size = cache.size() - sizeof( CacheHeader );
+        std::memcpy( memory->grow( size ), cache.getKeySpacePtr(), size );
+        const LinearProbeCache reader( header, std::move( memory ) );
+
+        for ( const auto * linearProbe : { static_cast<const LinearProbeCache *>( &cache ), &reader } )
+        {
+            for ( size_t ix = 0; ix < lists.size(); ++ix )
+            {
+                const auto key = "ids_" + std::to_string( ix );
+                const auto ids = linearProbe->getInt64List( key );
+                CHECK( ids.size() == lists[ix].size() );
+                CHECK( ids.toVector() == lists[ix] );
+                CHECK( linearProbe->getInt64List( key, LinearProbeCache::hashKey( key ) ).toVector() == lists[ix] );
+                CHECK( linearProbe->getKeyType( key ) == "Int64List" );
+                CHECK( linearProbe->getWithType( key ).second == CacheValueType::Int64List );
+                CHECK( linearProbe->getInt64( key, -1 ) == std::make_pair( int64_t{ -1 }, false ) );
+                for ( const auto id : lists[ix] )
+                {
+                    CHECK( linearProbe->containsInt64( key, id ) );
+                }
+                CHECK_FALSE( linearProbe->containsInt64( key, 1 ) );
+                CHECK_FALSE( linearProbe->containsInt64( key, LinearProbeCache::hashKey( key ), 1 ) );
+            }
+            CHECK( linearProbe->getInt64List( "same_ids" ).toVector() == lists[12] );
+            CHECK( linearProbe->containsInt64( "same_ids", lists[12][7] ) );
+            CHECK( linearProbe->getInt64List( "name" ).empty() );
+            CHECK_FALSE( linearProbe->containsInt64( "name", 0 ) );
+            CHECK( linearProbe->getInt64( "number" ) == std::make_pair( int64_t{ 5 }, true ) );
+            CHECK( linearProbe->getInt64List( "number" ).empty() );
+            CHECK( linearProbe->getInt64List( "missing" ).empty() );
+            CHECK_FALSE( linearProbe->containsInt64( "missing", 0 ) );
+        }
+    }
+
+    // Chained caches keep the whole type byte
+    BucketChainCache chained( 30U, 100UL, 0.5, std::make_unique<MallocMemoryHandler>() );
+    CHECK( chained.formatVersion() == Constants::kBaseFormatVersion );
+    chained.put( "ids", lists[7] );
+    CHECK( chained.formatVersion() == chained.version() );
+    CHECK( chained.getInt64List( "ids" ).toVector() == lists[7] );
+    CHECK( chained.containsInt64( "ids", lists[7][100] ) );
+    CHECK( CacheValue( std::vector<int64_t>{ 3, -1 } ).toDebugString() == R"({"type":"Int64List", "value":[3, -1]})" );
+}
+
+TEST_CASE( "LinearProbeCacheBitmapTest" )
+{
+    // Segments 0 to 9 hold every (ix + 2)-th value, the even ones spread over several containers
+    std::vector<std::vector<int64_t>> sets;
+    for ( int64_t ix = 0; ix < 10; ++ix )
+    {
+        std::vector<int64_t> values;
+        for ( int64_t value = ix; value < ( ix % 2 == 0 ? 200000 : 3000 ); value += ix + 2 )
+        {
+            values.push_back( value );
+        }
+        sets.push_back( std::move( values ) );
+    }
+    for ( const auto flags : { 0U,
+                               Constants::HeaderFlag::kAlignedValues8,
+                               Constants::HeaderFlag::kSharedValues } )
+    {
+        LinearProbeCache cache( 30U, 100UL, 0.5, std::make_unique<MallocMemoryHandler>(), flags );
+        for ( size_t ix = 0; ix < sets.size(); ++ix )
+        {
+            CHECK( cache.put( "segments_" + std::to_string( ix ), sets[ix], CacheValueType::Bitmap ).first );
+        }
+        // Readers of the base format would take a Bitmap for a Double
+        CHECK( cache.formatVersion() == cache.version() );
+        CHECK( cache.put( "ids", sets[3], CacheValueType::Int64List ).first );
+        CHECK_THROWS_AS( cache.put( "floats", sets[3], CacheValueType::FloatList ), std::runtime_error );
+        cache.finalize();
+
+        CacheHeader header{};
+        header.flags = cache.headerFlags();
+        header.offsetBits = cache.offsetBits();
+        header.numberOfKeySlots = cache.numberOfKeySlots();
+        header.numberOfEntries = cache.numberOfEntries();
+        header.maxCollisions = cache.maxCollisions();
+        auto memory = std::make_unique<MallocMemoryHandler>();
+        const auto size = cache.size() - sizeof( CacheHeader );
+        std::memcpy( memory->grow( size ), cache.getKeySpacePtr(), size );
+        const LinearProbeCache reader( header, std::move( memory ) );
+
+        for ( const auto * linearProbe : { static_cast<const LinearProbeCache *>( &cache ), &reader } )
+        {
+            std::vector<std::string> keys;
+            for ( size_t ix = 0; ix < sets.size(); ++ix )
+            {
+                keys.push_back( "segments_" + std::to_string( ix ) );
+                const auto & key = keys.back();
+                CHECK( linearProbe->getBitmap( key ).cardinality() == sets[ix].size() );
+                CHECK( linearProbe->getBitmap( key, LinearProbeCache::hashKey( key ) ).toVector() == std::vector<uint32_t>( sets[ix].begin(), sets[ix].end() ) );
+                CHECK( linearProbe->getKeyType( key ) == "Bitmap" );
+                CHECK( linearProbe->getWithType( key ).second == CacheValueType::Bitmap );
+                CHECK( linearProbe->getInt64List( key ).empty() );
+                CHECK( linearProbe->bitmapContains( key, static_cast<uint32_t>( sets[ix].back() ) ) );
+                CHECK( linearProbe->bitmapContains( key, LinearProbeCache::hashKey( key ), static_cast<uint32_t>( ix ) ) );
+                CHECK_FALSE( linearProbe->bitmapContains( key, static_cast<uint32_t>( ix + 1 ) ) );
+            }
+            keys.emplace_back( "ids" );
+            keys.emplace_back( "missing" );
+
+            // Segment 0 has the even values, so all of segment 4 and the values 4 mod 6 of segment 1
+            CHECK( linearProbe->bitmapIntersectCount( "segments_0", "segments_0" ) == 100000U );
+            CHECK( linearProbe->bitmapIntersectCount( "segments_0", "segments_4" ) == sets[4].size() );
+            CHECK( linearProbe->bitmapIntersectCount( "segments_1", "segments_0" ) == 500U );
+            CHECK( linearProbe->bitmapIntersectCount( "segments_3", "ids" ) == 0U );
+            CHECK( linearProbe->bitmapIntersectCount( "segments_3", "missing" ) == 0U );
+
+            const std::vector<std::string_view> keyViews( keys.begin(), keys.end() );
+            std::vector<char> expected;
+            for ( size_t ix = 0; ix < sets.size(); ++ix )
+            {
+                expected.push_back( std::binary_search( sets[ix].begin(), sets[ix].end(), 40 ) ? 1 : 0 );
+            }
+            expected.insert( expected.end(), { 0, 0 } );
+            auto found = std::make_unique<bool[]>( keys.size() );
+            const auto count = linearProbe->bitmapContainsMany( keyViews, 40U, std::span<bool>{ found.get(), keys.size() } );
+            CHECK( count == static_cast<size_t>( std::count( expected.begin(), expected.end(), 1 ) ) );
+            for ( size_t ix = 0; ix < keys.size(); ++ix )
+            {
+                CHECK( found[ix] == ( expected[ix] == 1 ) );
+            }
+            CHECK_THROWS_AS( (void)linearProbe->bitmapContainsMany( keyViews, 40U, std::span<bool>{ found.get(), 1U } ), std::runtime_error );
+        }
+    }
+
+    BucketChainCache chained( 30U, 100UL, 0.5, std::make_unique<MallocMemoryHandler>() );
+    chained.put( "segments", sets[2], CacheValueType::Bitmap );
+    CHECK( chained.bitmapContains( "segments", 2U ) );
+    CHECK( chained.getBitmap( "segments" ).cardinality() == sets[2].size() );
+    CHECK( CacheValue( std::vector<int64_t>{ 3, 1 }, CacheValueType::Bitmap ).toDebugString() == R"({"type":"Bitmap", "value":[3, 1]})" );
+}
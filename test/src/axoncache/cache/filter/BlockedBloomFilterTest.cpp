@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <axoncache/cache/filter/BlockedBloomFilter.h>
+#include "doctest/doctest.h"
+
+using namespace axoncache;
+
+TEST_CASE( "BlockedBloomFilterTestSize" )
+{
+    CHECK( BlockedBloomFilter::sizeFor( 0UL ) == BlockedBloomFilter::kBlockSize );
+    CHECK( BlockedBloomFilter::sizeFor( 1UL ) == BlockedBloomFilter::kBlockSize );
+    CHECK( BlockedBloomFilter::sizeFor( 1000000UL ) % BlockedBloomFilter::kBlockSize == 0UL );
+    CHECK( BlockedBloomFilter::sizeFor( 1000000UL ) * 8 >= 1000000UL * BlockedBloomFilter::kBitsPerKey );
+
+    const BlockedBloomFilter disabled;
+    CHECK_FALSE( disabled.isEnabled() );
+    CHECK( disabled.size() == 0UL );
+}
+
+TEST_CASE( "BlockedBloomFilterTestFalsePositiveRate" )
+{
+    const auto numberOfKeys = 100000UL;
+    std::vector<uint8_t> memory( BlockedBloomFilter::sizeFor( numberOfKeys ), 0U );
+    BlockedBloomFilter filter( memory.data(), memory.size() );
+    CHECK( filter.isEnabled() );
+    CHECK( filter.size() == memory.size() );
+
+    std::mt19937_64 random( 7 );
+    std::vector<uint64_t> hashes( numberOfKeys );
+    for ( auto & hash : hashes )
+    {
+        hash = random();
+        filter.insert( hash );
+    }
+
+    // No false negatives
+    for ( const auto hash : hashes )
+    {
+        REQUIRE( filter.mayContain( hash ) );
+    }
+
+    uint64_t falsePositives = 0;
+    const auto numberOfQueries = 1000000UL;
+    for ( uint64_t query = 0; query < numberOfQueries; ++query )
+    {
+        falsePositives += filter.mayContain( random() ) ? 1U : 0U;
+    }
+    CHECK( falsePositives < numberOfQueries / 100 );
+}
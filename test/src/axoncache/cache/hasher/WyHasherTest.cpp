@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+#include <axoncache/cache/LinearProbeCache.h>
+#include <axoncache/cache/factory/CacheFactory.h>
+#include <axoncache/cache/hasher/HashFunc.h>
+#include <axoncache/cache/hasher/WyHasher.h>
+#include <axoncache/memory/MallocMemoryHandler.h>
+#include "doctest/doctest.h"
+#include "CacheTestUtils.h"
+#include "axoncache/Constants.h"
+
+using namespace axoncache;
+
+TEST_CASE( "WyHasherTestHash" )
+{
+    CHECK( WyHasher::hashFuncId() == Constants::HashFuncId::WYHASH );
+
+    // The test vectors of upstream wyhash final version 4, the seed is their index. They cover keys
+    // of 0 to 16 bytes, 26 bytes, and 62 and 80 bytes that take the 48-byte rounds.
+    const std::array<std::pair<std::string_view, uint64_t>, 7> testVectors{ {
+        { "", 0x93228a4de0eec5a2ULL },
+        { "a", 0xc5bac3db178713c4ULL },
+        { "abc", 0xa97f2f7b1d9b3314ULL },
+        { "message digest", 0x786d1f1df3801df4ULL },
+        { "abcdefghijklmnopqrstuvwxyz", 0xdca5a8138ad37c87ULL },
+        { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 0xb9e734f117cfaf70ULL },
+        { "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 0x6cc5eab49a92d617ULL },
+    } };
+    for ( uint64_t seed = 0; seed < testVectors.size(); ++seed )
+    {
+        CHECK( WyHasher::hash( testVectors[seed].first, seed ) == testVectors[seed].second );
+    }
+
+    // Part of the file format, these must never change. Upstream has no vectors for these, they
+    // come from its code with seed 0: a short key, and exactly 48 bytes, the longest key hashed
+    // without a 48-byte round.
+    CHECK( WyHasher::hash( "" ) == 0x93228a4de0eec5a2ULL );
+    CHECK( WyHasher::hash( "key" ) == 0x50bab9e4dbedd9feULL );
+    CHECK( WyHasher::hash( testVectors[5].first.substr( 0, 48 ) ) == 0xbbb36dff86a9034eULL );
+
+    // Every length takes its own path through the short, medium and long key code
+    const std::string bytes( 200, 'x' );
+    std::unordered_set<uint64_t> hashes;
+    for ( size_t length = 0; length <= bytes.size(); ++length )
+    {
+        CHECK( hashes.insert( WyHasher::hash( std::string_view{ bytes.data(), length } ) ).second );
+    }
+
+    // Flipping any bit of a key changes its hash
+    for ( const auto length : { 3UL, 8UL, 17UL, 49UL, 100UL } )
+    {
+        std::string key = bytes.substr( 0, length );
+        const auto hash = WyHasher::hash( key );
+        for ( size_t bit = 0; bit < length * 8U; ++bit )
+        {
+            key[bit / 8U] = static_cast<char>( key[bit / 8U] ^ ( 1U << ( bit % 8U ) ) );
+            CHECK( WyHasher::hash( key ) != hash );
+            key[bit / 8U] = static_cast<char>( key[bit / 8U] ^ ( 1U << ( bit % 8U ) ) );
+        }
+    }
+
+    hashes.clear();
+    for ( const auto & [key, value] : test_utils::gen_random_str_map( 100000 ) )
+    {
+        CHECK( hashes.insert( WyHasher::hash( key ) ).second );
+    }
+
+    CHECK( hashFuncIdFromName( "xxh3" ) == Constants::HashFuncId::XXH3 );
+    CHECK( hashFuncIdFromName( "wyhash" ) == Constants::HashFuncId::WYHASH );
+    CHECK_THROWS_WITH( std::ignore = hashFuncIdFromName( "md5" ), "Unknown hash function md5, expected one of xxh3, wyhash" );
+}
+
+TEST_CASE( "WyHasherTestLinearProbeCache" )
+{
+    auto cache = CacheFactory::createCache( 30U, 2000UL, 0.5, CacheType::LINEAR_PROBE, Constants::HeaderFlag::kNegativeLookupFilter, Constants::HashFuncId::WYHASH );
+    CHECK( cache->hashFuncId() == Constants::HashFuncId::WYHASH );
+    auto & wyhashCache = dynamic_cast<LinearProbeWyhashCache &>( *cache );
+    const auto strMap = test_utils::gen_random_str_map( wyhashCache.maxNumberEntries() - 1 );
+    for ( const auto & [key, value] : strMap )
+    {
+        REQUIRE( wyhashCache.put( key, value ).first );
+    }
+    wyhashCache.finalize();
+    for ( const auto & [key, value] : strMap )
+    {
+        CHECK( wyhashCache.get( key ) == std::string_view{ value } );
+        CHECK( wyhashCache.contains( key, LinearProbeWyhashCache::hashKey( key ) ) );
+    }
+    CHECK_FALSE( wyhashCache.contains( "wyhash_missing_key" ) );
+    // Readers from before hashFuncId was checked would load it as xxh3
+    CHECK( wyhashCache.formatVersion() == wyhashCache.version() );
+    CHECK( LinearProbeCache( 30U, 2000UL, 0.5, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kNegativeLookupFilter ).formatVersion() == Constants::kBaseFormatVersion );
+
+    // Readers must hash keys the way the writer did
+    CacheHeader header{};
+    header.hashFuncId = wyhashCache.hashFuncId();
+    header.flags = wyhashCache.headerFlags();
+    header.offsetBits = wyhashCache.offsetBits();
+    header.numberOfKeySlots = wyhashCache.numberOfKeySlots();
+    header.numberOfEntries = wyhashCache.numberOfEntries();
+    const auto size = wyhashCache.size() - sizeof( CacheHeader );
+    auto memory = std::make_unique<MallocMemoryHandler>();
+    std::memcpy( memory->grow( size ), wyhashCache.getKeySpacePtr(), size );
+    const LinearProbeWyhashCache reader( header, std::move( memory ) );
+    for ( const auto & [key, value] : strMap )
+    {
+        CHECK( reader.get( key ) == std::string_view{ value } );
+    }
+    CHECK_THROWS_WITH( LinearProbeCache( header, std::make_unique<MallocMemoryHandler>() ),
+                       "cache data hashed with hashFuncId 3 can't be read with hashFuncId 2" );
+
+    CHECK_THROWS_WITH( CacheFactory::createCache( 30U, 2000UL, 0.5, CacheType::CUCKOO, 0U, Constants::HashFuncId::WYHASH ),
+                       "CacheFactory::createCache: hashFuncId 3 is not supported by CUCKOO" );
+}
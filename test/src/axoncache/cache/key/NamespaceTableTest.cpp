@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <axoncache/cache/key/NamespaceTable.h>
+#include "doctest/doctest.h"
+
+using namespace axoncache;
+
+TEST_CASE( "NamespaceTableTestStoredKey" )
+{
+    NamespaceTable table;
+    CHECK_FALSE( table.isEnabled() );
+    table.enable();
+    CHECK( table.isEnabled() );
+
+    StoredKey storedKey;
+    table.addStoredKey( "resource.key", storedKey );
+    CHECK( storedKey.view() == std::string_view{ "\x01\x00key", 5 } );
+    table.addStoredKey( "other.key.with.dots", storedKey );
+    CHECK( storedKey.view() == std::string_view{ "\x02\x00key.with.dots", 15 } );
+    table.addStoredKey( "resource.other", storedKey );
+    CHECK( storedKey.view() == std::string_view{ "\x01\x00other", 7 } );
+    table.addStoredKey( "no_separator", storedKey );
+    CHECK( storedKey.view() == std::string_view{ "\x00\x00no_separator", 14 } );
+    CHECK( table.numberOfNamespaces() == 2UL );
+    CHECK( table.toKey( storedKey.view() ) == "no_separator" );
+
+    // Lookups never add namespaces
+    CHECK( table.toStoredKey( "other.key", storedKey ) );
+    CHECK( table.toKey( storedKey.view() ) == "other.key" );
+    CHECK_FALSE( table.toStoredKey( "missing.key", storedKey ) );
+    CHECK( table.numberOfNamespaces() == 2UL );
+
+    // Long keys do not fit on the stack
+    const auto longKey = "resource." + std::string( 1000, 'k' );
+    CHECK( table.toStoredKey( longKey, storedKey ) );
+    CHECK( storedKey.view().size() == 1002UL );
+    CHECK( table.toKey( storedKey.view() ) == longKey );
+}
+
+TEST_CASE( "NamespaceTableTestSerialize" )
+{
+    NamespaceTable table;
+    table.enable();
+    StoredKey storedKey;
+    for ( const auto * key : { "a.1", "bb.2", "ccc.3", ".4" } )
+    {
+        table.addStoredKey( key, storedKey );
+    }
+    CHECK( table.size() == 0UL );
+
+    const auto size = table.serializedSize();
+    CHECK( size % 8 == 0UL );
+    std::vector<uint8_t> section( size, 0xFFU );
+    table.write( section.data() );
+    CHECK( table.size() == size );
+
+    NamespaceTable loaded;
+    loaded.load( section.data() );
+    CHECK( loaded.isEnabled() );
+    CHECK( loaded.size() == size );
+    CHECK( loaded.numberOfNamespaces() == 4UL );
+    for ( const auto * key : { "a.1", "bb.2", "ccc.3", ".4" } )
+    {
+        CHECK( loaded.toStoredKey( key, storedKey ) );
+        CHECK( loaded.toKey( storedKey.view() ) == key );
+    }
+    CHECK_FALSE( loaded.toStoredKey( "dd.5", storedKey ) );
+}
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <string>
+#include <string_view>
+#include <memory>
+#include <random>
+#include <vector>
+#include <axoncache/cache/CuckooCache.h>
+#include <axoncache/cache/probe/CuckooProbe.h>
+#include <axoncache/memory/MallocMemoryHandler.h>
+#include "doctest/doctest.h"
+#include <stdint.h>
+#include "CacheTestUtils.h"
+#include "axoncache/Constants.h"
+
+using namespace axoncache;
+
+TEST_CASE( "CuckooProbeTestLayout" )
+{
+    // Buckets start on a cache line once the keySpace follows the header
+    CHECK( ( sizeof( CacheHeader ) + cuckoo::kPaddingSlots * 8 ) % 64 == 0UL );
+    CHECK( cuckoo::keySlotsFor( 0UL ) == 8UL + cuckoo::kPaddingSlots );
+    CHECK( cuckoo::keySlotsFor( 8UL ) == 8UL + cuckoo::kPaddingSlots );
+    CHECK( cuckoo::keySlotsFor( 9UL ) == 16UL + cuckoo::kPaddingSlots );
+
+    CuckooProbe<8> probe( 35U, cuckoo::keySlotsFor( 1000UL ) );
+    CHECK( probe.cacheType() == CacheType::CUCKOO );
+    CHECK( probe.numberOfBuckets() == 125UL );
+    CHECK( probe.hashcodeBits() == 29 );
+    CHECK_THROWS_WITH( CuckooProbe<8>( 35U, 7UL ), "CUCKOO needs at least 8 key slots" );
+
+    std::mt19937_64 random( 42 );
+    for ( int index = 0; index < 1000; ++index )
+    {
+        const auto [first, second] = probe.buckets( random() );
+        CHECK( first < probe.numberOfBuckets() );
+        CHECK( second < probe.numberOfBuckets() );
+        CHECK( first != second );
+    }
+}
+
+TEST_CASE( "CuckooCacheHighLoad" )
+{
+    const auto maxLoadFactor = Constants::ConfDefault::kCuckooMaxLoadFactor;
+    CuckooCache cache( 30U, 8000UL, maxLoadFactor, std::make_unique<MallocMemoryHandler>() );
+    const auto strMap = test_utils::gen_random_str_map( cache.maxNumberEntries() - 1 );
+    for ( const auto & [key, value] : strMap )
+    {
+        REQUIRE( cache.put( key, value ).first );
+    }
+    CHECK_FALSE( cache.put( strMap.begin()->first, "again" ).first );
+    CHECK( cache.numberOfEntries() == strMap.size() );
+    CHECK( static_cast<double>( cache.numberOfEntries() ) / static_cast<double>( cache.numberOfKeySlots() ) > 0.9 );
+
+    for ( const auto & [key, value] : strMap )
+    {
+        CHECK( cache.contains( key ) );
+        CHECK( cache.get( key ) == std::string_view{ value } );
+    }
+    CHECK_FALSE( cache.contains( "cuckoo_missing_key" ) );
+    CHECK( cache.get( "cuckoo_missing_key", "missing" ) == "missing" );
+
+    CHECK_THROWS_WITH( CuckooCache( 30U, 64UL, 0.96, std::make_unique<MallocMemoryHandler>() ), "LoadFactor for CUCKOO can't greater than 0.950000" );
+    CHECK_THROWS_WITH( CuckooCache( 30U, 64UL, 0.5, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kRobinHood ),
+                       "Robin Hood placement and slot mapping are only supported by linear probe caches" );
+}
@@ -1,13 +1,17 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2025 AppLovin. All rights reserved.
 
+#include <algorithm>
+#include <stdexcept>
 #include <string_view>
+#include <vector>
 #include <axoncache/cache/probe/LinearProbe.h>
 #include <axoncache/memory/MallocMemoryHandler.h>
 #include "doctest/doctest.h"
 #include <stdint.h>
 #include "axoncache/Constants.h"
 #include "axoncache/Math.h"
+#include "axoncache/domain/CacheValue.h"
 #include "axoncache/memory/MemoryHandler.h"
 
 using namespace axoncache;
@@ -102,3 +106,63 @@ TEST_CASE( "LinearProbeTestRoundPow2" )
     CHECK( probe.calculateKeySpaceSize() == ( 1024UL * 8UL ) );
     CHECK( probe.findFreeKeySlotOffset( dummy, 72UL, memory.data(), collisions ) == ( 72UL * 8UL ) );
 }
+
+TEST_CASE( "LinearProbeTestSlotMapping" )
+{
+    CHECK( toSlotMapping( 0U ) == SlotMapping::MODULO );
+    CHECK( toSlotMapping( Constants::HeaderFlag::kSlotMappingFastRange ) == SlotMapping::FAST_RANGE );
+    CHECK( toSlotMapping( Constants::HeaderFlag::kSlotMappingPow2Mask | Constants::HeaderFlag::kRobinHood ) == SlotMapping::POW2_MASK );
+    CHECK_THROWS_AS( (void)toSlotMapping( Constants::HeaderFlag::kSlotMappingFastRange | Constants::HeaderFlag::kSlotMappingPow2Mask ), std::runtime_error );
+    CHECK( slotMappingHeaderFlag( "modulo" ) == 0U );
+    CHECK( slotMappingHeaderFlag( "fastrange" ) == Constants::HeaderFlag::kSlotMappingFastRange );
+    CHECK( slotMappingHeaderFlag( "pow2" ) == Constants::HeaderFlag::kSlotMappingPow2Mask );
+    CHECK_THROWS_AS( (void)slotMappingHeaderFlag( "division" ), std::runtime_error );
+
+    LinearProbe<8> probe( 35U, 1000UL );
+    CHECK_THROWS_AS( probe.setSlotMapping( SlotMapping::POW2_MASK ), std::runtime_error );
+
+    // Every mapping stays in range and, over consecutive hashcodes, reaches most slots
+    for ( const auto mapping : { SlotMapping::MODULO, SlotMapping::FAST_RANGE } )
+    {
+        probe.setSlotMapping( mapping );
+        std::vector<bool> isHome( probe.numberOfKeySlots() );
+        for ( uint64_t hashcode = 0; hashcode < 10000UL; ++hashcode )
+        {
+            const auto slotId = probe.homeSlotId( hashcode * 0xFF51AFD7ED558CCDULL );
+            REQUIRE( slotId < probe.numberOfKeySlots() );
+            isHome[slotId] = true;
+        }
+        CHECK( std::count( isHome.begin(), isHome.end(), true ) > 990 );
+    }
+
+    LinearProbe<8> pow2Probe( 35U, 1024UL );
+    pow2Probe.setSlotMapping( SlotMapping::POW2_MASK );
+    CHECK( pow2Probe.homeSlotId( 1024UL + 72UL ) == 72UL );
+    CHECK( pow2Probe.homeSlotId( ~0UL ) == 1023UL );
+}
+
+TEST_CASE( "LinearProbeTestRecordTypes" )
+{
+    // Every type up to FloatList keeps its record type of the base format and no type bits
+    for ( uint8_t type = 0; type <= static_cast<uint8_t>( CacheValueType::FloatList ); ++type )
+    {
+        CHECK( linear::recordType( type ) == type );
+        CHECK( linear::recordTypeBits( type ) == 0U );
+    }
+
+    for ( uint8_t type = 0; type <= static_cast<uint8_t>( CacheValueType::Bitmap ); ++type )
+    {
+        linear::LinearProbeRecord record{};
+        record.type = linear::recordType( type );
+        record.dedupIndex = linear::kDedupFlag | linear::recordTypeBits( type );
+        CHECK( ( record.dedupIndex & ~linear::kTypeHighMask ) == linear::kDedupFlag );
+        CHECK( linear::valueType( &record ) == type );
+    }
+
+    // The quantized lists, Int64Lists and Bitmaps are records of their own type
+    CHECK( linear::recordType( static_cast<uint8_t>( CacheValueType::Float16List ) ) == 0U );
+    CHECK( linear::recordType( static_cast<uint8_t>( CacheValueType::Int8List ) ) == 2U );
+    CHECK( linear::recordTypeBits( static_cast<uint8_t>( CacheValueType::Int64List ) ) == 1U << linear::kTypeHighShift );
+    CHECK( linear::recordType( static_cast<uint8_t>( CacheValueType::Bitmap ) ) == static_cast<uint8_t>( CacheValueType::Double ) );
+    CHECK( linear::recordTypeBits( static_cast<uint8_t>( CacheValueType::Bitmap ) ) == 1U << linear::kTypeHighShift );
+}
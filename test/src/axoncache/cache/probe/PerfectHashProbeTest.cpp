@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <string>
+#include <string_view>
+#include <memory>
+#include <random>
+#include <tuple>
+#include <vector>
+#include <axoncache/cache/LinearProbeCache.h>
+#include <axoncache/cache/PerfectHashCache.h>
+#include <axoncache/cache/probe/PerfectHashProbe.h>
+#include <axoncache/memory/MallocMemoryHandler.h>
+#include "doctest/doctest.h"
+#include <stdint.h>
+#include "CacheTestUtils.h"
+#include "axoncache/Constants.h"
+
+using namespace axoncache;
+
+TEST_CASE( "PerfectHashProbeTestLayout" )
+{
+    const auto empty = perfect::layoutFor( 0UL );
+    CHECK( empty.numberOfBuckets == 1UL );
+    CHECK( empty.tableSize == 0UL );
+    CHECK( empty.metadataSize == 16UL );
+
+    // A few bits per key on top of the 8-byte slots
+    const auto layout = perfect::layoutFor( 1000000UL );
+    CHECK( layout.tableSize > layout.numberOfKeys );
+    CHECK( layout.metadataSize % 8 == 0UL );
+    CHECK( layout.metadataSize * 8 < layout.numberOfKeys * 6 );
+
+    PerfectHashProbe<8> probe( 35U, 1000UL );
+    CHECK( probe.cacheType() == CacheType::PERFECT_HASH );
+    CHECK( probe.hashcodeBits() == 29 );
+    CHECK( !probe.isPerfect() );
+    CHECK( probe.keyspaceSize() == 1000UL * 8 );
+    CHECK_THROWS_WITH( PerfectHashProbe<8>( 15U, 1024UL ), "offset bits must in range of [ 16, 38 ]" );
+}
+
+TEST_CASE( "PerfectHashProbeTestBuild" )
+{
+    std::mt19937_64 random( 42 );
+    for ( const auto numberOfKeys : { 1UL, 2UL, 3UL, 100UL, 20000UL } )
+    {
+        std::vector<uint64_t> hashcodes( numberOfKeys );
+        for ( auto & hashcode : hashcodes )
+        {
+            hashcode = random();
+        }
+
+        PerfectHashProbe<8> probe( 30U, numberOfKeys );
+        std::vector<uint8_t> keySpace( numberOfKeys * 8 + probe.metadataSize() );
+        probe.writeFunction( perfect::build( hashcodes ), keySpace.data() );
+        CHECK( probe.isPerfect() );
+        CHECK( probe.keyspaceSize() == keySpace.size() );
+
+        // Every key gets its own slot and no slot is left over
+        std::vector<uint8_t> isUsed( numberOfKeys, 0U );
+        for ( const auto hashcode : hashcodes )
+        {
+            const auto slotId = probe.perfectSlotId( hashcode, keySpace.data() );
+            REQUIRE( slotId < numberOfKeys );
+            CHECK( isUsed[slotId] == 0U );
+            isUsed[slotId] = 1U;
+        }
+
+        // A reader only needs the keySpace to get the same function back
+        PerfectHashProbe<8> reader( 30U, numberOfKeys );
+        reader.loadFunction( keySpace.data() );
+        for ( const auto hashcode : hashcodes )
+        {
+            CHECK( reader.perfectSlotId( hashcode, keySpace.data() ) == probe.perfectSlotId( hashcode, keySpace.data() ) );
+        }
+    }
+
+    const std::vector<uint64_t> duplicated{ 1UL, 7UL, 1UL };
+    CHECK_THROWS_WITH( std::ignore = perfect::build( duplicated ), "perfect hash can't separate keys with the same hashcode" );
+}
+
+TEST_CASE( "PerfectHashCacheFinalize" )
+{
+    const auto numberOfKeySlots = 4000UL;
+    PerfectHashCache perfectCache( 30U, numberOfKeySlots, 0.5, std::make_unique<MallocMemoryHandler>() );
+    LinearProbeCache linearCache( 30U, numberOfKeySlots, 0.5, std::make_unique<MallocMemoryHandler>() );
+    const auto strMap = test_utils::gen_random_str_map( perfectCache.maxNumberEntries() - 1 );
+    for ( const auto & [key, value] : strMap )
+    {
+        CHECK( perfectCache.put( key, value ).first );
+        linearCache.put( key, value );
+    }
+    CHECK_FALSE( perfectCache.put( strMap.begin()->first, "again" ).first );
+
+    // Staged entries are readable before finalize
+    CHECK( perfectCache.get( strMap.begin()->first ) == std::string_view{ strMap.begin()->second } );
+
+    perfectCache.finalize();
+    perfectCache.finalize();
+    CHECK( perfectCache.numberOfKeySlots() == strMap.size() );
+    CHECK( perfectCache.numberOfEntries() == strMap.size() );
+    CHECK( perfectCache.maxCollisions() == 0U );
+    CHECK( perfectCache.dataSize() == linearCache.dataSize() );
+    CHECK( perfectCache.size() < linearCache.size() );
+
+    for ( const auto & [key, value] : strMap )
+    {
+        CHECK( perfectCache.contains( key ) );
+        CHECK( perfectCache.get( key ) == std::string_view{ value } );
+    }
+    CHECK_FALSE( perfectCache.contains( "perfect_hash_missing_key" ) );
+    CHECK( perfectCache.get( "perfect_hash_missing_key", "missing" ) == "missing" );
+    CHECK_THROWS_WITH( perfectCache.put( "perfect_hash_new_key", "value" ), "keySpace is full" );
+}
+
+TEST_CASE( "PerfectHashCacheEmpty" )
+{
+    PerfectHashCache cache( 30U, 16UL, 0.5, std::make_unique<MallocMemoryHandler>() );
+    cache.finalize();
+    CHECK( cache.numberOfKeySlots() == 0UL );
+    CHECK( cache.dataSize() == 0UL );
+    CHECK_FALSE( cache.contains( "key" ) );
+    CHECK( cache.getMany( std::vector<std::string_view>{ "key" }, "missing" )[0].first == "missing" );
+
+    CHECK_THROWS_WITH( PerfectHashCache( 30U, 16UL, 0.5, std::make_unique<MallocMemoryHandler>(), Constants::HeaderFlag::kRobinHood ),
+                       "Robin Hood placement and slot mapping are only supported by linear probe caches" );
+}
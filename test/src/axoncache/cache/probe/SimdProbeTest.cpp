@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <string>
+#include <string_view>
+#include <memory>
+#include <cstring>
+#include <vector>
+#include <axoncache/cache/LinearProbeCache.h>
+#include <axoncache/cache/LinearProbeSimdCache.h>
+#include <axoncache/cache/probe/SimdProbe.h>
+#include <axoncache/memory/MallocMemoryHandler.h>
+#include "doctest/doctest.h"
+#include <stdint.h>
+#include "CacheTestUtils.h"
+#include "axoncache/Constants.h"
+
+using namespace axoncache;
+
+TEST_CASE( "SimdProbeTestKeySpaceSize" )
+{
+    const uint16_t offsetBits = 35U;
+    SimdProbe<8> probe8( offsetBits, 1000UL );
+    CHECK( probe8.cacheType() == CacheType::LINEAR_PROBE_SIMD );
+    CHECK( probe8.hashcodeBits() == 29 );
+    CHECK( probe8.offsetBits() == 35 );
+    // slots, then one tag per slot plus the mirrored group tail, padded to 8 bytes
+    CHECK( probe8.keyspaceSize() == 1000UL * 8 + 1032UL );
+    CHECK( probe8.calculateKeySpaceSize() == probe8.keyspaceSize() );
+    CHECK( !simd::isaName().empty() );
+
+    CHECK_THROWS_WITH( SimdProbe<8>( 15U, 1024UL ), "offset bits must in range of [ 16, 38 ]" );
+}
+
+TEST_CASE( "SimdProbeTestTag" )
+{
+    CHECK( simd::tagOf( 0UL ) == 0x80 );
+    CHECK( simd::tagOf( ~0UL ) == 0xFF );
+    CHECK( simd::tagOf( 0x0123456789ABCDEFUL ) != simd::kEmptyTag );
+}
+
+TEST_CASE( "LinearProbeSimdCacheMatchesLinearProbe" )
+{
+    // Slot counts below, around and above the group width exercise the mirrored tag tail
+    for ( const auto numberOfKeySlots : { 2UL, 7UL, 16UL, 31UL, 33UL, 1000UL, 4099UL } )
+    {
+        const auto maxLoadFactor = 0.8;
+        LinearProbeSimdCache simdCache( 30U, numberOfKeySlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>() );
+        LinearProbeCache linearCache( 30U, numberOfKeySlots, maxLoadFactor, std::make_unique<MallocMemoryHandler>() );
+        const auto strMap = test_utils::gen_random_str_map( simdCache.maxNumberEntries() );
+
+        for ( const auto & [key, value] : strMap )
+        {
+            CHECK( simdCache.put( key, value ) == linearCache.put( key, value ) );
+        }
+        CHECK( simdCache.numberOfEntries() == strMap.size() );
+        CHECK( simdCache.maxCollisions() == linearCache.maxCollisions() );
+
+        for ( const auto & [key, value] : strMap )
+        {
+            CHECK( simdCache.contains( key ) );
+            CHECK( simdCache.get( key ) == std::string_view{ value } );
+        }
+
+        for ( const auto & key : { "missing", "", "missing.key.with.a.longer.name" } )
+        {
+            CHECK( simdCache.contains( key ) == linearCache.contains( key ) );
+            CHECK( simdCache.getString( key, "default" ) == std::make_pair( std::string_view{ "default" }, false ) );
+        }
+    }
+}
+
+TEST_CASE( "SimdProbeTestStopsAtMaxDisplacement" )
+{
+    const auto isa = simd::isaName();
+    const uint64_t width = isa == "avx2" ? 32U : ( isa == "scalar" ? 8U : 16U );
+
+    // A full probe sequence (no empty tag) of keys sharing one hashcode, with home slot 0: the bound
+    // alone ends the probe, in the same group when maxDisplacement is the last slot of a group
+    constexpr uint64_t kSlots = 128U;
+    constexpr uint64_t kOffsetMask = ( 1UL << 35U ) - 1U;
+    constexpr uint64_t kHashcode = 0xF000000000000000UL;
+    constexpr uint64_t kRecordSize = 16U;
+    const simd::ProbeLayout layout{ kSlots, kSlots * 8U, 0U, ~kOffsetMask, kOffsetMask, width - 1U };
+    const auto recordsOffset = layout.tagsOffset + kSlots + simd::kMaxGroupWidth;
+    std::vector<uint8_t> keySpace( recordsOffset + kSlots * kRecordSize, simd::tagOf( kHashcode ) );
+    for ( uint64_t slotId = 0; slotId < kSlots; ++slotId )
+    {
+        const auto offset = recordsOffset + slotId * kRecordSize;
+        const auto key = std::to_string( slotId );
+        auto * record = reinterpret_cast<linear::LinearProbeRecord *>( keySpace.data() + offset );
+        record->keySize = static_cast<uint16_t>( key.size() );
+        std::memcpy( record->data, key.data(), key.size() );
+        const auto slot = ( kHashcode & ~kOffsetMask ) | offset;
+        std::memcpy( keySpace.data() + slotId * 8U, &slot, sizeof( slot ) );
+    }
+
+    const auto findKeySlot = simd::findKeySlotFunc( SlotMapping::MODULO );
+    const auto lastInBound = std::to_string( width - 1U );
+    const auto firstOutOfBound = std::to_string( width );
+    CHECK( findKeySlot( layout, lastInBound, kHashcode, keySpace.data(), nullptr ) == static_cast<int64_t>( ( width - 1U ) * 8U ) );
+    CHECK( findKeySlot( layout, firstOutOfBound, kHashcode, keySpace.data(), nullptr ) == Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND );
+
+    auto shorter = layout;
+    shorter.maxDisplacement = width - 2U;
+    CHECK( findKeySlot( shorter, lastInBound, kHashcode, keySpace.data(), nullptr ) == Constants::ProbeStatus::AXONCACHE_KEY_NOT_FOUND );
+}
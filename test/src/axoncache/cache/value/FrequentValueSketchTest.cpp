@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <axoncache/cache/value/FrequentValueSketch.h>
+#include "doctest/doctest.h"
+
+using namespace axoncache;
+
+TEST_CASE( "FrequentValueSketchHeavyHitters" )
+{
+    FrequentValueSketch sketch( 64U );
+    // 5 heavy values hidden among far more distinct ones than the sketch tracks
+    for ( auto ix = 0U; ix < 20000U; ++ix )
+    {
+        sketch.add( "distinct_value_" + std::to_string( ix ) );
+        if ( ix % 2U == 0U )
+        {
+            sketch.add( "heavy_" + std::to_string( ix % 8U ) );
+        }
+        if ( ix % 5U == 0U )
+        {
+            sketch.add( "a much longer heavy value, worth more bytes" );
+        }
+    }
+    const auto candidates = sketch.candidates();
+    REQUIRE( candidates.size() <= 64U );
+    REQUIRE( candidates.size() >= 5U );
+    CHECK( candidates[0] == "a much longer heavy value, worth more bytes" );
+    const std::vector<std::string> heavy{ candidates.begin() + 1, candidates.begin() + 5 };
+    for ( const auto * value : { "heavy_0", "heavy_2", "heavy_4", "heavy_6" } )
+    {
+        CHECK( std::find( heavy.begin(), heavy.end(), value ) != heavy.end() );
+    }
+}
+
+TEST_CASE( "FrequentValueSketchSmallValues" )
+{
+    FrequentValueSketch sketch( 4U );
+    sketch.add( "abc" );
+    sketch.add( "abc" );
+    sketch.add( "abcd" );
+    CHECK( sketch.candidates() == std::vector<std::string>{ "abcd" } );
+    CHECK( FrequentValueSketch( 0U ).candidates().empty() );
+}
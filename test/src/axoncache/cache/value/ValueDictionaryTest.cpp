@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+#include <axoncache/cache/value/ValueDictionary.h>
+#include "doctest/doctest.h"
+#include "CacheTestUtils.h"
+
+using namespace axoncache;
+
+namespace
+{
+auto jsonValue( const std::string & id ) -> std::string
+{
+    return R"({"user_id":")" + id + R"(","segment":"high_value","country":"US","events":[{"type":"install"},{"type":"purchase"}]})";
+}
+}
+
+TEST_CASE( "ValueDictionaryTestRoundTrip" )
+{
+    std::vector<std::string> values;
+    for ( const auto & [key, value] : test_utils::gen_random_str_map_alpha_numeric( 1000 ) )
+    {
+        values.push_back( jsonValue( value ) );
+    }
+    const std::vector<std::string_view> samples( values.begin(), values.end() );
+
+    const auto trained = ValueDictionary::train( samples, 4096U );
+    CHECK_FALSE( trained.empty() );
+    CHECK( trained.size() <= 4096U );
+    CHECK( ValueDictionary::train( {}, 4096U ).empty() );
+
+    ValueDictionary dictionary;
+    CHECK_FALSE( dictionary.isEnabled() );
+    dictionary.set( trained );
+    CHECK( dictionary.isEnabled() );
+
+    std::string compressed;
+    std::string decompressed;
+    uint64_t rawSize = 0U;
+    uint64_t compressedSize = 0U;
+    for ( const auto & value : values )
+    {
+        REQUIRE( dictionary.compress( value, compressed ) );
+        CHECK( dictionary.decompress( compressed, decompressed ) == value );
+        rawSize += value.size();
+        compressedSize += compressed.size();
+    }
+    // Each value alone barely compresses, the shared dictionary is what makes it small
+    CHECK( compressedSize * 3U < rawSize );
+
+    // Values that don't get smaller are kept as they are, repeats compress with no dictionary
+    CHECK_FALSE( dictionary.compress( "", compressed ) );
+    CHECK_FALSE( dictionary.compress( "zq", compressed ) );
+    ValueDictionary empty;
+    empty.set( "" );
+    const auto repeated = std::string( 1000, 'a' ) + "b" + std::string( 1000, 'a' );
+    REQUIRE( empty.compress( repeated, compressed ) );
+    CHECK( compressed.size() < 20U );
+    CHECK( empty.decompress( compressed, decompressed ) == repeated );
+
+    // Truncated or extended input is caught instead of read past
+    REQUIRE( dictionary.compress( values[0], compressed ) );
+    CHECK_THROWS_WITH( std::ignore = dictionary.decompress( std::string_view{ compressed }.substr( 0, compressed.size() - 1U ), decompressed ), "corrupted compressed value" );
+    CHECK_THROWS_WITH( std::ignore = dictionary.decompress( compressed + "x", decompressed ), "corrupted compressed value" );
+    // A raw size past the longest value is refused before anything is allocated
+    CHECK_THROWS_WITH( std::ignore = dictionary.decompress( "\xff\xff\xff\xff\xff\xff\xff\x7f", decompressed ), "corrupted compressed value" );
+}
+
+TEST_CASE( "ValueDictionaryTestSerialize" )
+{
+    ValueDictionary dictionary;
+    dictionary.set( "dictionary bytes" );
+    CHECK( dictionary.size() == 0UL );
+
+    const auto size = dictionary.serializedSize();
+    CHECK( size % 8 == 0UL );
+    std::vector<uint8_t> section( size, 0xFFU );
+    dictionary.write( section.data() );
+    CHECK( dictionary.size() == size );
+
+    ValueDictionary loaded;
+    loaded.load( section.data() );
+    CHECK( loaded.isEnabled() );
+    CHECK( loaded.size() == size );
+    CHECK( loaded.bytes() == "dictionary bytes" );
+
+    // Values compressed with a dictionary decompress with its loaded copy
+    std::string compressed;
+    std::string decompressed;
+    REQUIRE( dictionary.compress( "dictionary bytes and more dictionary bytes", compressed ) );
+    CHECK( loaded.decompress( compressed, decompressed ) == "dictionary bytes and more dictionary bytes" );
+
+    section[0] = 0U;
+    CHECK_THROWS_WITH( loaded.load( section.data() ), "value dictionary size doesn't match" );
+}
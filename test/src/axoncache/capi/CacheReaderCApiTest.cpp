@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2025 AppLovin. All rights reserved.
 
+#include <cmath>
 #include <memory>
 #include <utility>
 #include <filesystem>
@@ -8,6 +9,8 @@
 #include <axoncache/memory/MallocMemoryHandler.h>
 #include "doctest/doctest.h"
 #include <cstdint>
+#include <string>
+#include <vector>
 #include "axoncache/capi/CacheReaderCApi.h"
 #include <axoncache/writer/CacheFileWriter.h>
 
@@ -86,6 +89,14 @@ TEST_CASE( "CacheReaderCApiTypedValueTest" ) // NOLINT
         const std::string key;
         cache.put( "7.a", key );
     }
+    {
+        const std::vector<int64_t> ids{ 4000000001LL, 4000000005LL, 4000000300LL };
+        cache.put( "8.a", ids );
+    }
+    {
+        cache.put( "9.a", std::vector<int64_t>{ 3, 70000, 4294967295LL }, CacheValueType::Bitmap );
+        cache.put( "9.b", std::vector<int64_t>{ 3, 4, 70000 }, CacheValueType::Bitmap );
+    }
 
     CacheFileWriter writer( dataPath, cacheName + "." + cacheTimestamp, &cache );
     writer.write();
@@ -293,6 +304,137 @@ TEST_CASE( "CacheReaderCApiTypedValueTest" ) // NOLINT
         CHECK( values == nullptr );
         CHECK( vectorSize == 0 );
     }
+    // Scores of FloatList values
+    {
+        std::string key = "6.a";
+        const std::vector<float> query{ 1.f, 0.f, 1.f };
+        int isExist = 0;
+        CHECK( CacheReader_DotProduct( handle, key.data(), key.size(), query.data(), query.size(), &isExist ) == 4.f );
+        CHECK( isExist == 1 );
+        CHECK( std::fabs( CacheReader_CosineSimilarity( handle, key.data(), key.size(), query.data(), query.size(), &isExist ) - 4.f / std::sqrt( 28.f ) ) <= 1e-6f );
+        CHECK( isExist == 1 );
+        CHECK( CacheReader_DotProduct( handle, key.data(), key.size(), query.data(), 2U, &isExist ) == 0.f );
+        CHECK( isExist == 0 );
+
+        // "6.z" is missing and "1.a" is no FloatList
+        std::string keys = "6.z6.a1.a";
+        const std::vector<size_t> keySizes{ 3U, 3U, 3U };
+        std::vector<float> scores( keySizes.size() );
+        CHECK( CacheReader_ScoreMany( handle, keys.data(), keySizes.data(), keySizes.size(), query.data(), query.size(), CACHE_READER_SCORE_DOT_PRODUCT, -1.f, scores.data() ) == 1 );
+        CHECK( scores == std::vector<float>{ -1.f, 4.f, -1.f } );
+        CHECK( CacheReader_ScoreMany( handle, keys.data(), keySizes.data(), keySizes.size(), query.data(), query.size(), 7, -1.f, scores.data() ) == -1 );
+
+        std::vector<int32_t> indexes( 2U );
+        CHECK( CacheReader_TopK( handle, keys.data(), keySizes.data(), keySizes.size(), query.data(), query.size(), CACHE_READER_SCORE_COSINE, 2U, indexes.data(), scores.data() ) == 1 );
+        CHECK( indexes[0] == 1 );
+        CHECK( std::fabs( scores[0] - 4.f / std::sqrt( 28.f ) ) <= 1e-6f );
+    }
+    // int64[]
+    {
+        std::string key = "8.a";
+        int listSize = 0;
+        int64_t * ids = CacheReader_GetInt64List( handle, key.data(), key.size(), &listSize );
+        REQUIRE( listSize == 3 );
+        CHECK( std::vector<int64_t>( ids, ids + listSize ) == std::vector<int64_t>{ 4000000001LL, 4000000005LL, 4000000300LL } );
+        free( ids ); // NOLINT
+        CHECK( CacheReader_ContainsInt64( handle, key.data(), key.size(), 4000000005LL ) == 1 );
+        CHECK( CacheReader_ContainsInt64( handle, key.data(), key.size(), 4000000006LL ) == 0 );
+
+        key = "2.a";
+        listSize = 1;
+        CHECK( CacheReader_GetInt64List( handle, key.data(), key.size(), &listSize ) == nullptr );
+        CHECK( listSize == 0 );
+        CHECK( CacheReader_ContainsInt64( handle, key.data(), key.size(), 123 ) == 0 );
+    }
+    // bitmap
+    {
+        std::string key = "9.a";
+        CHECK( CacheReader_BitmapContains( handle, key.data(), key.size(), 4294967295U ) == 1 );
+        CHECK( CacheReader_BitmapContains( handle, key.data(), key.size(), 4U ) == 0 );
+        std::string otherKey = "9.b";
+        CHECK( CacheReader_BitmapIntersectCount( handle, key.data(), key.size(), otherKey.data(), otherKey.size() ) == 2 );
+        otherKey = "8.a";
+        CHECK( CacheReader_BitmapIntersectCount( handle, key.data(), key.size(), otherKey.data(), otherKey.size() ) == 0 );
+
+        std::string keys = "9.a8.a9.b9.z";
+        const std::vector<size_t> keySizes{ 3U, 3U, 3U, 3U };
+        std::vector<int> found( keySizes.size(), -1 );
+        CHECK( CacheReader_BitmapContainsMany( handle, keys.data(), keySizes.data(), keySizes.size(), 70000U, found.data() ) == 2 );
+        CHECK( found == std::vector<int>{ 1, 0, 1, 0 } );
+    }
+    // Lookups by a precomputed hash
+    {
+        std::string key = "1.a";
+        const auto hash = CacheReader_HashKey( handle, key.data(), key.size() );
+        CHECK( hash == LinearProbeDedupCache::hashKey( key ).value );
+        CHECK( CacheReader_ContainsKeyWithHash( handle, key.data(), key.size(), hash ) == 1 );
+
+        int size = 0;
+        int isExist = 0;
+        char * val = CacheReader_GetKeyWithHash( handle, key.data(), key.size(), hash, &isExist, &size );
+        CHECK( isExist == 1 );
+        CHECK( std::string( val, size ) == "value" );
+        free( val ); // NOLINT
+
+        key = "2.a";
+        CHECK( CacheReader_GetLongWithHash( handle, key.data(), key.size(), CacheReader_HashKey( handle, key.data(), key.size() ), &isExist, 0 ) == 123 );
+        CHECK( isExist == 1 );
+        CHECK( CacheReader_GetIntegerWithHash( handle, key.data(), key.size(), CacheReader_HashKey( handle, key.data(), key.size() ), &isExist, 0 ) == 123 );
+        CHECK( isExist == 1 );
+
+        key = "3.a";
+        CHECK( CacheReader_GetBoolWithHash( handle, key.data(), key.size(), CacheReader_HashKey( handle, key.data(), key.size() ), &isExist, 0 ) == 1 );
+        CHECK( isExist == 1 );
+
+        key = "4.a";
+        CHECK( CacheReader_GetDoubleWithHash( handle, key.data(), key.size(), CacheReader_HashKey( handle, key.data(), key.size() ), &isExist, 0. ) == 3.14f );
+        CHECK( isExist == 1 );
+
+        // The hash of a different key misses
+        CHECK( CacheReader_GetLongWithHash( handle, key.data(), key.size(), hash, &isExist, 7 ) == 7 );
+        CHECK( isExist == 0 );
+        CHECK( CacheReader_ContainsKeyWithHash( handle, key.data(), key.size(), hash ) == 0 );
+    }
+    CacheReader_DeleteCppObject( handle );
+
+    // Same answers through the hot key cache, the second lookup of each key is served by it
+    handle = NewCacheReaderHandle();
+    REQUIRE( CacheReader_Initialize( handle, cacheName.c_str(), dataPath.c_str(), cacheTimestamp.c_str(), CACHE_READER_PRELOAD_MEMORY | CACHE_READER_HOT_KEY_CACHE ) == 0 );
+    for ( int round = 0; round < 2; ++round )
+    {
+        std::string key = "1.a";
+        int size = 0;
+        int isExist = 0;
+        char * val = CacheReader_GetKey( handle, key.data(), key.size(), &isExist, &size );
+        CHECK( isExist == 1 );
+        CHECK( std::string( val, size ) == "value" );
+        free( val ); // NOLINT
+
+        key = "7.a";
+        val = CacheReader_GetKey( handle, key.data(), key.size(), &isExist, &size );
+        CHECK( isExist == 1 );
+        CHECK( size == 0 );
+        free( val ); // NOLINT
+
+        key = "2.a";
+        CHECK( CacheReader_GetLong( handle, key.data(), key.size(), &isExist, 0 ) == 123 );
+        CHECK( isExist == 1 );
+        CHECK( CacheReader_GetInteger( handle, key.data(), key.size(), &isExist, 0 ) == 123 );
+        CHECK( isExist == 1 );
+
+        key = "3.a";
+        CHECK( CacheReader_GetBool( handle, key.data(), key.size(), &isExist, 0 ) == 1 );
+        CHECK( isExist == 1 );
+
+        key = "4.a";
+        CHECK( CacheReader_GetDouble( handle, key.data(), key.size(), &isExist, 0. ) == 3.14f );
+        CHECK( isExist == 1 );
+
+        key = "1.z";
+        CHECK( CacheReader_ContainsKey( handle, key.data(), key.size() ) == 0 );
+        CHECK( CacheReader_GetLong( handle, key.data(), key.size(), &isExist, 7 ) == 7 );
+        CHECK( isExist == 0 );
+    }
     CacheReader_DeleteCppObject( handle );
     std::filesystem::remove( dataPath + "/" + cacheName + "." + cacheTimestamp + ".cache" );
 }
@@ -187,6 +187,59 @@ TEST_CASE( "CacheWriterCApiDoubleHonorsValueSize" ) // NOLINT
     CHECK( exists == 1 );
     CacheReader_DeleteCppObject( reader );
 
+    reader = NewCacheReaderHandle();
+    REQUIRE( CacheReader_Initialize( reader, cacheName.c_str(), dataPath.c_str(), timestamp.c_str(), CACHE_READER_PRELOAD_MEMORY | CACHE_READER_HUGE_PAGES ) == 0 );
+    exists = 0;
+    CHECK( CacheReader_GetDouble( reader, key.data(), key.size(), &exists, 0.0 ) == 12.5 );
+    CHECK( exists == 1 );
+    CacheReader_DeleteCppObject( reader );
+
+    std::filesystem::remove( settingsPath );
+    std::filesystem::remove( timestampedPath );
+}
+
+TEST_CASE( "CacheWriterCApiWyhashTest" ) // NOLINT
+{
+    const std::string dataPath = std::filesystem::temp_directory_path();
+    const std::string settingsPath = dataPath + "/axoncache_wyhash.settings";
+    const std::string cacheName = "axoncache_wyhash";
+    const std::string timestamp = "1690484217136";
+    const std::string outputPath = dataPath + "/" + cacheName + ".cache";
+    const std::string timestampedPath = dataPath + "/" + cacheName + "." + timestamp + ".cache";
+
+    std::filesystem::remove( outputPath );
+    std::filesystem::remove( timestampedPath );
+
+    std::ostringstream settings;
+    settings << "ccache.destination_folder=" << dataPath << "\n";
+    settings << "ccache.type=3\n";
+    settings << "ccache.offset.bits=28\n";
+    settings << "ccache.hash_func=wyhash\n";
+    writeFile( settingsPath, settings.str() );
+
+    auto * writer = NewCacheWriterHandle();
+    REQUIRE( CacheWriter_Initialize( writer, cacheName.c_str(), settingsPath.c_str(), 100 ) == 0 );
+    std::string key = "wyhash.key";
+    std::string value = "123";
+    CHECK( CacheWriter_InsertKey( writer, key.data(), key.size(), value.data(), value.size(), static_cast<int8_t>( axoncache::CacheValueType::Int64 ) ) == 0 );
+    CHECK( CacheWriter_FinishCacheCreation( writer ) == 0 );
+    CacheWriter_Finalize( writer );
+    CacheWriter_DeleteCppObject( writer );
+    REQUIRE( ::rename( outputPath.c_str(), timestampedPath.c_str() ) == 0 );
+
+    auto * reader = NewCacheReaderHandle();
+    REQUIRE( CacheReader_Initialize( reader, cacheName.c_str(), dataPath.c_str(), timestamp.c_str(), true ) == 0 );
+    int exists = 0;
+    CHECK( CacheReader_GetLong( reader, key.data(), key.size(), &exists, 0 ) == 123 );
+    CHECK( exists == 1 );
+    CHECK( CacheReader_ContainsKey( reader, key.data(), key.size() ) == 1 );
+
+    // Hashes come from the function recorded in the file
+    const auto hash = CacheReader_HashKey( reader, key.data(), key.size() );
+    CHECK( CacheReader_ContainsKeyWithHash( reader, key.data(), key.size(), hash ) == 1 );
+    CHECK( CacheReader_GetLongWithHash( reader, key.data(), key.size(), hash, &exists, 0 ) == 123 );
+    CacheReader_DeleteCppObject( reader );
+
     std::filesystem::remove( settingsPath );
     std::filesystem::remove( timestampedPath );
 }
@@ -2,6 +2,11 @@
 // Copyright (c) 2025 AppLovin. All rights reserved.
 
 #include <axoncache/memory/MmapMemoryHandler.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
 #include "doctest/doctest.h"
 #include "axoncache/cache/CacheType.h"
 #include "axoncache/domain/CacheHeader.h"
@@ -13,3 +18,34 @@ TEST_CASE( "MmapMemoryHandlerTest" )
     CacheHeader header{};
     [[maybe_unused]] MmapMemoryHandler handler( header, "" );
 }
+
+TEST_CASE( "MmapMemoryHandlerTestHugePages" )
+{
+    CacheHeader header{};
+    header.headerSize = 64U;
+
+    // Not a multiple of any page size, so the copy has to stop at the end of the file
+    std::vector<uint8_t> content( 3UL * 1024 * 1024 + 123 );
+    for ( size_t index = 0; index < content.size(); ++index )
+    {
+        content[index] = static_cast<uint8_t>( index * 31 + 7 );
+    }
+    const auto cacheFile = ( std::filesystem::temp_directory_path() / "mmap_memory_handler_huge_pages.cache" ).string();
+    {
+        std::ofstream output( cacheFile, std::ios::binary );
+        output.write( reinterpret_cast<const char *>( content.data() ), static_cast<std::streamsize>( content.size() ) );
+    }
+
+    MmapMemoryHandler mapped( header, cacheFile, true );
+    MmapMemoryHandler copied( header, cacheFile, false, true );
+    CHECK_FALSE( mapped.isHugePageBacked() );
+#if defined( __linux__ )
+    CHECK( copied.isHugePageBacked() );
+#endif
+    REQUIRE( copied.dataSize() == content.size() - header.headerSize );
+    CHECK( mapped.dataSize() == copied.dataSize() );
+    CHECK( std::memcmp( copied.data(), content.data() + header.headerSize, copied.dataSize() ) == 0 );
+    CHECK( std::memcmp( copied.data(), mapped.data(), mapped.dataSize() ) == 0 );
+
+    std::filesystem::remove( cacheFile );
+}
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <axoncache/transformer/FloatListMath.h>
+#include "doctest/doctest.h"
+
+using namespace axoncache;
+
+namespace
+{
+auto testValues( size_t size, float phase ) -> std::vector<float>
+{
+    std::vector<float> values( size );
+    for ( size_t i = 0; i < size; ++i )
+    {
+        values[i] = std::sin( static_cast<float>( i ) * 0.37F + phase ) * static_cast<float>( 1U + i % 5U );
+    }
+    return values;
+}
+
+auto floatBytes( const std::vector<float> & values ) -> std::string
+{
+    std::string bytes( values.size() * sizeof( float ), '\0' );
+    std::memcpy( bytes.data(), values.data(), bytes.size() );
+    return bytes;
+}
+}
+
+TEST_CASE( "FloatListMathDot" )
+{
+    INFO( "isa=", FloatListMath::isaName() );
+    // Sizes around the 8 and 16 float SIMD steps exercise the scalar tails
+    for ( const size_t size : { 0UL, 1UL, 7UL, 8UL, 9UL, 15UL, 16UL, 17UL, 33UL, 100UL } )
+    {
+        const auto values = testValues( size, 0.0F );
+        const auto query = testValues( size, 1.0F );
+        for ( const auto type : { CacheValueType::FloatList, CacheValueType::Float16List, CacheValueType::BFloat16List, CacheValueType::Int8List } )
+        {
+            const auto bytes = type == CacheValueType::FloatList ? floatBytes( values ) : FloatListQuantizer::quantize( values, type );
+            const auto stored = type == CacheValueType::FloatList ? values : FloatListQuantizer::dequantize( bytes, type );
+            REQUIRE( FloatListMath::size( bytes, type ) == size );
+
+            double expectedDot = 0;
+            double expectedNorm = 0;
+            double absSum = 0;
+            for ( size_t i = 0; i < size; ++i )
+            {
+                expectedDot += static_cast<double>( stored[i] ) * query[i];
+                expectedNorm += static_cast<double>( stored[i] ) * stored[i];
+                absSum += std::fabs( static_cast<double>( stored[i] ) * query[i] );
+            }
+            // The SIMD order of the sums only moves the float rounding
+            CHECK( std::fabs( FloatListMath::dot( bytes, type, query.data() ) - expectedDot ) <= absSum * 1e-5 + 1e-6 );
+
+            const auto [cosine, isExist] = FloatListMath::score( "key", { bytes, type }, query, FloatListScore::Cosine, FloatListMath::squaredNorm( query ) );
+            CHECK( isExist == ( size != 0U ) );
+            if ( size != 0U )
+            {
+                const auto norms = expectedNorm * FloatListMath::squaredNorm( query );
+                const auto expected = norms > 0.0 ? expectedDot / std::sqrt( norms ) : 0.0;
+                CHECK( std::fabs( cosine - expected ) <= 1e-4 );
+            }
+        }
+    }
+}
+
+TEST_CASE( "FloatListMathScore" )
+{
+    const auto values = std::vector<float>{ 3.0F, 4.0F };
+    const auto bytes = floatBytes( values );
+    const std::vector<float> query{ 4.0F, 3.0F };
+    CHECK( FloatListMath::score( "key", { bytes, CacheValueType::FloatList }, query, FloatListScore::DotProduct, 0.0F ) == std::make_pair( 24.0F, true ) );
+    CHECK( std::fabs( FloatListMath::score( "key", { bytes, CacheValueType::FloatList }, query, FloatListScore::Cosine, 25.0F ).first - 24.0F / 25.0F ) <= 1e-6F );
+
+    // A zero vector scores 0 instead of NaN
+    const std::vector<float> zeros{ 0.0F, 0.0F };
+    CHECK( FloatListMath::score( "key", { bytes, CacheValueType::FloatList }, zeros, FloatListScore::Cosine, 0.0F ) == std::make_pair( 0.0F, true ) );
+
+    // Other sizes, other types and missing values don't score
+    CHECK_FALSE( FloatListMath::score( "key", { bytes, CacheValueType::FloatList }, std::vector<float>{ 1.0F }, FloatListScore::DotProduct, 0.0F ).second );
+    CHECK_FALSE( FloatListMath::score( "key", { bytes, CacheValueType::String }, query, FloatListScore::DotProduct, 0.0F ).second );
+    CHECK_FALSE( FloatListMath::score( "key", { std::string_view{}, CacheValueType::FloatList }, query, FloatListScore::DotProduct, 0.0F ).second );
+}
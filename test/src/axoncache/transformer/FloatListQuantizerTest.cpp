@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include <axoncache/transformer/FloatListQuantizer.h>
+#include "doctest/doctest.h"
+
+using namespace axoncache;
+
+namespace
+{
+auto testValues( size_t size ) -> std::vector<float>
+{
+    std::vector<float> values( size );
+    for ( size_t i = 0; i < size; ++i )
+    {
+        values[i] = std::sin( static_cast<float>( i ) * 0.37F ) * static_cast<float>( 1U + i % 5U );
+    }
+    return values;
+}
+}
+
+TEST_CASE( "FloatListQuantizerHalf" )
+{
+    CHECK( FloatListQuantizer::toHalf( 0.0F ) == 0x0000U );
+    CHECK( FloatListQuantizer::toHalf( -0.0F ) == 0x8000U );
+    CHECK( FloatListQuantizer::toHalf( 1.0F ) == 0x3C00U );
+    CHECK( FloatListQuantizer::toHalf( -2.0F ) == 0xC000U );
+    CHECK( FloatListQuantizer::toHalf( 65504.0F ) == 0x7BFFU );
+    CHECK( FloatListQuantizer::toHalf( 65520.0F ) == 0x7C00U );
+    CHECK( FloatListQuantizer::toHalf( std::numeric_limits<float>::infinity() ) == 0x7C00U );
+    CHECK( FloatListQuantizer::toHalf( std::numeric_limits<float>::quiet_NaN() ) == 0x7E00U );
+    CHECK( FloatListQuantizer::toHalf( 5.9604645e-8F ) == 0x0001U ); // smallest subnormal
+    CHECK( FloatListQuantizer::toHalf( 1.0F + 1.0F / 2048.0F ) == 0x3C00U ); // ties to even
+    CHECK( FloatListQuantizer::toHalf( 1.0F + 3.0F / 2048.0F ) == 0x3C02U );
+
+    // Every half goes through float and back unchanged, NaNs aside
+    for ( uint32_t half = 0; half <= 0xFFFFU; ++half )
+    {
+        const auto value = FloatListQuantizer::fromHalf( static_cast<uint16_t>( half ) );
+        if ( !std::isnan( value ) )
+        {
+            CHECK( FloatListQuantizer::toHalf( value ) == half );
+        }
+    }
+}
+
+TEST_CASE( "FloatListQuantizerBFloat16" )
+{
+    CHECK( FloatListQuantizer::toBFloat16( 1.0F ) == 0x3F80U );
+    CHECK( FloatListQuantizer::toBFloat16( -1.0F ) == 0xBF80U );
+    CHECK( FloatListQuantizer::fromBFloat16( 0x3F80U ) == 1.0F );
+    CHECK( FloatListQuantizer::toBFloat16( 1.0F + 1.0F / 256.0F ) == 0x3F80U ); // ties to even
+    CHECK( FloatListQuantizer::toBFloat16( 1.0F + 3.0F / 256.0F ) == 0x3F82U );
+    CHECK( std::isnan( FloatListQuantizer::fromBFloat16( FloatListQuantizer::toBFloat16( std::numeric_limits<float>::quiet_NaN() ) ) ) );
+    CHECK( std::isinf( FloatListQuantizer::fromBFloat16( FloatListQuantizer::toBFloat16( std::numeric_limits<float>::infinity() ) ) ) );
+}
+
+TEST_CASE( "FloatListQuantizerRoundTrip" )
+{
+    INFO( "isa=", FloatListQuantizer::isaName() );
+    // Sizes around the 4 and 8 float SIMD widths exercise the scalar tails
+    for ( const size_t size : { 0UL, 1UL, 3UL, 4UL, 7UL, 8UL, 9UL, 17UL, 100UL } )
+    {
+        const auto values = testValues( size );
+        float maxAbs = 0;
+        for ( const auto value : values )
+        {
+            maxAbs = std::max( maxAbs, std::fabs( value ) );
+        }
+
+        for ( const auto type : { CacheValueType::Float16List, CacheValueType::BFloat16List, CacheValueType::Int8List } )
+        {
+            const auto bytes = FloatListQuantizer::quantize( values, type );
+            CHECK( FloatListQuantizer::size( bytes, type ) == size );
+            CHECK( bytes.size() == ( type == CacheValueType::Int8List ? ( size == 0U ? 0U : sizeof( float ) + size ) : 2U * size ) );
+
+            const auto dequantized = FloatListQuantizer::dequantize( bytes, type );
+            REQUIRE( dequantized.size() == size );
+            for ( size_t i = 0; i < size; ++i )
+            {
+                // The SIMD path gives exactly the floats of the scalar one
+                CHECK( dequantized[i] == FloatListQuantizer::at( bytes, type, i ) );
+                switch ( type )
+                {
+                    case CacheValueType::Float16List:
+                        CHECK( std::fabs( dequantized[i] - values[i] ) <= std::fabs( values[i] ) / 2048.0F + 1e-7F );
+                        break;
+                    case CacheValueType::BFloat16List:
+                        CHECK( std::fabs( dequantized[i] - values[i] ) <= std::fabs( values[i] ) / 256.0F );
+                        break;
+                    default:
+                        CHECK( std::fabs( dequantized[i] - values[i] ) <= maxAbs / 127.0F / 2.0F + 1e-6F );
+                        break;
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE( "FloatListQuantizerErrors" )
+{
+    CHECK_THROWS_WITH( static_cast<void>( FloatListQuantizer::quantize( { 1.0F }, CacheValueType::Double ) ), "Can't quantize a FloatList to Double" );
+    CHECK_THROWS_WITH( static_cast<void>( FloatListQuantizer::quantize( { 1.0F, std::numeric_limits<float>::infinity() }, CacheValueType::Int8List ) ), "Int8List values must be finite" );
+    CHECK_THROWS_WITH( static_cast<void>( FloatListQuantizer::dequantize( "abcd", CacheValueType::FloatList ) ), "Can't dequantize a FloatList" );
+
+    // All zeros have a zero scale
+    const auto zeros = FloatListQuantizer::quantize( { 0.0F, -0.0F, 0.0F }, CacheValueType::Int8List );
+    CHECK( FloatListQuantizer::dequantize( zeros, CacheValueType::Int8List ) == std::vector<float>{ 0.0F, 0.0F, 0.0F } );
+}
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+#include <axoncache/transformer/Int64ListCodec.h>
+#include "doctest/doctest.h"
+
+using namespace axoncache;
+
+namespace
+{
+// Sorted ids with gaps of 1 to 4 bytes and a few repeats
+auto sortedIds( size_t size ) -> std::vector<int64_t>
+{
+    std::vector<int64_t> ids( size );
+    int64_t id = 1000000007;
+    for ( size_t i = 0; i < size; ++i )
+    {
+        const auto gap = i % 97U == 0U ? 40000000L : ( i % 13U == 0U ? 70000L : ( i % 11U == 0U ? 0L : static_cast<int64_t>( i % 200U ) + 1L ) );
+        id += gap;
+        ids[i] = id;
+    }
+    return ids;
+}
+}
+
+TEST_CASE( "Int64ListCodecRoundTrip" )
+{
+    CHECK( Int64ListCodec::size( Int64ListCodec::encode( {} ) ) == 0U );
+    CHECK( Int64ListCodec::decode( Int64ListCodec::encode( {} ) ).empty() );
+    CHECK( Int64ListCodec::size( std::string_view{} ) == 0U );
+
+    constexpr auto kMin = std::numeric_limits<int64_t>::min();
+    constexpr auto kMax = std::numeric_limits<int64_t>::max();
+    const std::vector<std::vector<int64_t>> lists{
+        { 42 },
+        { -5, -5, 0, 3 },
+        { kMin, 0, kMax },
+        { kMax, kMin, kMax, -1, 1 },
+        { 7, 3, 9, -2, 1000000, 999999 },
+        sortedIds( 127 ),
+        sortedIds( 128 ),
+        sortedIds( 129 ),
+        sortedIds( 1000 ),
+    };
+    for ( const auto & values : lists )
+    {
+        const auto bytes = Int64ListCodec::encode( values );
+        CHECK( Int64ListCodec::size( bytes ) == values.size() );
+        CHECK( Int64ListCodec::decode( bytes ) == values );
+        CHECK( Int64ListCodec::isSorted( bytes ) == std::is_sorted( values.begin(), values.end() ) );
+        CHECK( Int64ListView( bytes ).toVector() == values );
+
+        std::vector<int64_t> iterated;
+        for ( const auto value : Int64ListView( bytes ) )
+        {
+            iterated.push_back( value );
+        }
+        CHECK( iterated == values );
+    }
+
+    // Unsorted values with small steps either way stay as small as sorted ones
+    std::vector<int64_t> shuffled = sortedIds( 1000 );
+    for ( size_t i = 0; i + 1U < shuffled.size(); i += 2U )
+    {
+        std::swap( shuffled[i], shuffled[i + 1U] );
+    }
+    const auto shuffledBytes = Int64ListCodec::encode( shuffled );
+    CHECK_FALSE( Int64ListCodec::isSorted( shuffledBytes ) );
+    CHECK( Int64ListCodec::decode( shuffledBytes ) == shuffled );
+    CHECK( shuffledBytes.size() < shuffled.size() * 3U );
+}
+
+TEST_CASE( "Int64ListCodecSize" )
+{
+    // Small gaps take about 1 byte and a quarter per id, the control bits included
+    std::vector<int64_t> ids( 10000 );
+    for ( size_t i = 0; i < ids.size(); ++i )
+    {
+        ids[i] = 5000000000L + static_cast<int64_t>( i ) * 37L;
+    }
+    const auto bytes = Int64ListCodec::encode( ids );
+    CHECK( bytes.size() < ids.size() * 3U / 2U );
+    CHECK( Int64ListCodec::decode( bytes ) == ids );
+
+    // A delta past 32 bits makes its block raw, the others are unchanged
+    ids[300] += 1L << 40U;
+    for ( size_t i = 301; i < ids.size(); ++i )
+    {
+        ids[i] += 1L << 40U;
+    }
+    const auto rawBytes = Int64ListCodec::encode( ids );
+    CHECK( Int64ListCodec::decode( rawBytes ) == ids );
+    CHECK( rawBytes.size() < bytes.size() + Int64ListCodec::kBlockSize * sizeof( uint64_t ) );
+}
+
+TEST_CASE( "Int64ListCodecContains" )
+{
+    const auto ids = sortedIds( 1000 );
+    const auto bytes = Int64ListCodec::encode( ids );
+    for ( const auto id : ids )
+    {
+        CHECK( Int64ListCodec::contains( bytes, id ) );
+        if ( id + 1 != ids.back() && !std::binary_search( ids.begin(), ids.end(), id + 1 ) )
+        {
+            CHECK_FALSE( Int64ListCodec::contains( bytes, id + 1 ) );
+        }
+    }
+    CHECK_FALSE( Int64ListCodec::contains( bytes, ids.front() - 1 ) );
+    CHECK_FALSE( Int64ListCodec::contains( bytes, ids.back() + 1 ) );
+    CHECK_FALSE( Int64ListCodec::contains( Int64ListCodec::encode( {} ), 0 ) );
+    CHECK_FALSE( Int64ListCodec::contains( std::string_view{}, 0 ) );
+
+    const auto unsorted = Int64ListCodec::encode( { 9, -4, 300, 2, 2 } );
+    CHECK( Int64ListCodec::contains( unsorted, -4 ) );
+    CHECK( Int64ListCodec::contains( unsorted, 2 ) );
+    CHECK_FALSE( Int64ListCodec::contains( unsorted, 3 ) );
+
+    const auto isa = Int64ListCodec::isaName();
+    CHECK( ( isa == "ssse3" || isa == "neon" || isa == "scalar" ) );
+}
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 AppLovin. All rights reserved.
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <axoncache/transformer/RoaringBitmap.h>
+#include "doctest/doctest.h"
+
+using namespace axoncache;
+
+namespace
+{
+// Every step-th value of [begin, end)
+auto strided( int64_t begin, int64_t end, int64_t step ) -> std::vector<int64_t>
+{
+    std::vector<int64_t> values;
+    for ( auto value = begin; value < end; value += step )
+    {
+        values.push_back( value );
+    }
+    return values;
+}
+
+auto asUint32( const std::vector<int64_t> & values ) -> std::vector<uint32_t>
+{
+    std::vector<uint32_t> result( values.begin(), values.end() );
+    std::sort( result.begin(), result.end() );
+    result.erase( std::unique( result.begin(), result.end() ), result.end() );
+    return result;
+}
+
+auto expectedIntersectCount( const std::vector<int64_t> & left, const std::vector<int64_t> & right ) -> uint64_t
+{
+    const auto leftValues = asUint32( left );
+    const auto rightValues = asUint32( right );
+    std::vector<uint32_t> both;
+    std::set_intersection( leftValues.begin(), leftValues.end(), rightValues.begin(), rightValues.end(), std::back_inserter( both ) );
+    return both.size();
+}
+}
+
+TEST_CASE( "RoaringBitmapRoundTrip" )
+{
+    CHECK( RoaringBitmap::cardinality( RoaringBitmap::encode( {} ) ) == 0U );
+    CHECK( RoaringBitmap::decode( RoaringBitmap::encode( {} ) ).empty() );
+    CHECK( RoaringBitmap::cardinality( std::string_view{} ) == 0U );
+    CHECK( BitmapView().empty() );
+
+    const std::vector<std::vector<int64_t>> sets{
+        { 0 },
+        { 4294967295L, 7, 7, 65535, 65536, 0 },
+        strided( 0, 4096, 1 ),
+        strided( 0, 4097, 1 ),
+        strided( 100000, 400000, 3 ),
+        strided( 5, 1L << 32U, 1L << 24U ),
+    };
+    for ( const auto & values : sets )
+    {
+        const auto bytes = RoaringBitmap::encode( values );
+        const auto expected = asUint32( values );
+        CHECK( RoaringBitmap::cardinality( bytes ) == expected.size() );
+        CHECK( RoaringBitmap::decode( bytes ) == expected );
+        CHECK( BitmapView( bytes ).toVector() == expected );
+    }
+
+    // A dense container is a bitset of 8KB, a sparse one 2 bytes per value
+    CHECK( RoaringBitmap::encode( strided( 0, 65536, 1 ) ).size() < 8300U );
+    CHECK( RoaringBitmap::encode( strided( 0, 65536, 64 ) ).size() < 2100U );
+
+    CHECK_THROWS_AS( (void)RoaringBitmap::encode( { 1, -1 } ), std::runtime_error );
+    CHECK_THROWS_AS( (void)RoaringBitmap::encode( { 1L << 32U } ), std::runtime_error );
+}
+
+TEST_CASE( "RoaringBitmapContains" )
+{
+    const auto values = strided( 3, 300000, 7 );
+    const auto bytes = RoaringBitmap::encode( values );
+    size_t mismatches = 0;
+    for ( int64_t value = 0; value < 300010; ++value )
+    {
+        const bool expected = value >= 3 && value < 300000 && ( value - 3 ) % 7 == 0;
+        mismatches += RoaringBitmap::contains( bytes, static_cast<uint32_t>( value ) ) != expected ? 1U : 0U;
+    }
+    CHECK( mismatches == 0U );
+    CHECK_FALSE( RoaringBitmap::contains( bytes, 4294967295U ) );
+    CHECK_FALSE( RoaringBitmap::contains( std::string_view{}, 0U ) );
+
+    const auto sparse = RoaringBitmap::encode( { 4294967295L, 65536 } );
+    CHECK( BitmapView( sparse ).contains( 4294967295U ) );
+    CHECK( BitmapView( sparse ).contains( 65536U ) );
+    CHECK_FALSE( BitmapView( sparse ).contains( 0U ) );
+    CHECK_FALSE( BitmapView( sparse ).contains( 65537U ) );
+}
+
+TEST_CASE( "RoaringBitmapIntersectCount" )
+{
+    const auto isa = RoaringBitmap::isaName();
+    CHECK( ( isa == "avx2" || isa == "neon" || isa == "scalar" ) );
+
+    // Array and bitset containers against each other, with keys missing on either side
+    const std::vector<std::vector<int64_t>> sets{
+        {},
+        strided( 0, 200, 3 ),
+        strided( 0, 65536 * 3, 5 ),
+        strided( 65536, 65536 * 4, 11 ),
+        strided( 1000, 50000, 1 ),
+        strided( 10, 70000, 1000 ),
+        strided( 0, 65536, 17 ),
+    };
+    for ( const auto & left : sets )
+    {
+        for ( const auto & right : sets )
+        {
+            const auto leftBytes = RoaringBitmap::encode( left );
+            const auto rightBytes = RoaringBitmap::encode( right );
+            CHECK( RoaringBitmap::intersectCount( leftBytes, rightBytes ) == expectedIntersectCount( left, right ) );
+            CHECK( BitmapView( rightBytes ).intersectCount( BitmapView( leftBytes ) ) == expectedIntersectCount( left, right ) );
+        }
+    }
+}
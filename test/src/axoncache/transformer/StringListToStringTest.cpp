@@ -259,3 +259,58 @@ TEST_CASE( "StringListToStringToVectorSomeEmptyStringAtEnd" )
     CHECK( expected[1] == output[1] );
     CHECK( expected[2] == output[2] );
 }
+
+TEST_CASE( "StringListToStringIndexed" )
+{
+    const auto str = StringListToString::transformIndexed( std::vector<std::string_view>( { "hello", "", "world!" } ) );
+    std::string expected;
+
+    uint16_t marker = 0u;                                           // NOLINT
+    expected.append( ( const char * )&marker, sizeof( uint16_t ) ); // NOLINT
+    uint32_t numberOfElements = 3u;                                           // NOLINT
+    expected.append( ( const char * )&numberOfElements, sizeof( uint32_t ) ); // NOLINT
+    for ( uint32_t end : { 6u, 7u, 14u } )
+    {
+        expected.append( ( const char * )&end, sizeof( uint32_t ) ); // NOLINT
+    }
+    expected.append( "hello" );
+    expected.push_back( '\0' );
+    expected.push_back( '\0' );
+    expected.append( "world!" );
+    expected.push_back( '\0' );
+    CHECK( str == expected );
+
+    CHECK( StringListToString::transform( str ) == std::vector<std::string_view>( { "hello", "", "world!" } ) );
+    CHECK( StringListToString::size( str ) == 3U );
+    CHECK( StringListToString::at( str, 0 ) == "hello" );
+    CHECK( StringListToString::at( str, 1 ).empty() );
+    CHECK( StringListToString::at( str, 2 ) == "world!" );
+    CHECK( StringListToString::at( str, 2 ).data()[6] == '\0' );
+
+    // An empty list keeps the plain encoding
+    CHECK( StringListToString::transformIndexed( std::vector<std::string_view>() ) == StringListToString::transform( std::vector<std::string_view>() ) );
+    CHECK( StringListToString::size( StringListToString::transform( std::vector<std::string_view>() ) ) == 0U );
+    CHECK( StringListToString::size( std::string_view{} ) == 0U );
+
+    std::vector<std::string_view> largeVector( Constants::Limit::kVectorLength + 1 );
+    CHECK_THROWS_WITH( StringListToString::transformIndexed( largeVector ), "input vector size 65536 too large. max=65535" );
+}
+
+TEST_CASE( "StringListToStringSizeAndAt" )
+{
+    std::vector<std::string> elements;
+    for ( auto i = 0; i < 1000; ++i )
+    {
+        elements.push_back( std::string( static_cast<size_t>( i % 7 ), static_cast<char>( 'a' + i % 26 ) ) );
+    }
+    const std::vector<std::string_view> input( elements.begin(), elements.end() );
+    for ( const auto & str : { StringListToString::transform( input ), StringListToString::transformIndexed( input ) } )
+    {
+        REQUIRE( StringListToString::size( str ) == input.size() );
+        CHECK( StringListToString::transform( str ) == input );
+        for ( size_t i = 0; i < input.size(); ++i )
+        {
+            CHECK( StringListToString::at( str, i ) == input[i] );
+        }
+    }
+}
@@ -6,6 +6,7 @@
 #include <memory>
 #include <utility>
 #include <axoncache/Constants.h>
+#include <axoncache/cache/LinearProbeCache.h>
 #include <axoncache/cache/MapCache.h>
 #include <axoncache/memory/MallocMemoryHandler.h>
 #include <axoncache/version.h>
@@ -42,7 +43,7 @@ TEST_CASE( "GenerateHeaderTest" )
 
     CHECK( header.magicNumber == Constants::kCacheHeaderMagicNumber );
     CHECK( header.headerSize == sizeof( CacheHeader ) );
-    CHECK( header.version == ( AXONCACHE_VERSION_MAJOR * 1000 ) + ( AXONCACHE_VERSION_MINOR * 10 ) + AXONCACHE_VERSION_PATCH );
+    CHECK( header.version == Constants::kBaseFormatVersion );
     CHECK( header.cacheType == static_cast<uint16_t>( CacheType::MAP ) );
     CHECK( ( std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::system_clock::now().time_since_epoch() ).count() - header.creationTimeMs ) < 1000UL ); // Allow for 1 second of difference
     CHECK( header.numberOfKeySlots == 3 );
@@ -50,6 +51,27 @@ TEST_CASE( "GenerateHeaderTest" )
     CHECK( name == cacheName );
 }
 
+TEST_CASE( "GenerateHeaderFormatVersionTest" )
+{
+    GenerateHeader generator;
+    for ( const auto flags : { 0U, Constants::HeaderFlag::kRobinHood, Constants::HeaderFlag::kSlotMappingFastRange, Constants::HeaderFlag::kSharedValues } )
+    {
+        LinearProbeCache cache( 30U, 100UL, 0.5, std::make_unique<MallocMemoryHandler>(), flags );
+        cache.put( "hello", "world" );
+        cache.finalize();
+
+        std::stringstream output{};
+        generator.write( &cache, "test_cache", output );
+        std::stringstream input( output.str() );
+        const auto header = generator.read( input ).second;
+        // Only files that readers of the base format would misread get the runtime version
+        const auto isIncompatible = ( flags & Constants::HeaderFlag::kIncompatibleFlags ) != 0U;
+        CHECK( header.version == ( isIncompatible ? ( AXONCACHE_VERSION_MAJOR * 1000 ) + ( AXONCACHE_VERSION_MINOR * 10 ) + AXONCACHE_VERSION_PATCH : Constants::kBaseFormatVersion ) );
+        CHECK( header.version == cache.formatVersion() );
+        CHECK( header.flags == flags );
+    }
+}
+
 TEST_CASE( "GenerateHeaderLongNameTest" )
 {
     MapCache cache( std::make_unique<MallocMemoryHandler>() );
@@ -71,7 +93,7 @@ TEST_CASE( "GenerateHeaderLongNameTest" )
 
     CHECK( header.magicNumber == Constants::kCacheHeaderMagicNumber );
     CHECK( header.headerSize == sizeof( CacheHeader ) );
-    CHECK( header.version == ( AXONCACHE_VERSION_MAJOR * 1000 ) + ( AXONCACHE_VERSION_MINOR * 10 ) + AXONCACHE_VERSION_PATCH );
+    CHECK( header.version == Constants::kBaseFormatVersion );
     CHECK( header.cacheType == static_cast<uint16_t>( CacheType::MAP ) );
     CHECK( ( std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::system_clock::now().time_since_epoch() ).count() - header.creationTimeMs ) < 1000UL ); // Allow for 1 second of difference
     CHECK( header.numberOfKeySlots == 3 );